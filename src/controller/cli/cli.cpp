@@ -1,6 +1,18 @@
 #include "controller/cli/cli.hpp"
+#include "model/pgn/pgn.hpp"
 
 namespace Controller {
+    namespace {
+        bool isNumber(std::string_view token) {
+            if (token.empty()) return false;
+
+            for (char c : token) {
+                if (c < '0' || c > '9') return false;
+            }
+            return true;
+        }
+    } // namespace
+
     CLI::CLI() {};
 
     void CLI::start() {
@@ -14,6 +26,78 @@ namespace Controller {
         this->_view.success("Chess game successfully ends!");
     };
 
+    std::size_t CLI::batch(std::istream &in, std::ostream &out) {
+        std::string white = "White", black = "Black";
+        auto &model = this->_model;
+        std::size_t nGames = 0, nErrors = 0;
+        std::string line, fen;
+        while (std::getline(in, line)) {
+            auto tokens = split(line);
+            if (tokens.empty() || tokens[0].front() == '#') continue;
+
+            ++nGames;
+            std::size_t i = 0;
+            fen = PGN::STANDARD_FEN;
+            if (tokens[0] == "startpos") {
+                i = 1;
+            } else if (tokens[0] == "fen") {
+                fen.clear();
+                // Position fields, then the clocks only when they are numbers
+                for (i = 1; i < tokens.size() && tokens[i] != "moves" &&
+                            (i <= 4 || (i <= 6 && isNumber(tokens[i])));
+                     ++i) {
+                    if (!fen.empty()) fen += ' ';
+                    fen += tokens[i];
+                }
+            }
+            if (i < tokens.size() && tokens[i] == "moves") ++i;
+
+            int ply = 0;
+            std::string_view notation;
+            try {
+                if (model.status() == Game::Status::NOT_STARTED) {
+                    model.start(white, black, fen);
+                } else {
+                    model.restart(fen);
+                }
+                for (; i < tokens.size(); ++i) {
+                    notation = tokens[i];
+                    if (notation.back() == '.') continue;
+                    if (notation == "1-0" || notation == "0-1" || notation == "1/2-1/2" ||
+                        notation == "*") {
+                        break;
+                    }
+                    model.play(notation);
+                    ++ply;
+                }
+            } catch (const std::runtime_error &error) {
+                ++nErrors;
+                out << nGames << " error " << ply << ' '
+                    << (notation.empty() ? std::string_view("-") : notation) << ": "
+                    << error.what() << '\n';
+                continue;
+            }
+            out << nGames << ' ' << model.result() << ' ' << std::string(model.status()) << ' '
+                << ply << ' ' << model.fen() << '\n';
+        }
+        out.flush();
+        return nErrors;
+    }
+
+    std::vector<std::string_view> CLI::split(std::string_view line) {
+        std::vector<std::string_view> tokens;
+        for (std::size_t i = 0; i < line.size();) {
+            if (line[i] == ' ' || line[i] == '\t' || line[i] == '\r') {
+                ++i;
+                continue;
+            }
+            std::size_t start = i;
+            while (i < line.size() && line[i] != ' ' && line[i] != '\t' && line[i] != '\r') ++i;
+            tokens.push_back(line.substr(start, i - start));
+        }
+        return tokens;
+    }
+
     std::string CLI::mainMenu() {
         auto &view = this->_view;
         std::vector<std::string> menu = {"Start new game", "Quit"};
@@ -41,12 +125,12 @@ namespace Controller {
         model.start(namePlayer1, namePlayer2);
 
         std::string mainChoice;
-        std::vector<std::string> mainMenu = {"Select a piece", "Quit"};
+        std::vector<std::string> mainMenu = {"Play a move", "Quit"};
         std::string moveError;
 
         std::string playerName;
-        Position from;
-        Position to;
+        std::string notation;
+        std::string san;
         auto gameEnded = [&model]() { return model.status() != Game::Status::IN_PROGRESS; };
         while (!gameEnded()) {
             this->showBoard();
@@ -56,13 +140,11 @@ namespace Controller {
             mainChoice = view.menu(mainMenu);
             if (mainChoice == "Quit") break;
 
-            from = this->inputPosition(playerName + ", select a piece by its row and column:");
-            to = this->inputPosition(playerName + ", select a destination by its row and column:");
+            notation = this->inputMove(playerName + ", enter a move like 'e4', 'Nf3' or 'g1f3':");
 
-            moveError = this->movePiece(from, to);
+            moveError = this->movePiece(notation, san);
             if (static_cast<int>(moveError.size()) == 0) {
-                view.success(playerName + ", pieces successfully moves to " +
-                             std::to_string(to.row()) + "," + std::to_string(to.column()));
+                view.success(playerName + " successfully plays " + san);
                 continue;
             }
             view.error("Couldn't move the piece because of: " + moveError);
@@ -80,6 +162,15 @@ namespace Controller {
         if (status == Game::Status::ENDED_STALEMATE) {
             return view.warn("Game ended on STALEMATE, no winner!");
         }
+        if (status == Game::Status::ENDED_REPETITION) {
+            return view.warn("Game ended on THREEFOLD REPETITION, no winner!");
+        }
+        if (status == Game::Status::ENDED_FIFTY_MOVES) {
+            return view.warn("Game ended on the FIFTY-MOVE RULE, no winner!");
+        }
+        if (status == Game::Status::ENDED_INSUFFICIENT_MATERIAL) {
+            return view.warn("Game ended on INSUFFICIENT MATERIAL, no winner!");
+        }
         if (status == Game::Status::ENDED_CHECKMATE) {
             auto currentPlayer = model.currentPlayer();
             auto winner = (currentPlayer == model.player1()) ? model.player2() : currentPlayer;
@@ -112,11 +203,11 @@ namespace Controller {
         for (int i = 0; i < gridNRow; ++i) {
             for (int j = 0; j < gridNCol; ++j) {
                 if (this->isColLabel(gridNRow, i, j)) {
-                    grid[i][j] = '0' + (j / 2 - 1);
+                    grid[i][j] = (j == 0) ? ' ' : static_cast<char>('a' + (j / 2 - 1));
                     continue;
                 }
                 if (this->isRowLabel(gridNRow, i, j)) {
-                    grid[i][j] = '0' + (boardNRow - 1 - i / 2);
+                    grid[i][j] = '1' + (boardNRow - 1 - i / 2);
                     continue;
                 }
                 if (this->isHorizontalBorder(i, j)) {
@@ -151,20 +242,24 @@ namespace Controller {
         this->_view.outputGrid(grid);
     }
 
-    Position CLI::inputPosition(const std::string &message) const {
+    std::string CLI::inputMove(const std::string &message) const {
         auto &view = this->_view;
         view.output(message);
-        auto input = view.inputChecker(
-            "^[0-7],[0-7]$",
-            "Position must be 2 digits between [0-7] separated by a commas like '7,0'.");
-        int row = std::stoi(input.substr(0, 1)), column = std::stoi(input.substr(2));
-        return Position(row, column);
+        while (true) {
+            auto input = view.input();
+            auto first = input.find_first_not_of(" \t\r");
+            if (first != std::string::npos) {
+                return input.substr(first, input.find_last_not_of(" \t\r") - first + 1);
+            }
+            view.error("A move is required.");
+            view.output("Try again:");
+        }
     }
 
-    std::string CLI::movePiece(const Position &from, const Position &to) {
+    std::string CLI::movePiece(const std::string &notation, std::string &san) {
         std::string errorMessage;
         try {
-            this->_model.move(from, to);
+            san = this->_model.move(notation);
         } catch (const std::exception &e) {
             errorMessage = e.what();
         }
@@ -1,7 +1,12 @@
 #ifndef CONTROLLER_CLI_HPP
 #define CONTROLLER_CLI_HPP
 
+#include <cstddef>
+#include <istream>
+#include <ostream>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "model/game/game.hpp"
 #include "view/view.hpp"
@@ -15,14 +20,26 @@ namespace Controller {
         void startNewGame();
         void playGame(std::string &namePlayer1, std::string &namePlayer2);
         void showBoard() const;
-        Position inputPosition(const std::string &message) const;
-        std::string movePiece(const Position &from, const Position &to);
+        std::string inputMove(const std::string &message) const;
+        std::string movePiece(const std::string &notation, std::string &san);
 
       public:
         CLI();
 
         void start();
 
+        /**
+         * @brief Replay games without any prompt, one game per line of the input
+         *    - A line is "[startpos | fen <FEN>] [moves] <move>...", moves
+         *      being written in SAN or LAN; move numbers ("12.", "12...") and
+         *      a trailing result are skipped, as are blank and '#' lines
+         *    - Each game writes "<game> <result> <status> <plies> <FEN>", or
+         *      "<game> error <ply> <move>: <reason>" when it cannot be replayed
+         *    - One Board is set up again for every game, nothing is rendered
+         * @return The number of games that could not be replayed
+         */
+        std::size_t batch(std::istream &in, std::ostream &out);
+
       private:
         bool isEven(int x) const;
         bool isOdd(int x) const;
@@ -33,6 +50,8 @@ namespace Controller {
         bool isVerticalBorder(int i, int j) const;
         bool isCrossPoint(int i, int j) const;
         void evaluateEdnGame() const;
+
+        static std::vector<std::string_view> split(std::string_view line);
     };
 
 } // namespace Controller
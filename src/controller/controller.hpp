@@ -2,5 +2,6 @@
 #define CONTROLLER_HPP
 
 #include "controller/cli/cli.hpp"
+#include "controller/uci/uci.hpp"
 
 #endif // CONTROLLER_HPP
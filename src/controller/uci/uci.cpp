@@ -0,0 +1,404 @@
+#include "controller/uci/uci.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+
+#include "model/notation/notation.hpp"
+#include "model/pgn/pgn.hpp"
+
+namespace Controller {
+    namespace {
+        template <typename T>
+        bool parseNumber(std::string_view text, T &value) {
+            auto end = text.data() + text.size();
+            auto [ptr, error] = std::from_chars(text.data(), end, value);
+            return error == std::errc() && ptr == end;
+        }
+
+        struct Feature {
+            std::string_view name;
+            bool Search::Searcher::Options::*option;
+        };
+
+        const Feature FEATURES[] = {
+            {"NullMove", &Search::Searcher::Options::nullMove},
+            {"LateMoveReductions", &Search::Searcher::Options::lateMoveReductions},
+            {"Futility", &Search::Searcher::Options::futility},
+            {"ReverseFutility", &Search::Searcher::Options::reverseFutility},
+            {"PrincipalVariation", &Search::Searcher::Options::principalVariation},
+            {"AspirationWindows", &Search::Searcher::Options::aspirationWindows}};
+    } // namespace
+
+    UCI::UCI(std::istream &in, std::ostream &out)
+        : _in(in)
+        , _out(out)
+        , _outputMutex()
+        , _outputReady()
+        , _lines()
+        , _isClosing(false)
+        , _writer()
+        , _white("White")
+        , _black("Black")
+        , _board(8, 8)
+        , _searcher()
+        , _mcts()
+        , _isMcts(false)
+        , _tablebases()
+        , _book()
+        , _hasBook(false)
+        , _searchMutex()
+        , _searchReleased()
+        , _isPondering(false)
+        , _isInfinite(false)
+        , _isStopRequested(false)
+        , _ponderTime(0)
+        , _searchThread() {
+        this->_board.initialize(this->_white, this->_black, PGN::STANDARD_FEN);
+        this->_writer = std::thread(&UCI::write, this);
+    }
+
+    UCI::~UCI() {
+        this->stopSearch();
+        {
+            std::lock_guard<std::mutex> lock(this->_outputMutex);
+            this->_isClosing = true;
+        }
+        this->_outputReady.notify_one();
+        this->_writer.join();
+    }
+
+    void UCI::start() {
+        std::string line;
+        while (std::getline(this->_in, line)) {
+            if (!this->execute(line)) return this->stopSearch();
+        }
+        this->finishSearch();
+    }
+
+    bool UCI::execute(std::string_view line) {
+        auto tokens = split(line);
+        if (tokens.empty()) return true;
+
+        auto command = tokens[0];
+        if (command == "quit") return false;
+
+        if (command == "uci") {
+            this->uci();
+        } else if (command == "isready") {
+            this->post("readyok");
+        } else if (command == "ucinewgame") {
+            this->stopSearch();
+            this->_searcher.heuristics().clear();
+            this->_mcts.clear();
+            this->_board.initialize(this->_white, this->_black, PGN::STANDARD_FEN);
+        } else if (command == "setoption") {
+            this->setOption(tokens);
+        } else if (command == "position") {
+            this->position(tokens);
+        } else if (command == "go") {
+            this->go(tokens);
+        } else if (command == "stop") {
+            this->stopSearch();
+        } else if (command == "ponderhit") {
+            this->ponderHit();
+        } else {
+            this->post("info string Unknown command: " + std::string(line));
+        }
+        return true;
+    }
+
+    void UCI::uci() {
+        this->post("id name " + std::string(NAME));
+        this->post("id author The Chess authors");
+        this->post("option name Ponder type check default false");
+        this->post("option name BookFile type string default <empty>");
+        this->post("option name TablebasePath type string default <empty>");
+        this->post("option name EvalParameters type string default <empty>");
+        this->post("option name UseMCTS type check default false");
+        Search::Searcher::Options defaults;
+        for (auto &feature : FEATURES) {
+            this->post("option name " + std::string(feature.name) + " type check default " +
+                       ((defaults.*feature.option) ? "true" : "false"));
+        }
+        this->post("uciok");
+    }
+
+    void UCI::setOption(const std::vector<std::string_view> &tokens) {
+        // setoption name <name with spaces> [value <value with spaces>]
+        std::string name, value;
+        std::string *field = nullptr;
+        for (std::size_t i = 1; i < tokens.size(); ++i) {
+            if (tokens[i] == "name") {
+                field = &name;
+                continue;
+            }
+            if (tokens[i] == "value" && field == &name) {
+                field = &value;
+                continue;
+            }
+            if (field == nullptr) continue;
+
+            if (!field->empty()) *field += ' ';
+            *field += tokens[i];
+        }
+
+        this->stopSearch();
+        try {
+            if (name == "Ponder") return;
+
+            if (name == "BookFile") {
+                this->_hasBook = !value.empty() && value != "<empty>";
+                if (this->_hasBook) this->_book.open(value);
+                return;
+            }
+            if (name == "TablebasePath") {
+                this->_tablebases = Tablebase::Tablebases();
+                if (!value.empty() && value != "<empty>") this->_tablebases.load(value);
+                this->_searcher.tablebases(this->_tablebases.size() > 0 ? &this->_tablebases
+                                                                        : nullptr);
+                return;
+            }
+            if (name == "EvalParameters") {
+                Search::Evaluation::parameters((value.empty() || value == "<empty>")
+                                                   ? Search::Parameters::defaults()
+                                                   : Search::Parameters::load(value));
+                return;
+            }
+            if (name == "UseMCTS") {
+                this->_isMcts = (value == "true");
+                return;
+            }
+            for (auto &feature : FEATURES) {
+                if (name != feature.name) continue;
+
+                auto options = this->_searcher.options();
+                options.*feature.option = (value == "true");
+                this->_searcher.options(options);
+                return;
+            }
+            this->post("info string Unknown option: name='" + name + "'");
+        } catch (const std::exception &error) {
+            this->_hasBook = this->_hasBook && name != "BookFile";
+            this->post("info string " + std::string(error.what()));
+        }
+    }
+
+    void UCI::position(const std::vector<std::string_view> &tokens) {
+        this->stopSearch();
+
+        std::size_t i = 1;
+        std::string fen;
+        if (i < tokens.size() && tokens[i] == "startpos") {
+            fen = PGN::STANDARD_FEN;
+            i++;
+        } else if (i < tokens.size() && tokens[i] == "fen") {
+            for (i++; i < tokens.size() && tokens[i] != "moves"; ++i) {
+                if (!fen.empty()) fen += ' ';
+                fen += tokens[i];
+            }
+        } else {
+            return this->post("info string Expected 'startpos' or 'fen' after 'position'");
+        }
+
+        try {
+            this->_board.initialize(this->_white, this->_black, fen);
+            if (i < tokens.size() && tokens[i] == "moves") i++;
+            for (; i < tokens.size(); ++i) {
+                this->_board.move(Notation::LAN::parse(this->_board, tokens[i]));
+            }
+        } catch (const std::exception &error) {
+            this->post("info string " + std::string(error.what()));
+        }
+    }
+
+    void UCI::go(const std::vector<std::string_view> &tokens) {
+        this->stopSearch();
+
+        Search::Searcher::Limits limits;
+        std::int64_t times[2] = {0, 0}, increments[2] = {0, 0};
+        std::int64_t moveTime = 0;
+        int movesToGo = Search::Searcher::MOVES_TO_GO;
+        bool isPonder = false, isInfinite = false;
+        for (std::size_t i = 1; i < tokens.size(); ++i) {
+            auto token = tokens[i];
+            bool hasValue = i + 1 < tokens.size();
+            if (token == "infinite") {
+                isInfinite = true;
+            } else if (token == "ponder") {
+                isPonder = true;
+            } else if (!hasValue) {
+                break;
+            } else if (token == "depth") {
+                parseNumber(tokens[++i], limits.depth);
+            } else if (token == "nodes") {
+                parseNumber(tokens[++i], limits.nodes);
+            } else if (token == "movetime") {
+                parseNumber(tokens[++i], moveTime);
+            } else if (token == "wtime") {
+                parseNumber(tokens[++i], times[NNUE::Network::WHITE]);
+            } else if (token == "btime") {
+                parseNumber(tokens[++i], times[NNUE::Network::BLACK]);
+            } else if (token == "winc") {
+                parseNumber(tokens[++i], increments[NNUE::Network::WHITE]);
+            } else if (token == "binc") {
+                parseNumber(tokens[++i], increments[NNUE::Network::BLACK]);
+            } else if (token == "movestogo") {
+                parseNumber(tokens[++i], movesToGo);
+            }
+        }
+        limits.depth = std::clamp(limits.depth, 1, Search::MAX_PLY - 1);
+
+        std::int64_t time = moveTime;
+        int side = this->_board.color(this->_board.turn());
+        if (time == 0) {
+            time = Search::Searcher::allocate(std::chrono::milliseconds(times[side]),
+                                              std::chrono::milliseconds(increments[side]),
+                                              movesToGo)
+                       .count();
+        }
+        if (time > 0) {
+            time = std::max<std::int64_t>(time - MOVE_OVERHEAD.count(), 1);
+        }
+
+        if (this->_hasBook && !isPonder && !isInfinite) {
+            auto move = this->_book.best(this->_board);
+            if (Search::Heuristics::key(move) != Search::Heuristics::NO_MOVE) {
+                return this->post("bestmove " + Notation::LAN::format(move));
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(this->_searchMutex);
+            this->_isPondering = isPonder;
+            this->_isInfinite = isInfinite;
+            this->_isStopRequested = false;
+            this->_ponderTime = std::chrono::milliseconds(time);
+        }
+        if (!isPonder && !isInfinite) limits.time = std::chrono::milliseconds(time);
+
+        // Here rather than on the search thread, which would lose a "stop"
+        // or a "ponderhit" handled before it starts
+        if (this->_isMcts) {
+            this->_mcts.prepare(limits);
+        } else {
+            this->_searcher.prepare(limits);
+        }
+        this->_searchThread = std::thread([this, limits]() {
+            auto start = std::chrono::steady_clock::now();
+            auto listener = [this, start](const Search::Searcher::Result &result) {
+                auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                   std::chrono::steady_clock::now() - start)
+                                   .count();
+                auto nps = result.nodes * 1000 / std::max<std::uint64_t>(elapsed, 1);
+                this->post("info depth " + std::to_string(result.depth) + " score " +
+                           score(result.score) + " nodes " + std::to_string(result.nodes) +
+                           " nps " + std::to_string(nps) + " time " + std::to_string(elapsed) +
+                           " pv " + Notation::LAN::format(result.move));
+            };
+            auto result = this->_isMcts ? this->_mcts.search(this->_board, limits, listener)
+                                        : this->_searcher.search(this->_board, limits, listener);
+
+            // The GUI waits for "stop" or "ponderhit" before it expects the move
+            {
+                std::unique_lock<std::mutex> lock(this->_searchMutex);
+                this->_searchReleased.wait(lock, [this]() {
+                    return this->_isStopRequested || (!this->_isPondering && !this->_isInfinite);
+                });
+            }
+            if (Search::Heuristics::key(result.move) == Search::Heuristics::NO_MOVE) {
+                this->post("bestmove 0000");
+            } else {
+                this->post("bestmove " + Notation::LAN::format(result.move));
+            }
+        });
+    }
+
+    void UCI::ponderHit() {
+        std::chrono::milliseconds time;
+        {
+            std::lock_guard<std::mutex> lock(this->_searchMutex);
+            if (!this->_isPondering) return;
+
+            this->_isPondering = false;
+            time = this->_ponderTime;
+        }
+        if (time.count() > 0) {
+            this->_searcher.deadline(time);
+            this->_mcts.deadline(time);
+        }
+        this->_searchReleased.notify_all();
+    }
+
+    void UCI::stopSearch() {
+        if (!this->_searchThread.joinable()) return;
+
+        {
+            std::lock_guard<std::mutex> lock(this->_searchMutex);
+            this->_isStopRequested = true;
+        }
+        this->_searcher.stop();
+        this->_mcts.stop();
+        this->_searchReleased.notify_all();
+        this->_searchThread.join();
+    }
+
+    void UCI::finishSearch() {
+        if (!this->_searchThread.joinable()) return;
+
+        bool isFinite;
+        {
+            std::lock_guard<std::mutex> lock(this->_searchMutex);
+            isFinite = !this->_isPondering && !this->_isInfinite;
+        }
+        if (!isFinite) return this->stopSearch();
+
+        this->_searchThread.join();
+    }
+
+    void UCI::post(std::string line) {
+        {
+            std::lock_guard<std::mutex> lock(this->_outputMutex);
+            this->_lines.push_back(std::move(line));
+        }
+        this->_outputReady.notify_one();
+    }
+
+    void UCI::write() {
+        std::unique_lock<std::mutex> lock(this->_outputMutex);
+        while (true) {
+            this->_outputReady.wait(lock,
+                                    [this]() { return this->_isClosing || !this->_lines.empty(); });
+            if (this->_lines.empty()) return;
+
+            std::deque<std::string> lines;
+            lines.swap(this->_lines);
+            lock.unlock();
+            for (auto &line : lines) this->_out << line << '\n';
+            this->_out.flush();
+            lock.lock();
+        }
+    }
+
+    std::vector<std::string_view> UCI::split(std::string_view line) {
+        std::vector<std::string_view> tokens;
+        std::size_t i = 0;
+        while (i < line.size()) {
+            while (i < line.size() && std::isspace(static_cast<unsigned char>(line[i]))) ++i;
+            std::size_t start = i;
+            while (i < line.size() && !std::isspace(static_cast<unsigned char>(line[i]))) ++i;
+            if (i > start) tokens.push_back(line.substr(start, i - start));
+        }
+        return tokens;
+    }
+
+    std::string UCI::score(int score) {
+        if (score >= Search::MATE - Search::MAX_PLY) {
+            return "mate " + std::to_string((Search::MATE - score + 1) / 2);
+        }
+        if (score <= -Search::MATE + Search::MAX_PLY) {
+            return "mate " + std::to_string(-(Search::MATE + score) / 2);
+        }
+        return "cp " + std::to_string(score);
+    }
+} // namespace Controller
@@ -0,0 +1,98 @@
+#ifndef CONTROLLER_UCI_HPP
+#define CONTROLLER_UCI_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "model/book/book.hpp"
+#include "model/game/game.hpp"
+#include "model/mcts/mcts.hpp"
+#include "model/search/search.hpp"
+#include "model/tablebase/tablebase.hpp"
+
+namespace Controller {
+    /**
+     * @brief Universal Chess Interface over text streams
+     *    - Commands are read on the calling thread while the search runs on
+     *      a worker thread, so that "stop" and "ponderhit" are handled at once
+     *    - Output lines are queued and written by a writer thread: the
+     *      search never waits on the output stream
+     *    - At the end of the input a finite search is allowed to complete
+     */
+    class UCI {
+      public:
+        static constexpr std::string_view NAME = "Chess";
+        // Time kept for the GUI to receive the move
+        static constexpr std::chrono::milliseconds MOVE_OVERHEAD{10};
+
+        UCI(std::istream &in, std::ostream &out);
+        ~UCI();
+
+        /**
+         * @brief Read commands until "quit" or the end of the input
+         */
+        void start();
+
+      private:
+        std::istream &_in;
+        std::ostream &_out;
+
+        std::mutex _outputMutex;
+        std::condition_variable _outputReady;
+        std::deque<std::string> _lines;
+        bool _isClosing;
+        std::thread _writer;
+
+        Pieces::Player _white;
+        Pieces::Player _black;
+        Game::Board _board;
+        Search::Searcher _searcher;
+        // Used instead of _searcher when the UseMCTS option is set
+        MCTS::Searcher _mcts;
+        bool _isMcts;
+        Tablebase::Tablebases _tablebases;
+        Book::Polyglot _book;
+        bool _hasBook;
+
+        std::mutex _searchMutex;
+        std::condition_variable _searchReleased;
+        bool _isPondering;
+        bool _isInfinite;
+        bool _isStopRequested;
+        std::chrono::milliseconds _ponderTime;
+        std::thread _searchThread;
+
+        bool execute(std::string_view line);
+
+        void uci();
+        void setOption(const std::vector<std::string_view> &tokens);
+        void position(const std::vector<std::string_view> &tokens);
+        void go(const std::vector<std::string_view> &tokens);
+        void ponderHit();
+
+        /**
+         * @brief Stop the running search, if any, and wait for its bestmove
+         */
+        void stopSearch();
+        /**
+         * @brief Wait for a finite search, stop an infinite or pondering one
+         */
+        void finishSearch();
+
+        void post(std::string line);
+        void write();
+
+        static std::vector<std::string_view> split(std::string_view line);
+        static std::string score(int score);
+    };
+} // namespace Controller
+
+#endif // CONTROLLER_UCI_HPP
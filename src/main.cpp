@@ -1,6 +1,210 @@
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string_view>
+
 #include "controller/controller.hpp"
+#include "model/mate/mate.hpp"
+#include "model/puzzles/puzzles.hpp"
+#include "model/stress/stress.hpp"
+#include "model/suite/suite.hpp"
+#include "model/tuning/tuning.hpp"
+
+namespace {
+    /**
+     * @brief tune <positions> <output> [iterations]: positions are an archive
+     *        or a text file of labelled FENs
+     */
+    int tune(int argc, char *argv[]) {
+        if (argc < 4) {
+            std::cerr << "Usage: " << argv[0] << " tune <positions> <output> [iterations]"
+                      << std::endl;
+            return 1;
+        }
+        try {
+            Tuning::Dataset dataset;
+            try {
+                Archive::Reader archive(argv[2]);
+                dataset.load(archive);
+            } catch (const std::runtime_error &) {
+                dataset.load(std::string(argv[2]));
+            }
+            Tuning::Tuner::Options options;
+            if (argc > 4) options.maxIterations = std::stoi(argv[4]);
+            Tuning::Tuner tuner(dataset, options);
+            auto listener = [](int iteration, double loss) {
+                if (iteration % 100 == 1) {
+                    std::cerr << "iteration " << iteration << " loss " << loss << '\n';
+                }
+            };
+            auto parameters = tuner.tune(Search::Evaluation::parameters(), listener);
+            parameters.save(argv[3]);
+            std::cerr << dataset.size() << " positions, scale " << tuner.scale() << std::endl;
+        } catch (const std::exception &error) {
+            std::cerr << error.what() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief random [games] [threads] [seed]: random games to time the rules
+     */
+    int stress(int argc, char *argv[]) {
+        try {
+            Stress::Options options;
+            if (argc > 2) options.nGames = std::stoul(argv[2]);
+            if (argc > 3) options.nThreads = std::stoul(argv[3]);
+            if (argc > 4) options.seed = std::stoull(argv[4]);
+            auto stats = Stress::Generator(options).run();
+            std::cout << stats.nGames << " games, " << stats.nPlies << " plies in "
+                      << stats.elapsed.count() << " s\n"
+                      << stats.gamesPerSecond() << " games/s, " << stats.pliesPerSecond()
+                      << " plies/s, " << stats.averageLength() << " plies/game\n"
+                      << "1-0 " << stats.nWhiteWins << ", 0-1 " << stats.nBlackWins
+                      << ", stalemate " << stats.nStalemates << ", repetition "
+                      << stats.nRepetitions << ", fifty moves " << stats.nFiftyMoves
+                      << ", insufficient material " << stats.nInsufficientMaterial
+                      << ", unfinished " << stats.nUnfinished << std::endl;
+        } catch (const std::exception &error) {
+            std::cerr << error.what() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief mate <moves> <fen>: prove or disprove a mate in moves
+     */
+    int mate(int argc, char *argv[]) {
+        if (argc < 4) {
+            std::cerr << "Usage: " << argv[0] << " mate <moves> <fen>" << std::endl;
+            return 1;
+        }
+        try {
+            std::string fen = argv[3];
+            for (int i = 4; i < argc; ++i) fen += std::string(" ") + argv[i];
+            Mate::Solver solver;
+            auto result = solver.solve(fen, std::stoi(argv[2]));
+            if (result.verdict == Mate::Verdict::PROVEN) {
+                std::cout << "mate in " << result.moves << '\n'
+                          << Mate::Solver::format(result.solution);
+            } else {
+                std::cout << (result.verdict == Mate::Verdict::DISPROVEN ? "no mate" : "unknown")
+                          << '\n';
+            }
+            std::cout << result.nodes << " nodes, " << result.nodesPerSecond() << " nodes/s"
+                      << std::endl;
+        } catch (const std::exception &error) {
+            std::cerr << error.what() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief puzzles <archive> [output]: EPD puzzles found in the games
+     */
+    int puzzles(int argc, char *argv[]) {
+        if (argc < 3) {
+            std::cerr << "Usage: " << argv[0] << " puzzles <archive> [output]" << std::endl;
+            return 1;
+        }
+        try {
+            Archive::Reader reader(argv[2]);
+            std::ofstream file;
+            if (argc > 3) {
+                file.open(argv[3]);
+                if (!file) {
+                    std::cerr << "Cannot open the file: path='" << argv[3] << "'" << std::endl;
+                    return 1;
+                }
+            }
+            auto stats = Puzzles::Pipeline().run(reader, argc > 3 ? file : std::cout);
+            std::cerr << stats.nGames << " games, " << stats.nPositions << " positions, "
+                      << stats.nCandidates << " candidates, " << stats.nPuzzles << " puzzles"
+                      << std::endl;
+        } catch (const std::exception &error) {
+            std::cerr << error.what() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief analyze <positions|-> [depth] [nodes] [threads]: search every
+     *        FEN or EPD line of a file or stdin, results in input order
+     */
+    int analyze(int argc, char *argv[]) {
+        if (argc < 3) {
+            std::cerr << "Usage: " << argv[0] << " analyze <positions|-> [depth] [nodes] [threads]"
+                      << std::endl;
+            return 1;
+        }
+        try {
+            Suite::Options options;
+            if (argc > 3) options.depth = std::stoi(argv[3]);
+            if (argc > 4) options.nodes = std::stoull(argv[4]);
+            if (argc > 5) options.nThreads = std::stoul(argv[5]);
+
+            std::ios::sync_with_stdio(false);
+            std::ifstream file;
+            bool isStdin = std::string_view(argv[2]) == "-";
+            if (!isStdin) {
+                file.open(argv[2]);
+                if (!file) {
+                    std::cerr << "Cannot open the file: path='" << argv[2] << "'" << std::endl;
+                    return 1;
+                }
+            }
+            auto stats = Suite::Analyzer(options).run(isStdin ? std::cin : file, std::cout);
+            std::cerr << stats.nPositions << " positions, " << stats.nErrors << " errors, "
+                      << stats.nSolved << "/" << stats.nTests << " solved ("
+                      << 100 * stats.solveRate() << "%), " << stats.nodes << " nodes, "
+                      << stats.nodesPerSecond() << " nodes/s" << std::endl;
+        } catch (const std::exception &error) {
+            std::cerr << error.what() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+} // namespace
+
+int main(int argc, char *argv[]) {
+    if (std::filesystem::exists(Search::Parameters::PATH)) {
+        Search::Evaluation::parameters(Search::Parameters::load(Search::Parameters::PATH));
+    }
+
+    if (argc > 1 && std::string_view(argv[1]) == "tune") return tune(argc, argv);
+
+    if (argc > 1 && std::string_view(argv[1]) == "random") return stress(argc, argv);
+
+    if (argc > 1 && std::string_view(argv[1]) == "mate") return mate(argc, argv);
+
+    if (argc > 1 && std::string_view(argv[1]) == "puzzles") return puzzles(argc, argv);
+
+    if (argc > 1 && std::string_view(argv[1]) == "analyze") return analyze(argc, argv);
+
+    if (argc > 1 && std::string_view(argv[1]) == "uci") {
+        Controller::UCI controller(std::cin, std::cout);
+        controller.start();
+        return 0;
+    }
+
+    if (argc > 1 && std::string_view(argv[1]) == "batch") {
+        std::ios::sync_with_stdio(false);
+        Controller::CLI controller;
+        if (argc > 2) {
+            std::ifstream file(argv[2]);
+            if (!file) {
+                std::cerr << "Cannot open the file: path='" << argv[2] << "'" << std::endl;
+                return 1;
+            }
+            return controller.batch(file, std::cout) == 0 ? 0 : 1;
+        }
+        return controller.batch(std::cin, std::cout) == 0 ? 0 : 1;
+    }
 
-int main() {
     Controller::CLI controller;
     controller.start();
     return 0;
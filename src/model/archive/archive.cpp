@@ -0,0 +1,76 @@
+#include <algorithm>
+
+#include "model/archive/archive.hpp"
+
+namespace Archive {
+    namespace {
+        constexpr std::string_view RESULTS[] = {"*", "1-0", "0-1", "1/2-1/2"};
+    } // namespace
+
+    void appendVarint(std::string &out, std::uint64_t value) {
+        while (value >= 0x80) {
+            out += static_cast<char>((value & 0x7F) | 0x80);
+            value >>= 7;
+        }
+        out += static_cast<char>(value);
+    }
+
+    bool readVarint(const char *&cursor, const char *end, std::uint64_t &value) {
+        value = 0;
+        for (int shift = 0; cursor < end && shift < 64; shift += 7) {
+            auto byte = static_cast<std::uint8_t>(*cursor++);
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) return true;
+        }
+        return false;
+    }
+
+    std::uint8_t encodeResult(std::string_view result) {
+        for (std::uint8_t code = 0; code < std::size(RESULTS); ++code) {
+            if (RESULTS[code] == result) return code;
+        }
+        return 0;
+    }
+
+    std::string_view decodeResult(std::uint8_t code) {
+        return (code < std::size(RESULTS)) ? RESULTS[code] : RESULTS[0];
+    }
+
+    std::uint16_t encodeMove(Game::Board &board, const Pieces::Move &move) {
+        auto key = Book::encodeMove(move);
+        std::uint16_t rank = 0;
+        bool isLegal = false;
+        for (auto &legal : board.legalMoves()) {
+            auto legalKey = Book::encodeMove(legal);
+            rank += legalKey < key;
+            isLegal |= legalKey == key;
+        }
+        if (!isLegal) {
+            throw std::runtime_error("Archive move is not legal: key='" + std::to_string(key) +
+                                     "'");
+        }
+        return rank;
+    }
+
+    Pieces::Move decodeMove(Game::Board &board, std::uint16_t code) {
+        auto moves = board.legalMoves();
+        if (code >= moves.size()) {
+            throw std::runtime_error("Archive move is not legal: code='" + std::to_string(code) +
+                                     "'");
+        }
+        std::vector<std::uint16_t> keys;
+        keys.reserve(moves.size());
+        for (auto &move : moves) keys.push_back(Book::encodeMove(move));
+        auto sorted = keys;
+        std::nth_element(sorted.begin(), sorted.begin() + code, sorted.end());
+        auto found = std::find(keys.begin(), keys.end(), sorted[code]);
+        return moves[found - keys.begin()];
+    }
+
+    std::string_view Record::fen() const {
+        for (auto &[name, value] : this->tags) {
+            if (name == "FEN") return value;
+        }
+        return PGN::STANDARD_FEN;
+    }
+} // namespace Archive
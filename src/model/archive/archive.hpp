@@ -0,0 +1,157 @@
+#ifndef ARCHIVE_HPP
+#define ARCHIVE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "model/book/book.hpp"
+#include "model/game/game.hpp"
+#include "model/pgn/pgn.hpp"
+#include "model/utils/mapped_file.hpp"
+
+/**
+ * @brief Binary game archive
+ *    - "CHAR" magic and version, then the game records
+ *    - Record: varint size, tags, result byte, varint moves
+ *    - Each move is the rank of its Book::encodeMove() code among those of
+ *      the legal moves, one byte below 128; unlike an index in
+ *      Board::legalMoves() it doesn't depend on how the board was reused
+ *    - Block index: offset of every BLOCK_SIZE-th record, then the footer
+ *    - Footer: index offset and number of games as u64, then the magic again
+ *    - Integers are little-endian, varints are LEB128
+ */
+namespace Archive {
+    constexpr std::string_view MAGIC = "CHAR";
+    constexpr std::uint32_t VERSION = 2;
+    constexpr std::size_t BLOCK_SIZE = 256;
+
+    void appendVarint(std::string &out, std::uint64_t value);
+    /**
+     * @return false if the varint runs past end
+     */
+    bool readVarint(const char *&cursor, const char *end, std::uint64_t &value);
+
+    std::uint8_t encodeResult(std::string_view result);
+    std::string_view decodeResult(std::uint8_t code);
+
+    /**
+     * @brief Code of a legal move of the board as stored in a record
+     * @throw std::runtime_error if the move is not legal
+     */
+    std::uint16_t encodeMove(Game::Board &board, const Pieces::Move &move);
+    /**
+     * @throw std::runtime_error if the code is not the one of a legal move
+     */
+    Pieces::Move decodeMove(Game::Board &board, std::uint16_t code);
+
+    /**
+     * @brief One game, the views point into the archive or the PGN text
+     *    - A "FEN" tag gives the starting position, the standard one otherwise
+     */
+    struct Record {
+        std::vector<std::pair<std::string_view, std::string_view>> tags;
+        std::string_view result = "*";
+        std::vector<std::uint16_t> moves;
+
+        std::string_view fen() const;
+    };
+
+    class Writer {
+      public:
+        Writer();
+        explicit Writer(const std::string &path);
+        ~Writer();
+
+        Writer(const Writer &other) = delete;
+        Writer &operator=(const Writer &other) = delete;
+
+        /**
+         * @throw std::runtime_error if the file cannot be created
+         */
+        void open(const std::string &path);
+        void write(const Record &record);
+        /**
+         * @brief Write the block index and the footer
+         */
+        void close();
+
+        std::size_t size() const;
+
+      private:
+        std::ofstream _file;
+        std::string _path;
+        std::string _buffer;
+        std::vector<std::uint64_t> _blocks;
+        std::uint64_t _offset;
+        std::size_t _nGames;
+    };
+
+    class Reader {
+      public:
+        Reader();
+        explicit Reader(const std::string &path);
+
+        /**
+         * @throw std::runtime_error if the file is not a valid archive
+         */
+        void open(const std::string &path);
+
+        std::size_t size() const;
+        /**
+         * @throw std::runtime_error if the index is out of range or the record is corrupted
+         */
+        Record record(std::size_t index) const;
+
+        /**
+         * @brief Play the moves of the record on the board
+         * @throw std::runtime_error if a move is not legal
+         */
+        static void replay(const Record &record, Game::Board &board, Pieces::Player &first,
+                           Pieces::Player &second);
+        /**
+         * @brief Replay a game through a PGN visitor, moves are given in SAN
+         */
+        void replay(std::size_t index, PGN::Visitor &visitor) const;
+
+      private:
+        Utils::MappedFile _file;
+        std::vector<std::uint64_t> _blocks;
+        std::size_t _nGames;
+
+        std::runtime_error invalid(const std::string &reason) const;
+    };
+
+    /**
+     * @brief PGN visitor storing every valid game into a Writer
+     *    - Games with an error are skipped and counted
+     */
+    class Importer : public PGN::Visitor {
+      public:
+        explicit Importer(Writer &writer);
+
+        void begin() override;
+        void tag(std::string_view name, std::string_view value) override;
+        void move(std::string_view san, const Pieces::Move &move,
+                  const Game::Board &board) override;
+        void end(std::string_view result) override;
+        void error(const std::string &message) override;
+
+        std::size_t nErrors() const;
+
+      private:
+        Writer &_writer;
+        Record _record;
+        Game::Board _board;
+        Pieces::Player _first;
+        Pieces::Player _second;
+        bool _isValid;
+        std::size_t _nErrors;
+    };
+} // namespace Archive
+
+#endif // ARCHIVE_HPP
@@ -0,0 +1,51 @@
+#include "model/archive/archive.hpp"
+
+namespace Archive {
+    Importer::Importer(Writer &writer)
+        : _writer(writer)
+        , _record()
+        , _board(8, 8)
+        , _first("White")
+        , _second("Black")
+        , _isValid(true)
+        , _nErrors(0) {}
+
+    void Importer::begin() {
+        this->_record = Record();
+        this->_isValid = true;
+    }
+
+    void Importer::tag(std::string_view name, std::string_view value) {
+        this->_record.tags.emplace_back(name, value);
+    }
+
+    void Importer::move(std::string_view san, const Pieces::Move &move,
+                        const Game::Board & /*board*/) {
+        if (!this->_isValid) return;
+
+        // The PGN board already played the move, its twin gives the code
+        if (this->_record.moves.empty()) {
+            this->_board.initialize(this->_first, this->_second, this->_record.fen());
+        }
+        try {
+            this->_record.moves.push_back(encodeMove(this->_board, move));
+            this->_board.move(decodeMove(this->_board, this->_record.moves.back()));
+        } catch (const std::runtime_error &) {
+            this->error("Move not found in the archive board: san='" + std::string(san) + "'");
+        }
+    }
+
+    void Importer::end(std::string_view result) {
+        if (!this->_isValid) return;
+
+        this->_record.result = result;
+        this->_writer.write(this->_record);
+    }
+
+    void Importer::error(const std::string & /*message*/) {
+        if (this->_isValid) this->_nErrors++;
+        this->_isValid = false;
+    }
+
+    std::size_t Importer::nErrors() const { return this->_nErrors; }
+} // namespace Archive
@@ -0,0 +1,154 @@
+#include "model/archive/archive.hpp"
+#include "model/notation/notation.hpp"
+
+namespace Archive {
+    namespace {
+        constexpr std::size_t HEADER_SIZE = 8;
+        constexpr std::size_t FOOTER_SIZE = 20;
+
+        std::uint64_t readFixed(const char *data, int nBytes) {
+            std::uint64_t value = 0;
+            for (int i = 0; i < nBytes; ++i) {
+                value |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[i])) << (8 * i);
+            }
+            return value;
+        }
+
+        bool readString(const char *&cursor, const char *end, std::string_view &value) {
+            std::uint64_t size = 0;
+            if (!readVarint(cursor, end, size) || size > static_cast<std::uint64_t>(end - cursor)) {
+                return false;
+            }
+            value = std::string_view(cursor, size);
+            cursor += size;
+            return true;
+        }
+    } // namespace
+
+    Reader::Reader()
+        : _file()
+        , _blocks()
+        , _nGames(0) {}
+
+    Reader::Reader(const std::string &path)
+        : Reader() {
+        this->open(path);
+    }
+
+    void Reader::open(const std::string &path) {
+        this->_file.open(path);
+        this->_blocks.clear();
+        this->_nGames = 0;
+
+        const char *data = this->_file.data();
+        std::size_t size = this->_file.size();
+        if (size < HEADER_SIZE + FOOTER_SIZE || std::string_view(data, 4) != MAGIC ||
+            std::string_view(data + size - 4, 4) != MAGIC) {
+            throw this->invalid("magic");
+        }
+        if (readFixed(data + 4, 4) != VERSION) throw this->invalid("version");
+
+        std::uint64_t indexOffset = readFixed(data + size - FOOTER_SIZE, 8);
+        std::uint64_t nGames = readFixed(data + size - FOOTER_SIZE + 8, 8);
+        if (indexOffset < HEADER_SIZE || indexOffset > size - FOOTER_SIZE ||
+            (size - FOOTER_SIZE - indexOffset) % 8 != 0) {
+            throw this->invalid("index");
+        }
+        // Every block but the last one is full, a corrupted count must not pass
+        std::uint64_t nBlocks = (size - FOOTER_SIZE - indexOffset) / 8;
+        if (nGames > nBlocks * BLOCK_SIZE ||
+            (nBlocks > 0 && nGames <= (nBlocks - 1) * BLOCK_SIZE)) {
+            throw this->invalid("index");
+        }
+        this->_blocks.resize(nBlocks);
+        for (std::uint64_t i = 0; i < nBlocks; ++i) {
+            this->_blocks[i] = readFixed(data + indexOffset + 8 * i, 8);
+            if (this->_blocks[i] < HEADER_SIZE || this->_blocks[i] >= indexOffset) {
+                throw this->invalid("index");
+            }
+        }
+        this->_nGames = nGames;
+    }
+
+    std::size_t Reader::size() const { return this->_nGames; }
+
+    Record Reader::record(std::size_t index) const {
+        if (index >= this->_nGames) {
+            throw std::runtime_error("Archive game out of range: index='" + std::to_string(index) +
+                                     "'");
+        }
+        const char *data = this->_file.data();
+        const char *end = data + this->_file.size() - FOOTER_SIZE - 8 * this->_blocks.size();
+        const char *cursor = data + this->_blocks[index / BLOCK_SIZE];
+        std::uint64_t recordSize = 0;
+        for (std::size_t i = 0; i < index % BLOCK_SIZE; ++i) {
+            if (!readVarint(cursor, end, recordSize) ||
+                recordSize > static_cast<std::uint64_t>(end - cursor)) {
+                throw this->invalid("record");
+            }
+            cursor += recordSize;
+        }
+        if (!readVarint(cursor, end, recordSize) ||
+            recordSize > static_cast<std::uint64_t>(end - cursor)) {
+            throw this->invalid("record");
+        }
+        end = cursor + recordSize;
+
+        Record record;
+        std::uint64_t nTags = 0, nMoves = 0, move = 0;
+        if (!readVarint(cursor, end, nTags) || nTags > recordSize) throw this->invalid("record");
+
+        record.tags.resize(nTags);
+        for (auto &[name, value] : record.tags) {
+            if (!readString(cursor, end, name) || !readString(cursor, end, value)) {
+                throw this->invalid("record");
+            }
+        }
+        if (cursor >= end) throw this->invalid("record");
+
+        record.result = decodeResult(static_cast<std::uint8_t>(*cursor++));
+        if (!readVarint(cursor, end, nMoves) || nMoves > recordSize) throw this->invalid("record");
+
+        record.moves.resize(nMoves);
+        for (auto &code : record.moves) {
+            if (!readVarint(cursor, end, move) || move > UINT16_MAX) throw this->invalid("record");
+
+            code = static_cast<std::uint16_t>(move);
+        }
+        return record;
+    }
+
+    void Reader::replay(const Record &record, Game::Board &board, Pieces::Player &first,
+                        Pieces::Player &second) {
+        board.initialize(first, second, record.fen());
+        for (auto code : record.moves) board.move(decodeMove(board, code));
+    }
+
+    void Reader::replay(std::size_t index, PGN::Visitor &visitor) const {
+        auto record = this->record(index);
+        Pieces::Player first("White"), second("Black");
+        Game::Board board(8, 8);
+        visitor.begin();
+        for (auto &[name, value] : record.tags) visitor.tag(name, value);
+
+        board.initialize(first, second, record.fen());
+        for (auto code : record.moves) {
+            Pieces::Move move;
+            try {
+                move = decodeMove(board, code);
+            } catch (const std::runtime_error &error) {
+                visitor.error(error.what());
+                break;
+            }
+            auto san = Notation::SAN::format(board, move);
+            board.move(move);
+            visitor.move(san, move, board);
+        }
+        visitor.end(record.result);
+    }
+
+    std::runtime_error Reader::invalid(const std::string &reason) const {
+        return std::runtime_error("Invalid archive " + reason + ": path='" + this->_file.path() +
+                                  "'");
+    }
+} // namespace Archive
@@ -0,0 +1,93 @@
+#include "model/archive/archive.hpp"
+
+namespace Archive {
+    namespace {
+        void appendFixed(std::string &out, std::uint64_t value, int nBytes) {
+            for (int i = 0; i < nBytes; ++i) {
+                out += static_cast<char>((value >> (8 * i)) & 0xFF);
+            }
+        }
+
+        void appendString(std::string &out, std::string_view value) {
+            appendVarint(out, value.size());
+            out.append(value);
+        }
+    } // namespace
+
+    Writer::Writer()
+        : _file()
+        , _path()
+        , _buffer()
+        , _blocks()
+        , _offset(0)
+        , _nGames(0) {}
+
+    Writer::Writer(const std::string &path)
+        : Writer() {
+        this->open(path);
+    }
+
+    Writer::~Writer() {
+        try {
+            this->close();
+        } catch (const std::exception &) {
+            // Destructors must not throw, close() explicitly to see the error
+        }
+    }
+
+    void Writer::open(const std::string &path) {
+        this->close();
+        this->_file.open(path, std::ios::binary | std::ios::trunc);
+        if (!this->_file) throw std::runtime_error("Cannot create archive: path='" + path + "'");
+
+        this->_path = path;
+        this->_blocks.clear();
+        this->_nGames = 0;
+        std::string header(MAGIC);
+        appendFixed(header, VERSION, 4);
+        this->_file.write(header.data(), static_cast<std::streamsize>(header.size()));
+        this->_offset = header.size();
+    }
+
+    void Writer::write(const Record &record) {
+        if (!this->_file.is_open()) throw std::runtime_error("Archive is not open");
+
+        if (this->_nGames % BLOCK_SIZE == 0) this->_blocks.push_back(this->_offset);
+
+        std::string body;
+        body.reserve(64 + record.moves.size());
+        appendVarint(body, record.tags.size());
+        for (auto &[name, value] : record.tags) {
+            appendString(body, name);
+            appendString(body, value);
+        }
+        body += static_cast<char>(encodeResult(record.result));
+        appendVarint(body, record.moves.size());
+        for (auto move : record.moves) appendVarint(body, move);
+
+        this->_buffer.clear();
+        appendVarint(this->_buffer, body.size());
+        this->_buffer += body;
+        this->_file.write(this->_buffer.data(), static_cast<std::streamsize>(this->_buffer.size()));
+        if (!this->_file) throw std::runtime_error("Cannot write archive: path='" + this->_path + "'");
+
+        this->_offset += this->_buffer.size();
+        this->_nGames++;
+    }
+
+    void Writer::close() {
+        if (!this->_file.is_open()) return;
+
+        std::string footer;
+        footer.reserve(8 * this->_blocks.size() + 20);
+        for (auto offset : this->_blocks) appendFixed(footer, offset, 8);
+        appendFixed(footer, this->_offset, 8);
+        appendFixed(footer, this->_nGames, 8);
+        footer.append(MAGIC);
+        this->_file.write(footer.data(), static_cast<std::streamsize>(footer.size()));
+        this->_file.close();
+        if (!this->_file) throw std::runtime_error("Cannot write archive: path='" + this->_path + "'");
+    }
+
+    std::size_t Writer::size() const { return this->_nGames; }
+} // namespace Archive
@@ -0,0 +1,91 @@
+#ifndef BOOK_HPP
+#define BOOK_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "model/game/game.hpp"
+#include "model/utils/mapped_file.hpp"
+
+/**
+ * @brief Polyglot opening books
+ *    - A book is a sorted array of 16 bytes big-endian entries:
+ *      key u64, move u16, weight u16, learn u32
+ *    - Moves are encoded as to file, to row, from file, from row on 3 bits
+ *      each, then the promotion (none, knight, bishop, rook, queen)
+ *    - Castling is written as the King taking its own Rook ("e1h1")
+ */
+namespace Book {
+    constexpr std::size_t N_KEYS = 781;
+
+    /**
+     * @brief Random numbers of the key, in Polyglot order
+     *    - 768 piece keys (64 * kind + 8 * row + file, kind being
+     *      2 * (pawn, knight, bishop, rook, queen, king) + 1 for white)
+     *    - 4 castling keys (K, Q, k, q), 8 en passant keys, the white turn key
+     *    - The default table is Polyglot's published Random64 array, so that
+     *      books made by other tools can be probed
+     */
+    using Keys = std::array<std::uint64_t, N_KEYS>;
+
+    const Keys &keys();
+    void keys(const Keys &keys);
+
+    /**
+     * @brief Polyglot key of the position, the first Player being white
+     */
+    std::uint64_t key(const Game::Board &board);
+
+    std::uint16_t encodeMove(const Pieces::Move &move);
+
+    struct Entry {
+        std::uint64_t key;
+        std::uint16_t move;
+        std::uint16_t weight;
+        std::uint32_t learn;
+    };
+
+    class Polyglot {
+      public:
+        Polyglot();
+        explicit Polyglot(const std::string &path);
+
+        /**
+         * @throw std::runtime_error if the file is not a whole number of entries
+         */
+        void open(const std::string &path);
+
+        std::size_t size() const;
+        Entry entry(std::size_t index) const;
+        std::vector<Entry> probe(std::uint64_t key) const;
+
+        /**
+         * @brief Legal moves of the book for the position with their weight
+         */
+        std::vector<std::pair<Pieces::Move, std::uint16_t>> moves(Game::Board &board) const;
+        /**
+         * @return the move of highest weight, Move() if the position is not in the book
+         */
+        Pieces::Move best(Game::Board &board) const;
+        /**
+         * @return a move drawn with a probability proportional to its weight,
+         *         Move() if the position is not in the book
+         */
+        Pieces::Move random(Game::Board &board, std::mt19937_64 &generator) const;
+
+        /**
+         * @brief Sort the entries by key and write them as a book
+         */
+        static void write(const std::string &path, std::vector<Entry> entries);
+
+      private:
+        Utils::MappedFile _file;
+    };
+} // namespace Book
+
+#endif // BOOK_HPP
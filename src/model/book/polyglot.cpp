@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <fstream>
+
+#include "model/book/book.hpp"
+
+namespace Book {
+    namespace {
+        constexpr std::size_t ENTRY_SIZE = 16;
+
+        std::uint64_t readBigEndian(const char *data, int nBytes) {
+            std::uint64_t value = 0;
+            for (int i = 0; i < nBytes; ++i) {
+                value = (value << 8) | static_cast<std::uint8_t>(data[i]);
+            }
+            return value;
+        }
+
+        void appendBigEndian(std::string &out, std::uint64_t value, int nBytes) {
+            for (int i = nBytes - 1; i >= 0; --i) {
+                out += static_cast<char>((value >> (8 * i)) & 0xFF);
+            }
+        }
+    } // namespace
+
+    Polyglot::Polyglot()
+        : _file() {}
+
+    Polyglot::Polyglot(const std::string &path)
+        : Polyglot() {
+        this->open(path);
+    }
+
+    void Polyglot::open(const std::string &path) {
+        this->_file.open(path);
+        if (this->_file.size() % ENTRY_SIZE != 0) {
+            this->_file.close();
+            throw std::runtime_error("Invalid Polyglot book size: path='" + path + "'");
+        }
+    }
+
+    std::size_t Polyglot::size() const { return this->_file.size() / ENTRY_SIZE; }
+
+    Entry Polyglot::entry(std::size_t index) const {
+        const char *data = this->_file.data() + index * ENTRY_SIZE;
+        return {readBigEndian(data, 8), static_cast<std::uint16_t>(readBigEndian(data + 8, 2)),
+                static_cast<std::uint16_t>(readBigEndian(data + 10, 2)),
+                static_cast<std::uint32_t>(readBigEndian(data + 12, 4))};
+    }
+
+    std::vector<Entry> Polyglot::probe(std::uint64_t key) const {
+        std::size_t low = 0, high = this->size();
+        while (low < high) {
+            std::size_t middle = low + (high - low) / 2;
+            if (readBigEndian(this->_file.data() + middle * ENTRY_SIZE, 8) < key) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+
+        std::vector<Entry> entries;
+        for (std::size_t i = low; i < this->size(); ++i) {
+            auto entry = this->entry(i);
+            if (entry.key != key) break;
+
+            entries.push_back(entry);
+        }
+        return entries;
+    }
+
+    std::vector<std::pair<Pieces::Move, std::uint16_t>> Polyglot::moves(Game::Board &board) const {
+        std::vector<std::pair<Pieces::Move, std::uint16_t>> moves;
+        auto entries = this->probe(key(board));
+        if (entries.empty()) return moves;
+
+        auto legalMoves = board.legalMoves();
+        for (auto &entry : entries) {
+            for (auto &move : legalMoves) {
+                if (encodeMove(move) != entry.move) continue;
+
+                moves.emplace_back(move, entry.weight);
+                break;
+            }
+        }
+        return moves;
+    }
+
+    Pieces::Move Polyglot::best(Game::Board &board) const {
+        auto moves = this->moves(board);
+        auto best = std::max_element(moves.begin(), moves.end(), [](auto &a, auto &b) {
+            return a.second < b.second;
+        });
+        return (best == moves.end()) ? Pieces::Move() : best->first;
+    }
+
+    Pieces::Move Polyglot::random(Game::Board &board, std::mt19937_64 &generator) const {
+        auto moves = this->moves(board);
+        std::uint64_t total = 0;
+        for (auto &[move, weight] : moves) total += weight;
+        if (moves.empty()) return Pieces::Move();
+
+        if (total == 0) return moves[generator() % moves.size()].first;
+
+        std::uint64_t pick = std::uniform_int_distribution<std::uint64_t>(0, total - 1)(generator);
+        for (auto &[move, weight] : moves) {
+            if (pick < weight) return move;
+
+            pick -= weight;
+        }
+        return moves.back().first;
+    }
+
+    void Polyglot::write(const std::string &path, std::vector<Entry> entries) {
+        std::stable_sort(entries.begin(), entries.end(),
+                         [](const Entry &a, const Entry &b) { return a.key < b.key; });
+        std::string out;
+        out.reserve(entries.size() * ENTRY_SIZE);
+        for (auto &entry : entries) {
+            appendBigEndian(out, entry.key, 8);
+            appendBigEndian(out, entry.move, 2);
+            appendBigEndian(out, entry.weight, 2);
+            appendBigEndian(out, entry.learn, 4);
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(out.data(), static_cast<std::streamsize>(out.size()));
+        if (!file) throw std::runtime_error("Cannot write Polyglot book: path='" + path + "'");
+    }
+} // namespace Book
@@ -0,0 +1,209 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+#include "model/explorer/explorer.hpp"
+
+namespace Explorer {
+    namespace {
+        constexpr std::size_t GAMES_PER_TASK = 64;
+        constexpr std::size_t BUFFER_SIZE = 4096;
+
+        struct Run {
+            std::string path;
+            std::uint64_t size;
+        };
+
+        void writeEntries(std::ofstream &file, const Entry *entries, std::size_t size,
+                          const std::string &path) {
+            file.write(reinterpret_cast<const char *>(entries),
+                       static_cast<std::streamsize>(size * sizeof(Entry)));
+            if (!file) throw std::runtime_error("Cannot write index: path='" + path + "'");
+        }
+
+        /**
+         * @brief Buffered sequential reader of a sorted run
+         */
+        class RunReader {
+          public:
+            explicit RunReader(const Run &run)
+                : _file(run.path, std::ios::binary)
+                , _buffer()
+                , _cursor(0)
+                , _remaining(run.size) {
+                if (!this->_file) throw std::runtime_error("Cannot open run: path='" + run.path + "'");
+
+                this->refill();
+            }
+
+            bool isDone() const { return this->_cursor == this->_buffer.size(); }
+
+            const Entry &entry() const { return this->_buffer[this->_cursor]; }
+
+            void next() {
+                if (++this->_cursor == this->_buffer.size()) this->refill();
+            }
+
+          private:
+            std::ifstream _file;
+            std::vector<Entry> _buffer;
+            std::size_t _cursor;
+            std::uint64_t _remaining;
+
+            void refill() {
+                auto size = static_cast<std::size_t>(
+                    std::min<std::uint64_t>(this->_remaining, BUFFER_SIZE));
+                this->_buffer.resize(size);
+                this->_file.read(reinterpret_cast<char *>(this->_buffer.data()),
+                                 static_cast<std::streamsize>(size * sizeof(Entry)));
+                if (!this->_file) throw std::runtime_error("Cannot read run");
+
+                this->_remaining -= size;
+                this->_cursor = 0;
+            }
+        };
+
+        std::uint64_t merge(const std::vector<Run> &runs, const std::string &path) {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            if (!file) throw std::runtime_error("Cannot create index: path='" + path + "'");
+
+            std::uint64_t size = 0;
+            for (auto &run : runs) size += run.size;
+            file.write(MAGIC.data(), static_cast<std::streamsize>(MAGIC.size()));
+            file.write(reinterpret_cast<const char *>(&VERSION), sizeof(VERSION));
+            file.write(reinterpret_cast<const char *>(&size), sizeof(size));
+
+            std::vector<RunReader> readers;
+            readers.reserve(runs.size());
+            for (auto &run : runs) readers.emplace_back(run);
+
+            auto isAfter = [&readers](std::size_t a, std::size_t b) {
+                return readers[b].entry() < readers[a].entry();
+            };
+            std::priority_queue<std::size_t, std::vector<std::size_t>, decltype(isAfter)> heap(
+                isAfter);
+            for (std::size_t i = 0; i < readers.size(); ++i) {
+                if (!readers[i].isDone()) heap.push(i);
+            }
+
+            std::vector<Entry> buffer;
+            buffer.reserve(BUFFER_SIZE);
+            while (!heap.empty()) {
+                std::size_t i = heap.top();
+                heap.pop();
+                buffer.push_back(readers[i].entry());
+                if (buffer.size() == BUFFER_SIZE) {
+                    writeEntries(file, buffer.data(), buffer.size(), path);
+                    buffer.clear();
+                }
+                readers[i].next();
+                if (!readers[i].isDone()) heap.push(i);
+            }
+            writeEntries(file, buffer.data(), buffer.size(), path);
+            file.close();
+            if (!file) throw std::runtime_error("Cannot write index: path='" + path + "'");
+
+            return size;
+        }
+    } // namespace
+
+    bool Entry::operator<(const Entry &other) const {
+        if (this->key != other.key) return this->key < other.key;
+
+        if (this->game != other.game) return this->game < other.game;
+
+        return this->move < other.move;
+    }
+
+    Builder::Builder()
+        : Builder(Options()) {}
+
+    Builder::Builder(Options options)
+        : _options(std::move(options)) {}
+
+    std::uint64_t Builder::build(const Archive::Reader &archive, const std::string &path) const {
+        std::size_t nThreads = this->_options.nThreads;
+        if (nThreads == 0) nThreads = std::max(1U, std::thread::hardware_concurrency());
+        std::size_t runSize = std::max<std::size_t>(this->_options.runSize / nThreads, 1);
+        std::filesystem::path directory = this->_options.directory.empty()
+                                              ? std::filesystem::temp_directory_path()
+                                              : std::filesystem::path(this->_options.directory);
+        std::string prefix = std::filesystem::path(path).filename().string();
+
+        std::atomic<std::size_t> next{0};
+        std::mutex mutex;
+        std::vector<Run> runs;
+        std::exception_ptr failure;
+        auto worker = [&](std::size_t id) {
+            try {
+                Game::Board board(8, 8);
+                Pieces::Player first("White"), second("Black");
+                std::vector<Entry> entries;
+                entries.reserve(runSize);
+                int nRuns = 0;
+                auto spill = [&]() {
+                    if (entries.empty()) return;
+
+                    std::sort(entries.begin(), entries.end());
+                    auto runPath = (directory / (prefix + "." + std::to_string(id) + "." +
+                                                 std::to_string(nRuns++) + ".run"))
+                                       .string();
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        runs.push_back({runPath, entries.size()});
+                    }
+                    std::ofstream file(runPath, std::ios::binary | std::ios::trunc);
+                    writeEntries(file, entries.data(), entries.size(), runPath);
+                    entries.clear();
+                };
+                auto add = [&](const Entry &entry) {
+                    entries.push_back(entry);
+                    if (entries.size() >= runSize) spill();
+                };
+
+                std::size_t start;
+                while ((start = next.fetch_add(GAMES_PER_TASK)) < archive.size()) {
+                    std::size_t end = std::min(start + GAMES_PER_TASK, archive.size());
+                    for (std::size_t game = start; game < end; ++game) {
+                        auto record = archive.record(game);
+                        auto result = Archive::encodeResult(record.result);
+                        auto index = static_cast<std::uint32_t>(game);
+                        board.initialize(first, second, record.fen());
+                        for (auto code : record.moves) {
+                            auto move = Archive::decodeMove(board, code);
+                            add({board.hash(), index, Book::encodeMove(move), result, 0});
+                            board.move(move);
+                        }
+                        add({board.hash(), index, NO_MOVE, result, 0});
+                    }
+                }
+                spill();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!failure) failure = std::current_exception();
+                next = archive.size();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(nThreads);
+        for (std::size_t id = 0; id < nThreads; ++id) threads.emplace_back(worker, id);
+        for (auto &thread : threads) thread.join();
+
+        std::uint64_t size = 0;
+        try {
+            if (failure) std::rethrow_exception(failure);
+
+            size = merge(runs, path);
+        } catch (...) {
+            for (auto &run : runs) std::filesystem::remove(run.path);
+            throw;
+        }
+        for (auto &run : runs) std::filesystem::remove(run.path);
+        return size;
+    }
+} // namespace Explorer
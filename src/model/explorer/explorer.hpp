@@ -0,0 +1,120 @@
+#ifndef EXPLORER_HPP
+#define EXPLORER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "model/archive/archive.hpp"
+#include "model/book/book.hpp"
+#include "model/utils/mapped_file.hpp"
+
+/**
+ * @brief Opening explorer over a game archive
+ *    - The index file is "CHPX", version u32, number of entries u64, then
+ *      the entries sorted by key and game, in host byte order
+ *    - One entry per position reached by a game, with the move played from it
+ *      as its Book::encodeMove() code, which doesn't depend on the order of
+ *      the legal moves and so is the same for every transposition
+ */
+namespace Explorer {
+    constexpr std::string_view MAGIC = "CHPX";
+    constexpr std::uint32_t VERSION = 2;
+    constexpr std::uint16_t NO_MOVE = 0xFFFF;
+
+    struct Entry {
+        std::uint64_t key;
+        std::uint32_t game;
+        std::uint16_t move;
+        std::uint8_t result;
+        std::uint8_t padding;
+
+        bool operator<(const Entry &other) const;
+    };
+    static_assert(sizeof(Entry) == 16, "Index entries are written as raw 16 bytes records");
+
+    /**
+     * @brief Number of games by Archive result code (*, 1-0, 0-1, 1/2-1/2)
+     */
+    using Counts = std::array<std::uint32_t, 4>;
+
+    struct Stats {
+        struct Move {
+            // Book::encodeMove() code
+            std::uint16_t code;
+            /**
+             * @brief Filled by Game::Game::explore()
+             */
+            std::string san;
+            Counts counts;
+        };
+
+        Counts counts{};
+        /**
+         * @brief Moves played from the position, most played first
+         */
+        std::vector<Move> moves;
+        /**
+         * @brief Archive indexes of the games, each listed once
+         */
+        std::vector<std::uint32_t> games;
+
+        std::uint32_t nGames() const;
+    };
+
+    /**
+     * @brief Legal move of the board with the given code
+     * @return false if there is none
+     */
+    bool decodeMove(Game::Board &board, std::uint16_t code, Pieces::Move &move);
+
+    /**
+     * @brief Parallel external sort of the positions of an archive
+     *    - Workers replay games and spill sorted runs of at most runSize
+     *      entries each to the temporary directory
+     *    - The runs are then merged into the index and removed
+     */
+    class Builder {
+      public:
+        struct Options {
+            std::size_t nThreads = 0;
+            std::size_t runSize = 1 << 20;
+            std::string directory;
+        };
+
+        Builder();
+        explicit Builder(Options options);
+
+        /**
+         * @return the number of entries written
+         * @throw std::runtime_error if a game cannot be replayed or a file cannot be written
+         */
+        std::uint64_t build(const Archive::Reader &archive, const std::string &path) const;
+
+      private:
+        Options _options;
+    };
+
+    class Index {
+      public:
+        Index();
+        explicit Index(const std::string &path);
+
+        /**
+         * @throw std::runtime_error if the file is not a valid index
+         */
+        void open(const std::string &path);
+
+        std::uint64_t size() const;
+        Stats query(std::uint64_t key) const;
+
+      private:
+        Utils::MappedFile _file;
+        const Entry *_entries;
+        std::uint64_t _size;
+    };
+} // namespace Explorer
+
+#endif // EXPLORER_HPP
@@ -0,0 +1,97 @@
+#include <algorithm>
+
+#include "model/explorer/explorer.hpp"
+
+namespace Explorer {
+    namespace {
+        constexpr std::size_t HEADER_SIZE = 16;
+
+        std::uint32_t total(const Counts &counts) {
+            std::uint32_t sum = 0;
+            for (auto count : counts) sum += count;
+            return sum;
+        }
+    } // namespace
+
+    std::uint32_t Stats::nGames() const { return total(this->counts); }
+
+    bool decodeMove(Game::Board &board, std::uint16_t code, Pieces::Move &move) {
+        for (auto &legal : board.legalMoves()) {
+            if (Book::encodeMove(legal) != code) continue;
+
+            move = legal;
+            return true;
+        }
+        return false;
+    }
+
+    Index::Index()
+        : _file()
+        , _entries(nullptr)
+        , _size(0) {}
+
+    Index::Index(const std::string &path)
+        : Index() {
+        this->open(path);
+    }
+
+    void Index::open(const std::string &path) {
+        this->_file.open(path);
+        this->_entries = nullptr;
+        this->_size = 0;
+
+        const char *data = this->_file.data();
+        std::size_t size = this->_file.size();
+        if (size < HEADER_SIZE || std::string_view(data, 4) != MAGIC) {
+            throw std::runtime_error("Invalid index magic: path='" + path + "'");
+        }
+        std::uint32_t version = 0;
+        std::uint64_t nEntries = 0;
+        std::copy_n(data + 4, sizeof(version), reinterpret_cast<char *>(&version));
+        std::copy_n(data + 8, sizeof(nEntries), reinterpret_cast<char *>(&nEntries));
+        if (version != VERSION) throw std::runtime_error("Invalid index version: path='" + path + "'");
+
+        if (nEntries != (size - HEADER_SIZE) / sizeof(Entry) ||
+            (size - HEADER_SIZE) % sizeof(Entry) != 0) {
+            throw std::runtime_error("Invalid index size: path='" + path + "'");
+        }
+        // mmap returns page aligned memory and the header keeps the entries 16 bytes aligned
+        this->_entries = reinterpret_cast<const Entry *>(data + HEADER_SIZE);
+        this->_size = nEntries;
+    }
+
+    std::uint64_t Index::size() const { return this->_size; }
+
+    Stats Index::query(std::uint64_t key) const {
+        Stats stats;
+        if (this->_size == 0) return stats;
+
+        const Entry *end = this->_entries + this->_size;
+        const Entry *entry = std::lower_bound(
+            this->_entries, end, key, [](const Entry &e, std::uint64_t k) { return e.key < k; });
+        std::uint32_t lastGame = 0;
+        for (; entry != end && entry->key == key; ++entry) {
+            std::uint8_t result = (entry->result < stats.counts.size()) ? entry->result : 0;
+            if (stats.games.empty() || entry->game != lastGame) {
+                stats.games.push_back(entry->game);
+                stats.counts[result]++;
+                lastGame = entry->game;
+            }
+            if (entry->move == NO_MOVE) continue;
+
+            auto isPlayed = [entry](const Stats::Move &m) { return m.code == entry->move; };
+            auto found = std::find_if(stats.moves.begin(), stats.moves.end(), isPlayed);
+            if (found == stats.moves.end()) {
+                stats.moves.push_back({entry->move, "", Counts{}});
+                found = stats.moves.end() - 1;
+            }
+            found->counts[result]++;
+        }
+        std::stable_sort(stats.moves.begin(), stats.moves.end(),
+                         [](const Stats::Move &a, const Stats::Move &b) {
+                             return total(a.counts) > total(b.counts) ||
+                                    (total(a.counts) == total(b.counts) && a.code < b.code);
+                         });
+        return stats;
+    }
+} // namespace Explorer
@@ -1,19 +1,100 @@
 #include "game.hpp"
 
+#include <array>
+#include <charconv>
+
+#include "model/tablebase/tablebase.hpp"
+
 namespace Game {
+    namespace {
+        const char PIECE_LETTERS[] = "kqrbnp";
+
+        Pieces::Types pieceType(char letter) {
+            switch (letter) {
+            case 'k':
+                return Pieces::Types::KING;
+            case 'q':
+                return Pieces::Types::QUEEN;
+            case 'r':
+                return Pieces::Types::ROOK;
+            case 'b':
+                return Pieces::Types::BISHOP;
+            case 'n':
+                return Pieces::Types::KNIGHT;
+            case 'p':
+                return Pieces::Types::PAWN;
+            default:
+                return Pieces::Types::UNDEFINED;
+            }
+        }
+
+        bool parseNumber(std::string_view field, int &number) {
+            auto end = field.data() + field.size();
+            auto [ptr, error] = std::from_chars(field.data(), end, number);
+            return error == std::errc() && ptr == end;
+        }
+
+        // Pieces by color, type and square, then turn, castling rights and en passant column
+        constexpr int ZOBRIST_TURN = 2 * 6 * NNUE::N_SQUARES;
+        constexpr int ZOBRIST_CASTLING = ZOBRIST_TURN + 1;
+        constexpr int ZOBRIST_EN_PASSANT = ZOBRIST_CASTLING + 4;
+        constexpr int N_ZOBRIST_KEYS = ZOBRIST_EN_PASSANT + 8;
+
+        constexpr std::array<std::uint64_t, N_ZOBRIST_KEYS> zobristKeys() {
+            std::array<std::uint64_t, N_ZOBRIST_KEYS> keys{};
+            std::uint64_t state = 0x9E3779B97F4A7C15ULL;
+            for (auto &key : keys) {
+                // splitmix64
+                std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+                key = z ^ (z >> 31);
+            }
+            return keys;
+        }
+
+        constexpr auto ZOBRIST_KEYS = zobristKeys();
+    } // namespace
+
     Board::Board()
         : _boundaries({0, 0})
         , _nMoves(0)
         , _status(Status::NOT_STARTED)
         , _moves()
-        , _pieces() {}
+        , _pieces()
+        , _players({nullptr, nullptr})
+        , _turn(nullptr)
+        , _enPassant()
+        , _halfMoves(0)
+        , _initialPly(0)
+        , _states()
+        , _keys()
+        , _nKeys(0)
+        , _materialKey(0)
+        , _legalMoves()
+        , _isLegalMovesCached(false)
+        , _network(nullptr)
+        , _accumulator() {}
 
     Board::Board(int nRow, int nColumn)
         : _boundaries({nColumn, nRow})
         , _nMoves(0)
         , _status(Status::NOT_STARTED)
         , _moves()
-        , _pieces() {}
+        , _pieces()
+        , _players({nullptr, nullptr})
+        , _turn(nullptr)
+        , _enPassant()
+        , _halfMoves(0)
+        , _initialPly(0)
+        , _states()
+        , _keys()
+        , _nKeys(0)
+        , _materialKey(0)
+        , _legalMoves()
+        , _isLegalMovesCached(false)
+        , _network(nullptr)
+        , _accumulator() {}
 
     Board::~Board() {
         for (auto *piece : _pieces) {
@@ -33,15 +114,255 @@ namespace Game {
 
     const std::vector<Pieces::Piece *> &Board::pieces() const { return this->_pieces; }
 
+    Pieces::Player *Board::turn() const { return this->_turn; }
+
+    Position Board::enPassant() const { return this->_enPassant; }
+
+    int Board::halfMoves() const { return this->_halfMoves; }
+
+    int Board::fullMoves() const { return (this->_initialPly + this->_nMoves) / 2 + 1; }
+
     void Board::initialize(Pieces::Player &first, Pieces::Player &second) {
+        this->_players = {&first, &second};
+        this->_turn = &first;
+        this->_enPassant = Position();
+        this->_halfMoves = 0;
+        this->_initialPly = 0;
         this->_pieces = this->initializePieces(first, true);
         auto secondPieces = this->initializePieces(second, false);
         this->_pieces.insert(this->_pieces.end(), secondPieces.begin(), secondPieces.end());
-        this->updateStatus(first);
+        this->_isLegalMovesCached = false;
+        this->refreshAccumulator();
+        this->refreshMaterial();
+        this->clearKeys();
+        this->updateStatus();
+    }
+
+    void Board::initialize(Pieces::Player &first, Pieces::Player &second, std::string_view fen) {
+        auto invalid = [&fen](const std::string &reason) {
+            return std::runtime_error("Invalid FEN " + reason + ": fen='" + std::string(fen) + "'");
+        };
+        int nRow = this->_boundaries.first, nColumn = this->_boundaries.second;
+
+        std::string_view fields[6];
+        int nFields = 0;
+        for (std::size_t i = 0; i < fen.size();) {
+            if (fen[i] == ' ') {
+                ++i;
+                continue;
+            }
+            if (nFields == 6) throw invalid("field count");
+
+            std::size_t start = i;
+            while (i < fen.size() && fen[i] != ' ') ++i;
+            fields[nFields++] = fen.substr(start, i - start);
+        }
+        if (nFields < 4) throw invalid("field count");
+
+        struct Placement {
+            Position position;
+            Pieces::Player *owner;
+            Pieces::Types type;
+        };
+        std::vector<Placement> placements;
+        placements.reserve(this->_pieces.size());
+        int row = nRow - 1, column = 0;
+        for (char c : fields[0]) {
+            if (c == '/') {
+                if (column != nColumn || row == 0) throw invalid("placement");
+
+                row--;
+                column = 0;
+                continue;
+            }
+            if (c >= '1' && c <= '9') {
+                column += c - '0';
+                if (column > nColumn) throw invalid("placement");
+                continue;
+            }
+            bool isFirst = (c >= 'A' && c <= 'Z');
+            auto type = pieceType(isFirst ? static_cast<char>(c - 'A' + 'a') : c);
+            if (type == Pieces::Types::UNDEFINED || column >= nColumn) throw invalid("placement");
+
+            placements.push_back({Position(row, column++), isFirst ? &first : &second, type});
+        }
+        if (row != 0 || column != nColumn) throw invalid("placement");
+
+        // Check detection and the solvers expect exactly one King per side
+        int nFirstKings = 0, nSecondKings = 0;
+        for (auto &placement : placements) {
+            if (placement.type != Pieces::Types::KING) continue;
+
+            (placement.owner == &first) ? nFirstKings++ : nSecondKings++;
+        }
+        if (nFirstKings != 1 || nSecondKings != 1) throw invalid("placement");
+
+        if (fields[1] != "w" && fields[1] != "b") throw invalid("side to move");
+
+        if (fields[2] != "-" && (fields[2].empty() ||
+                                 fields[2].find_first_not_of("KQkq") != std::string_view::npos)) {
+            throw invalid("castling");
+        }
+
+        Position enPassant;
+        if (fields[3] != "-") {
+            int rank = 0;
+            if (fields[3].size() < 2 || !parseNumber(fields[3].substr(1), rank)) {
+                throw invalid("en passant");
+            }
+            enPassant = Position(rank - 1, fields[3][0] - 'a');
+            if (!Pieces::Piece::isInBounds(enPassant, nRow, nColumn)) throw invalid("en passant");
+        }
+
+        int halfMoves = 0, fullMoves = 1;
+        if ((nFields > 4 && (!parseNumber(fields[4], halfMoves) || halfMoves < 0)) ||
+            (nFields > 5 && (!parseNumber(fields[5], fullMoves) || fullMoves < 1))) {
+            throw invalid("clocks");
+        }
+
+        this->_players = {&first, &second};
+        this->_turn = (fields[1] == "w") ? &first : &second;
+        std::array<std::size_t, 2 * 6> cursors{};
+        std::vector<Pieces::Piece *> pieces;
+        pieces.reserve(this->_pieces.size() + placements.size());
+        for (auto &placement : placements) {
+            auto &cursor = cursors[this->color(placement.owner) * 6 + placement.type.index()];
+            auto *piece = this->recyclePiece(cursor, placement.owner, placement.type, pieces);
+            piece->place(placement.position);
+        }
+        for (auto *piece : this->_pieces) {
+            if (piece == nullptr) continue;
+
+            if (piece->owner() != &first && piece->owner() != &second) {
+                delete piece;
+                continue;
+            }
+            piece->place(Position());
+            pieces.push_back(piece);
+        }
+        this->_pieces = std::move(pieces);
+
+        std::string_view castling = fields[2];
+        for (std::size_t i = 0; i < placements.size(); ++i) {
+            auto *piece = this->_pieces[i];
+            auto *owner = piece->owner();
+            bool isFirst = owner == &first;
+            int backRow = isFirst ? 0 : (nRow - 1);
+            Position position = piece->position();
+            auto hasRight = [&castling, isFirst](char right) {
+                return castling.find(isFirst ? right : static_cast<char>(right - 'A' + 'a')) !=
+                       std::string_view::npos;
+            };
+            bool isInitial = true;
+            if (piece->type() == Pieces::Types::KING) {
+                isInitial = position.row() == backRow && (hasRight('K') || hasRight('Q'));
+            } else if (piece->type() == Pieces::Types::ROOK) {
+                isInitial = position.row() == backRow &&
+                            ((position.column() == nColumn - 1 && hasRight('K')) ||
+                             (position.column() == 0 && hasRight('Q')));
+            } else if (piece->type() == Pieces::Types::PAWN) {
+                isInitial = position.row() == (isFirst ? 1 : nRow - 2);
+            }
+            piece->place(position, isInitial ? 0 : 1);
+        }
+
+        this->_enPassant = enPassant;
+        this->_halfMoves = halfMoves;
+        this->_initialPly = 2 * (fullMoves - 1) + ((this->_turn == &second) ? 1 : 0);
+        this->_nMoves = 0;
+        this->_moves = Utils::Templates::UndoRedo<Pieces::Move>();
+        this->_states.clear();
+        this->_isLegalMovesCached = false;
+        this->refreshAccumulator();
+        this->refreshMaterial();
+        this->clearKeys();
+        this->_status = Status::IN_PROGRESS;
+        this->updateStatus();
+    }
+
+    std::string Board::fen() const {
+        int nRow = this->_boundaries.first, nColumn = this->_boundaries.second;
+        auto mailbox = this->mailbox();
+        std::string fen;
+        fen.reserve(96);
+        for (int row = nRow - 1; row >= 0; --row) {
+            int nEmpty = 0;
+            for (int column = 0; column < nColumn; ++column) {
+                auto *piece = mailbox[row * nColumn + column];
+                if (piece == nullptr) {
+                    nEmpty++;
+                    continue;
+                }
+                if (nEmpty > 0) fen += std::to_string(nEmpty);
+                nEmpty = 0;
+
+                char letter = PIECE_LETTERS[piece->type().index()];
+                bool isFirst = piece->owner() != this->_players.second;
+                fen += isFirst ? static_cast<char>(letter - 'a' + 'A') : letter;
+            }
+            if (nEmpty > 0) fen += std::to_string(nEmpty);
+            if (row > 0) fen += '/';
+        }
+
+        fen += (this->_turn == this->_players.second) ? " b " : " w ";
+        fen += this->castlingRights();
+        fen += ' ';
+        if (this->_enPassant == Position()) {
+            fen += '-';
+        } else {
+            fen += static_cast<char>('a' + this->_enPassant.column());
+            fen += std::to_string(this->_enPassant.row() + 1);
+        }
+        fen += ' ' + std::to_string(this->_halfMoves) + ' ' + std::to_string(this->fullMoves());
+        return fen;
+    }
+
+    std::uint64_t Board::materialKey() const { return this->_materialKey; }
+
+    std::uint64_t Board::hash() const {
+        int nColumn = this->_boundaries.second;
+        Position captured;
+        std::uint64_t key = 0;
+        for (auto *piece : this->_pieces) {
+            Position position = piece->position();
+            if (position == captured) continue;
+
+            int square = position.row() * nColumn + position.column();
+            key ^= ZOBRIST_KEYS[(this->color(piece) * 6 + piece->type().index()) *
+                                    NNUE::N_SQUARES +
+                                square];
+        }
+        if (this->_turn == this->_players.second) key ^= ZOBRIST_KEYS[ZOBRIST_TURN];
+
+        int lastColumn = nColumn - 1;
+        const Pieces::Player *players[] = {this->_players.first, this->_players.second};
+        for (int i = 0; i < 2; ++i) {
+            if (this->hasCastlingRight(players[i], lastColumn)) {
+                key ^= ZOBRIST_KEYS[ZOBRIST_CASTLING + 2 * i];
+            }
+            if (this->hasCastlingRight(players[i], 0)) {
+                key ^= ZOBRIST_KEYS[ZOBRIST_CASTLING + 2 * i + 1];
+            }
+        }
+        // Like Polyglot, en passant only counts when a Pawn can take it
+        if (this->_enPassant != Position()) {
+            int row = this->_enPassant.row() + ((this->_turn == this->_players.first) ? -1 : 1);
+            for (auto *piece : this->_pieces) {
+                Position position = piece->position();
+                if (piece->owner() != this->_turn || piece->type() != Pieces::Types::PAWN ||
+                    position.row() != row ||
+                    std::abs(position.column() - this->_enPassant.column()) != 1) {
+                    continue;
+                }
+                key ^= ZOBRIST_KEYS[ZOBRIST_EN_PASSANT + this->_enPassant.column()];
+                break;
+            }
+        }
+        return key;
     }
 
     void Board::move(Pieces::Piece *piece, Position to) {
-        if (this->_status != Status::IN_PROGRESS) {
+        if (this->_status != Status::IN_PROGRESS && !this->_status.isDraw()) {
             throw std::runtime_error("Board's status must be '" + std::string(Status::IN_PROGRESS) +
                                      "', instead status='" + std::string(this->_status) + "'");
         }
@@ -49,52 +370,345 @@ namespace Game {
         this->pieceExists(piece);
 
         auto moves = this->moves(piece, to);
-        auto actions = this->actions(piece, to, moves);
-        Pieces::Player *owner = piece->owner();
+        this->actions(piece, to, moves);
+
+        Pieces::Move move = this->expandPromotions(moves.at(to)).front();
+        if (!this->isLegal(move)) {
+            std::string toStr = to, pieceStr = *piece;
+            throw std::runtime_error("This move leaves the King threatened: to='" + toStr +
+                                     "', piece='" + pieceStr + "'");
+        }
+
+        this->play(move);
+    }
+
+    void Board::move(const Pieces::Move &move) {
+        if (this->_status != Status::IN_PROGRESS && !this->_status.isDraw()) {
+            throw std::runtime_error("Board's status must be '" + std::string(Status::IN_PROGRESS) +
+                                     "', instead status='" + std::string(this->_status) + "'");
+        }
+
+        this->play(move);
+    }
+
+    void Board::play(const Pieces::Move &move) {
+        auto actions = move.actions();
+        Pieces::Player *owner = actions[0].piece()->owner();
+        this->pushState(move);
         this->playMove(*owner, actions);
 
-        Pieces::Move &move = moves.at(to);
         this->_moves.do_(move);
+        this->_nMoves++;
+        this->_turn = this->opponent(owner);
+        this->pushKey();
 
-        this->updateStatus(*owner);
+        this->updateStatus();
     }
 
-    void Board::updateStatus(Pieces::Player &player) {
+    void Board::updateStatus() {
         if ((this->_status == Status::NOT_STARTED) && !this->_moves.canUndo()) {
             this->_status = Status::IN_PROGRESS;
             return;
         }
 
-        bool kingHasMoves = this->opponentKingHasMoves(player);
-        bool kingIsThreatened = this->isOpponentKingThreatened(player);
-        if (!kingHasMoves && kingIsThreatened) {
-            this->_status = Status::ENDED_CHECKMATE;
+        bool hasLegalMove = !this->_legalMoves.empty();
+        if (!this->_isLegalMovesCached) {
+            std::vector<Pieces::Move> legalMoves;
+            this->generateLegalMoves(legalMoves, 1);
+            hasLegalMove = !legalMoves.empty();
+        }
+        if (hasLegalMove) {
+            this->_status = Status::IN_PROGRESS;
+            if (Material::probe(this->_materialKey).endgame == Material::Endgame::INSUFFICIENT) {
+                this->_status = Status::ENDED_INSUFFICIENT_MATERIAL;
+            } else if (this->_halfMoves >= 100) {
+                this->_status = Status::ENDED_FIFTY_MOVES;
+            } else if (this->repetitions() >= 2) {
+                this->_status = Status::ENDED_REPETITION;
+            }
             return;
         }
 
-        bool kingIsLastPiece = this->opponentKingIsLastPiece(player);
-        if (!kingHasMoves && !kingIsThreatened && kingIsLastPiece) {
-            this->_status = Status::ENDED_STALEMATE;
-            return;
+        this->_status = this->isInCheck() ? Status::ENDED_CHECKMATE : Status::ENDED_STALEMATE;
+    }
+
+    void Board::pushState(const Pieces::Move &move) {
+        this->_states.push_back({this->_status, this->_enPassant, this->_halfMoves});
+
+        Position from = move.from(), to = move.to();
+        bool isPawn = move.piece()->type() == Pieces::Types::PAWN;
+        this->_halfMoves = (isPawn || move.captured() != nullptr) ? 0 : this->_halfMoves + 1;
+        this->_enPassant = Position();
+        if (isPawn && std::abs(to.row() - from.row()) == 2) {
+            this->_enPassant = Position((from.row() + to.row()) / 2, from.column());
         }
+    }
+
+    void Board::popState() {
+        auto &state = this->_states.back();
+        this->_status = state.status;
+        this->_enPassant = state.enPassant;
+        this->_halfMoves = state.halfMoves;
+        this->_states.pop_back();
+    }
 
-        return;
+    void Board::pushKey() { this->_keys[this->_nKeys++ % N_KEYS] = this->hash(); }
+
+    void Board::clearKeys() {
+        this->_nKeys = 0;
+        this->pushKey();
     }
 
     void Board::unMove() {
         Pieces::Move move = this->_moves.undo();
+        this->unPlayMove(move);
         this->_nMoves--;
-
-        auto owner = move.actions()[0].piece()->owner();
-        this->updateStatus(*owner);
+        this->_nKeys--;
+        this->_turn = move.piece()->owner();
+        this->popState();
     }
 
     void Board::reMove() {
         Pieces::Move move = this->_moves.redo();
+        auto actions = move.actions();
+        auto owner = actions[0].piece()->owner();
+        this->pushState(move);
+        this->playMove(*owner, actions);
         this->_nMoves++;
+        this->_turn = this->opponent(owner);
+        this->pushKey();
+
+        this->updateStatus();
+    }
+
+    void Board::nullMove() {
+        this->_states.push_back({this->_status, this->_enPassant, this->_halfMoves});
+        this->_enPassant = Position();
+        this->_turn = this->opponent(this->_turn);
+        this->_isLegalMovesCached = false;
+        this->pushKey();
+    }
 
-        auto owner = move.actions()[0].piece()->owner();
-        this->updateStatus(*owner);
+    void Board::unNullMove() {
+        this->_nKeys--;
+        this->popState();
+        this->_turn = this->opponent(this->_turn);
+        this->_isLegalMovesCached = false;
+    }
+
+    std::vector<Pieces::Move> Board::legalMoves() {
+        if (this->_isLegalMovesCached) return this->_legalMoves;
+
+        std::vector<Pieces::Move> legalMoves;
+        this->generateLegalMoves(legalMoves, legalMoves.max_size());
+        this->_legalMoves = legalMoves;
+        this->_isLegalMovesCached = true;
+        return legalMoves;
+    }
+
+    std::size_t Board::legalMoves(Generation generation, Pieces::Move *moves,
+                                  std::size_t capacity) {
+        std::size_t size = 0;
+        auto add = [&](Pieces::Move &&move) {
+            if (size == capacity) {
+                throw std::runtime_error("Too many moves for the buffer: capacity=" +
+                                         std::to_string(capacity));
+            }
+            moves[size++] = std::move(move);
+            return true;
+        };
+        if (!this->_isLegalMovesCached) {
+            this->generateLegalMoves(generation, nullptr, add);
+            return size;
+        }
+
+        for (auto &move : this->_legalMoves) {
+            bool isTactical = (move.captured() != nullptr) || (move.promoted() != nullptr);
+            bool isWanted = (generation == Generation::ALL) ||
+                            (isTactical == (generation == Generation::TACTICAL));
+            if (isWanted) add(Pieces::Move(move));
+        }
+        return size;
+    }
+
+    bool Board::isPlayable(const Pieces::Move &move) {
+        if (move.from() == Position()) return false;
+
+        if (this->_isLegalMovesCached) {
+            return std::find(this->_legalMoves.begin(), this->_legalMoves.end(), move) !=
+                   this->_legalMoves.end();
+        }
+        auto *piece = move.piece();
+        auto &pieces = this->_pieces;
+        if (piece->owner() != this->_turn || piece->position() != move.from() ||
+            std::find(pieces.begin(), pieces.end(), piece) == pieces.end()) {
+            return false;
+        }
+
+        bool isFound = false;
+        this->generateLegalMoves(Generation::ALL, piece, [&](Pieces::Move &&legal) {
+            isFound = legal == move;
+            return !isFound;
+        });
+        return isFound;
+    }
+
+    void Board::generateLegalMoves(std::vector<Pieces::Move> &legalMoves, std::size_t limit) {
+        this->generateLegalMoves(Generation::ALL, nullptr, [&](Pieces::Move &&move) {
+            legalMoves.push_back(std::move(move));
+            return legalMoves.size() < limit;
+        });
+    }
+
+    template <typename Sink>
+    void Board::generateLegalMoves(Generation generation, const Pieces::Piece *only,
+                                   Sink &&sink) {
+        Pieces::Player *player = this->_turn;
+        if (player == nullptr) return;
+
+        auto friendlies = this->playerPieces(*player, true, false);
+        auto opponents = this->playerPieces(*player, false, false);
+        int nRow = this->_boundaries.first, nColumn = this->_boundaries.second;
+        bool inCheck = this->isInCheck();
+        auto byDestination = [](const Pieces::Move &a, const Pieces::Move &b) {
+            Position aTo = a.to(), bTo = b.to();
+            if (aTo.row() != bTo.row()) return aTo.row() < bTo.row();
+            return aTo.column() < bTo.column();
+        };
+        Position captured;
+        std::size_t nPieces = this->_pieces.size();
+        for (std::size_t i = 0; i < nPieces; ++i) {
+            auto *piece = this->_pieces[i];
+            if (piece->owner() != player || piece->position() == captured) continue;
+            if (only != nullptr && piece != only) continue;
+
+            std::vector<Pieces::Move> pieceMoves;
+            for (auto &[_, move] : piece->moves(friendlies, nRow, nColumn, opponents)) {
+                pieceMoves.push_back(move);
+            }
+            if (piece->type() == Pieces::Types::PAWN && this->_enPassant != captured) {
+                this->addEnPassant(pieceMoves, piece, opponents);
+            }
+            std::sort(pieceMoves.begin(), pieceMoves.end(), byDestination);
+            for (auto &pieceMove : pieceMoves) {
+                if (inCheck && pieceMove.type() == Pieces::Move::Type::SWAP) continue;
+
+                for (auto &move : this->expandPromotions(pieceMove)) {
+                    // Legality is the costly part, it is only checked for the generation
+                    bool isTactical = (move.captured() != nullptr) || (move.promoted() != nullptr);
+                    if (generation != Generation::ALL &&
+                        isTactical != (generation == Generation::TACTICAL)) {
+                        continue;
+                    }
+                    if (!this->isLegal(move)) continue;
+
+                    if (!sink(std::move(move))) return;
+                }
+            }
+        }
+    }
+
+    void Board::addEnPassant(std::vector<Pieces::Move> &moves, Pieces::Piece *pawn,
+                             std::unordered_map<Position, Pieces::Piece *> &opponents) const {
+        Position from = pawn->position(), to = this->_enPassant;
+        int rowDiff = std::pair<int, int>(static_cast<Pieces::Pawn *>(pawn)->forward()).first;
+        if (from.row() + rowDiff != to.row() || std::abs(from.column() - to.column()) != 1) return;
+
+        Position victimPosition(from.row(), to.column());
+        auto it = opponents.find(victimPosition);
+        if (it == opponents.end() || it->second->type() != Pieces::Types::PAWN) return;
+
+        auto move = Pieces::Move::createMove(*pawn, from, to, Pieces::Move::Type::CAPTURE);
+        Pieces::Move::addAction(move, it->second, victimPosition);
+        moves.push_back(move);
+    }
+
+    bool Board::isInCheck() {
+        auto *king = this->king(this->_turn);
+        if (king == nullptr) return false;
+
+        return this->isAttacked(this->mailbox(), king->position(), this->opponent(this->_turn));
+    }
+
+    int Board::repetitions() const {
+        if (this->_nKeys == 0) return 0;
+
+        int current = this->_nKeys - 1;
+        std::uint64_t key = this->_keys[current % N_KEYS];
+        int depth = std::min({this->_halfMoves, current, N_KEYS - 1});
+        int count = 0;
+        // A position can't come back before both players moved twice
+        for (int back = 4; back <= depth; back += 2) {
+            count += this->_keys[(current - back) % N_KEYS] == key;
+        }
+        return count;
+    }
+
+    bool Board::isKnownDraw() const {
+        switch (Material::probe(this->_materialKey).endgame) {
+        case Material::Endgame::INSUFFICIENT:
+            return true;
+        case Material::Endgame::KPK: {
+            Tablebase::WDL wdl;
+            return Tablebase::KPK::probe(*this, wdl) && wdl == Tablebase::WDL::DRAW;
+        }
+        default:
+            return false;
+        }
+    }
+
+    std::vector<Pieces::Piece *> Board::attackers(const Position &square,
+                                                  const Pieces::Player *player) const {
+        std::vector<Pieces::Piece *> attackers;
+        this->isAttacked(this->mailbox(), square, player, &attackers);
+        return attackers;
+    }
+
+    int Board::see(const Pieces::Move &move) const {
+        auto mailbox = this->mailbox();
+        int nColumn = this->_boundaries.second;
+        auto index = [nColumn](const Position &position) {
+            return position.row() * nColumn + position.column();
+        };
+
+        Pieces::Piece *piece = move.piece();
+        Pieces::Piece *captured = move.captured();
+        Pieces::Piece *promoted = move.promoted();
+        Position to = move.to();
+
+        std::vector<int> gains;
+        gains.push_back(captured != nullptr ? captured->type().value() : 0);
+        Pieces::Piece *occupant = piece;
+        if (promoted != nullptr) {
+            gains[0] += promoted->type().value() - piece->type().value();
+            occupant = promoted;
+        }
+        mailbox[index(move.from())] = nullptr;
+        if (captured != nullptr) mailbox[index(captured->position())] = nullptr;
+        mailbox[index(to)] = occupant;
+
+        const Pieces::Player *side = this->opponent(piece->owner());
+        std::vector<Pieces::Piece *> attackers;
+        while (true) {
+            attackers.clear();
+            if (!this->isAttacked(mailbox, to, side, &attackers)) break;
+
+            auto *attacker = *std::min_element(
+                attackers.begin(), attackers.end(), [](Pieces::Piece *a, Pieces::Piece *b) {
+                    return a->type().value() < b->type().value();
+                });
+            gains.push_back(occupant->type().value() - gains.back());
+            if (std::max(-gains[gains.size() - 2], gains.back()) < 0) break;
+
+            mailbox[index(attacker->position())] = nullptr;
+            mailbox[index(to)] = attacker;
+            occupant = attacker;
+            side = this->opponent(side);
+        }
+        for (std::size_t depth = gains.size() - 1; depth > 0; --depth) {
+            gains[depth - 1] = -std::max(-gains[depth - 1], gains[depth]);
+        }
+        return gains[0];
     }
 
     std::unordered_map<Position, Pieces::Piece *> Board::promotions(Pieces::Piece *piece) {
@@ -118,60 +732,60 @@ namespace Game {
         return serialized;
     };
 
-    bool Board::opponentKingIsLastPiece(Pieces::Player &player) {
-        auto opponents = this->playerPieces(player, false, false);
-        return (opponents.size() == 1) && findKing(opponents);
-    }
+    Pieces::Piece *Board::recyclePiece(std::size_t &cursor, Pieces::Player *player,
+                                       Pieces::Types type, std::vector<Pieces::Piece *> &pieces) {
+        Pieces::Piece *piece = nullptr;
+        for (; cursor < this->_pieces.size() && piece == nullptr; ++cursor) {
+            auto *candidate = this->_pieces[cursor];
+            if (candidate == nullptr || candidate->type() != type) continue;
 
-    bool Board::opponentKingHasMoves(Pieces::Player &player) {
-        auto opponents = this->playerPieces(player, false);
-        auto king = findKing(opponents);
+            if (candidate->isPlayerNullptr() || candidate->owner() != player) continue;
 
-        auto friendlies = this->playerPieces(player, true);
-        auto moves =
-            king->moves(opponents, this->_boundaries.first, this->_boundaries.second, friendlies);
-        return !moves.empty();
+            piece = candidate;
+            this->_pieces[cursor] = nullptr;
+        }
+        if (piece == nullptr) {
+            Position outside;
+            if (type == Pieces::Types::KING) piece = new Pieces::King(outside, player);
+            if (type == Pieces::Types::QUEEN) piece = new Pieces::Queen(outside, player);
+            if (type == Pieces::Types::ROOK) piece = new Pieces::Rook(outside, player);
+            if (type == Pieces::Types::BISHOP) piece = new Pieces::Bishop(outside, player);
+            if (type == Pieces::Types::KNIGHT) piece = new Pieces::Knight(outside, player);
+            if (type == Pieces::Types::PAWN) {
+                auto forward = (player == this->_players.first) ? Pieces::Move::Direction::UP
+                                                                : Pieces::Move::Direction::DOWN;
+                piece = new Pieces::Pawn(outside, player, forward);
+            }
+        }
+        pieces.push_back(piece);
+        return piece;
     }
 
-    bool Board::isOpponentKingThreatened(Pieces::Player &player) {
-        auto opponents = this->playerPieces(player, false);
-        auto king = findKing(opponents);
-        auto kingPosition = king->position();
-
-        auto friendlies = this->playerPieces(player, true);
-        auto nRow = this->_boundaries.first;
-        auto nColumn = this->_boundaries.second;
-        std::unordered_map<Position, Pieces::Move> moves;
-        for (auto &[_, friendly] : friendlies) {
-            moves = friendly->moves(friendlies, nRow, nColumn, opponents);
-            if (!moves.count(kingPosition)) continue;
-
-            return true;
-        }
-        return false;
+    std::string Board::castlingRights() const {
+        std::string rights;
+        int lastColumn = this->_boundaries.second - 1;
+        if (this->hasCastlingRight(this->_players.first, lastColumn)) rights += 'K';
+        if (this->hasCastlingRight(this->_players.first, 0)) rights += 'Q';
+        if (this->hasCastlingRight(this->_players.second, lastColumn)) rights += 'k';
+        if (this->hasCastlingRight(this->_players.second, 0)) rights += 'q';
+        return rights.empty() ? "-" : rights;
     }
 
-    Pieces::Piece *Board::findKing(std::unordered_map<Position, Pieces::Piece *> pieces) {
-        std::vector<Pieces::Piece *> vPieces;
-        for (auto &[_, piece] : pieces) {
-            vPieces.push_back(piece);
+    bool Board::hasCastlingRight(const Pieces::Player *player, int column) const {
+        int backRow = (player == this->_players.first) ? 0 : (this->_boundaries.first - 1);
+        auto *king = this->king(player);
+        if (king == nullptr || king->nMoves() != 0 || king->position().row() != backRow) {
+            return false;
         }
-        return findPieces(vPieces, Pieces::Types::KING, true)[0];
-    }
 
-    std::vector<Pieces::Piece *> Board::findPieces(std::vector<Pieces::Piece *> pieces,
-                                                   Pieces::Types type, bool throwNotFound) {
-        std::vector<Pieces::Piece *> founds;
-        for (auto *piece : pieces) {
-            if (piece->type() != type) continue;
+        Position corner(backRow, column);
+        for (auto *piece : this->_pieces) {
+            if (piece->position() != corner) continue;
 
-            founds.push_back(piece);
-        }
-        if (founds.size() == 0) {
-            throw std::runtime_error("Piece of type '" + std::string(type) + "' not found");
+            return piece->type() == Pieces::Types::ROOK && piece->owner() == player &&
+                   piece->nMoves() == 0;
         }
-
-        return founds;
+        return false;
     }
 
     std::vector<Pieces::Piece *> Board::initializePieces(Pieces::Player &player,
@@ -179,6 +793,8 @@ namespace Game {
         std::vector<Pieces::Piece *> pieces;
         int initialRow = isFirstPlayer ? 0 : (this->_boundaries.first - 1);
         int pawnRow = isFirstPlayer ? (initialRow + 1) : (initialRow - 1);
+        auto pawnForward = isFirstPlayer ? Pieces::Move::Direction::UP
+                                         : Pieces::Move::Direction::DOWN;
 
         Position kingPosition(initialRow, 4);
         Position queenPosition(initialRow, 3);
@@ -199,7 +815,7 @@ namespace Game {
         pieces.push_back(new Pieces::Rook(Position(initialRow, 7), &player));
 
         for (int col = 0; col < 8; ++col) {
-            pieces.push_back(new Pieces::Pawn(Position(pawnRow, col), &player));
+            pieces.push_back(new Pieces::Pawn(Position(pawnRow, col), &player, pawnForward));
         }
 
         return pieces;
@@ -262,9 +878,243 @@ namespace Game {
         Pieces::Piece *actionPiece = nullptr;
         for (auto &action : actions) {
             actionPiece = action.piece();
+            this->updateAccumulator(actionPiece, action.initial(), action.final());
+            this->updateMaterial(actionPiece, action.initial(), action.final());
             actionPiece->move(action.final());
         }
+        this->_isLegalMovesCached = false;
+    }
+
+    void Board::unPlayMove(Pieces::Move &move) {
+        auto actions = move.actions();
+        Pieces::Piece *actionPiece = nullptr;
+        for (auto it = actions.rbegin(); it != actions.rend(); ++it) {
+            actionPiece = it->piece();
+            this->updateAccumulator(actionPiece, it->final(), it->initial());
+            this->updateMaterial(actionPiece, it->final(), it->initial());
+            actionPiece->unMove(it->initial());
+        }
+        this->_isLegalMovesCached = false;
+    }
+
+    bool Board::isLegal(const Pieces::Move &move) {
+        auto actions = move.actions();
+        auto *owner = actions[0].piece()->owner();
+        for (auto &action : actions) {
+            action.piece()->move(action.final());
+        }
+
+        auto *king = this->king(owner);
+        bool isLegal =
+            (king == nullptr) ||
+            !this->isAttacked(this->mailbox(), king->position(), this->opponent(owner));
+
+        for (auto it = actions.rbegin(); it != actions.rend(); ++it) {
+            it->piece()->unMove(it->initial());
+        }
+        return isLegal;
+    }
+
+    std::vector<Pieces::Move> Board::expandPromotions(const Pieces::Move &move) {
+        Pieces::Piece *piece = move.piece();
+        if (piece->type() != Pieces::Types::PAWN) return {move};
+
+        auto *pawn = static_cast<Pieces::Pawn *>(piece);
+        bool isForwardUp = std::pair<int, int>(pawn->forward()).first > 0;
+        int lastRow = isForwardUp ? (this->_boundaries.first - 1) : 0;
+        Position to = move.to();
+        if (to.row() != lastRow) return {move};
+
+        std::vector<Pieces::Move> promotions;
+        Position outside;
+        for (auto type : {Pieces::Types::QUEEN, Pieces::Types::ROOK, Pieces::Types::BISHOP,
+                          Pieces::Types::KNIGHT}) {
+            Pieces::Move promotion = move;
+            Pieces::Move::addAction(promotion, pawn, to, outside);
+            Pieces::Move::addAction(promotion, this->sparePiece(pawn->owner(), type), outside, to);
+            promotions.push_back(promotion);
+        }
+        return promotions;
+    }
+
+    Pieces::Piece *Board::sparePiece(Pieces::Player *player, Pieces::Types type) {
+        Position outside;
+        for (auto *piece : this->_pieces) {
+            if (piece->type() != type || piece->owner() != player) continue;
+
+            if (piece->position() == outside && piece->nMoves() == 0) return piece;
+        }
+
+        Pieces::Piece *piece = nullptr;
+        if (type == Pieces::Types::QUEEN) piece = new Pieces::Queen(outside, player);
+        if (type == Pieces::Types::ROOK) piece = new Pieces::Rook(outside, player);
+        if (type == Pieces::Types::BISHOP) piece = new Pieces::Bishop(outside, player);
+        if (type == Pieces::Types::KNIGHT) piece = new Pieces::Knight(outside, player);
+        if (piece == nullptr) {
+            throw std::runtime_error("Unsupported promotion: type='" + std::string(type) + "'");
+        }
+        this->_pieces.push_back(piece);
+        return piece;
+    }
+
+    Pieces::Player *Board::opponent(const Pieces::Player *player) const {
+        return (player == this->_players.first) ? this->_players.second : this->_players.first;
+    }
+
+    Pieces::Piece *Board::king(const Pieces::Player *player) const {
+        Position captured;
+        for (auto *piece : this->_pieces) {
+            if (piece->type() != Pieces::Types::KING || piece->owner() != player) continue;
+
+            if (piece->position() != captured) return piece;
+        }
+        return nullptr;
+    }
+
+    std::vector<Pieces::Piece *> Board::mailbox() const {
+        int nRow = this->_boundaries.first, nColumn = this->_boundaries.second;
+        std::vector<Pieces::Piece *> mailbox(nRow * nColumn, nullptr);
+        for (auto *piece : this->_pieces) {
+            auto position = piece->position();
+            if (!Pieces::Piece::isInBounds(position, nRow, nColumn)) continue;
+
+            mailbox[position.row() * nColumn + position.column()] = piece;
+        }
+        return mailbox;
+    }
+
+    bool Board::isAttacked(const std::vector<Pieces::Piece *> &mailbox, const Position &square,
+                           const Pieces::Player *player,
+                           std::vector<Pieces::Piece *> *attackers) const {
+        int nRow = this->_boundaries.first, nColumn = this->_boundaries.second;
+        bool isAttacked = false;
+        auto at = [&mailbox, nRow, nColumn](int row, int column) -> Pieces::Piece * {
+            if (row < 0 || row >= nRow || column < 0 || column >= nColumn) return nullptr;
+            return mailbox[row * nColumn + column];
+        };
+        auto isOwned = [player](const Pieces::Piece *piece) {
+            return piece != nullptr && !piece->isPlayerNullptr() && piece->owner() == player;
+        };
+        auto found = [&isAttacked, attackers](Pieces::Piece *piece) {
+            isAttacked = true;
+            if (attackers != nullptr) attackers->push_back(piece);
+            return attackers == nullptr;
+        };
+        int row = square.row(), column = square.column();
+
+        static const int knightOffsets[8][2] = {{2, 1},   {2, -1}, {-2, 1}, {-2, -1},
+                                                {1, 2},   {1, -2}, {-1, 2}, {-1, -2}};
+        for (const auto &offset : knightOffsets) {
+            auto *piece = at(row + offset[0], column + offset[1]);
+            if (!isOwned(piece) || piece->type() != Pieces::Types::KNIGHT) continue;
+
+            if (found(piece)) return true;
+        }
+
+        for (int rowDiff : {-1, 1}) {
+            for (int columnDiff : {-1, 1}) {
+                auto *piece = at(row - rowDiff, column - columnDiff);
+                if (!isOwned(piece) || piece->type() != Pieces::Types::PAWN) continue;
+
+                auto forward = std::pair<int, int>(static_cast<Pieces::Pawn *>(piece)->forward());
+                if (forward.first != rowDiff) continue;
+
+                if (found(piece)) return true;
+            }
+        }
+
+        static const int directions[8][2] = {{1, 0},  {-1, 0}, {0, 1},  {0, -1},
+                                             {1, 1},  {1, -1}, {-1, 1}, {-1, -1}};
+        for (const auto &direction : directions) {
+            bool isDiagonal = direction[0] != 0 && direction[1] != 0;
+            int r = row + direction[0], c = column + direction[1];
+            for (int distance = 1; r >= 0 && r < nRow && c >= 0 && c < nColumn; ++distance) {
+                auto *piece = mailbox[r * nColumn + c];
+                r += direction[0], c += direction[1];
+                if (piece == nullptr) continue;
+
+                if (isOwned(piece)) {
+                    auto type = piece->type();
+                    bool isSlider = (type == Pieces::Types::QUEEN) ||
+                                    (isDiagonal ? type == Pieces::Types::BISHOP
+                                                : type == Pieces::Types::ROOK);
+                    bool isKing = (distance == 1) && (type == Pieces::Types::KING);
+                    if ((isSlider || isKing) && found(piece)) return true;
+                }
+                break;
+            }
+        }
+        return isAttacked;
+    }
+
+    void Board::network(const NNUE::Network *network) {
+        if (network != nullptr && (this->_boundaries.first != 8 || this->_boundaries.second != 8)) {
+            throw std::runtime_error("NNUE evaluation requires an 8x8 board");
+        }
+        this->_network = network;
+        this->refreshAccumulator();
+    }
+
+    const NNUE::Network *Board::network() const { return this->_network; }
+
+    const NNUE::Accumulator &Board::accumulator() const {
+        if (this->_network == nullptr) throw std::runtime_error("No NNUE network is attached");
+
+        return this->_accumulator;
+    }
+
+    int Board::color(const Pieces::Piece *piece) const { return this->color(piece->owner()); }
+
+    int Board::color(const Pieces::Player *player) const {
+        return (player == this->_players.second) ? NNUE::Network::BLACK : NNUE::Network::WHITE;
+    }
+
+    void Board::refreshAccumulator() {
+        if (this->_network == nullptr) return;
+
+        this->_network->reset(this->_accumulator);
+        Position captured;
+        for (auto *piece : this->_pieces) {
+            auto position = piece->position();
+            if (position == captured) continue;
+
+            this->_network->add(this->_accumulator, this->color(piece), piece->type(),
+                                square(position));
+        }
+    }
+
+    void Board::updateAccumulator(const Pieces::Piece *piece, Position from, Position to) {
+        if (this->_network == nullptr) return;
+
+        Position captured;
+        auto color = this->color(piece);
+        if (from != captured) {
+            this->_network->remove(this->_accumulator, color, piece->type(), square(from));
+        }
+        if (to != captured) {
+            this->_network->add(this->_accumulator, color, piece->type(), square(to));
+        }
+    }
+
+    void Board::refreshMaterial() {
+        this->_materialKey = 0;
+        Position captured;
+        for (auto *piece : this->_pieces) {
+            auto position = piece->position();
+            if (position == captured) continue;
+
+            this->_materialKey += Material::key(this->color(piece), piece->type(), position);
+        }
+    }
+
+    void Board::updateMaterial(const Pieces::Piece *piece, Position from, Position to) {
+        // Only captures and promotions take a Piece off or put it on the board
+        Position captured;
+        if ((from == captured) == (to == captured)) return;
+
+        auto key = Material::key(this->color(piece), piece->type(), (to == captured) ? from : to);
+        this->_materialKey += (to == captured) ? -key : key;
     }
 
-    void Board::unPlayMove() {};
+    int Board::square(const Position &position) { return position.row() * 8 + position.column(); }
 } // namespace Game
@@ -1,4 +1,6 @@
 #include "model/game/game.hpp"
+#include "model/explorer/explorer.hpp"
+#include "model/notation/notation.hpp"
 
 namespace Game {
     Game::Game()
@@ -47,6 +49,32 @@ namespace Game {
         this->nextPlayer();
     }
 
+    void Game::start(std::string &player1, std::string &player2, const std::string &fen) {
+        if (this->_board) throw std::runtime_error("The game has already been started.");
+
+        auto *first = new Pieces::Player(player1);
+        auto *second = new Pieces::Player(player2);
+        auto *board = new Board(8, 8);
+        try {
+            board->initialize(*first, *second, fen);
+        } catch (const std::runtime_error &) {
+            delete board;
+            delete first;
+            delete second;
+            throw;
+        }
+
+        this->_player1 = first;
+        this->_player2 = second;
+        this->_board = board;
+        this->_currentPlayer = board->turn();
+    }
+
+    std::string Game::fen() const {
+        if (this->_board == nullptr) throw std::runtime_error("Board is nullptr");
+        return this->_board->fen();
+    }
+
     Status Game::status() const {
         if (this->_board == nullptr) return Status::NOT_STARTED;
 
@@ -64,6 +92,56 @@ namespace Game {
         return this->_board->serialize();
     }
 
+    std::string Game::move(std::string_view notation) {
+        if (!this->_board) throw std::runtime_error("The game has not started yet.");
+
+        auto move = Notation::parse(*this->_board, notation);
+        auto san = Notation::SAN::format(*this->_board, move);
+        this->_board->move(move);
+
+        this->nextPlayer();
+
+        return san;
+    }
+
+    void Game::play(std::string_view notation) {
+        if (!this->_board) throw std::runtime_error("The game has not started yet.");
+
+        this->_board->move(Notation::parse(*this->_board, notation));
+
+        this->nextPlayer();
+    }
+
+    void Game::restart(std::string_view fen) {
+        if (!this->_board) throw std::runtime_error("The game has not started yet.");
+
+        this->_board->initialize(*this->_player1, *this->_player2, fen);
+        this->_currentPlayer = this->_board->turn();
+    }
+
+    std::string Game::result() const {
+        auto status = this->status();
+        if (status == Status::ENDED_CHECKMATE) {
+            return (this->_board->turn() == this->_player1) ? "0-1" : "1-0";
+        }
+        if (status == Status::ENDED_STALEMATE || status.isDraw()) return "1/2-1/2";
+
+        return "*";
+    }
+
+    Explorer::Stats Game::explore(const Explorer::Index &index) const {
+        if (!this->_board) throw std::runtime_error("The game has not started yet.");
+
+        auto stats = index.query(this->_board->hash());
+        for (auto &move : stats.moves) {
+            Pieces::Move decoded;
+            if (Explorer::decodeMove(*this->_board, move.code, decoded)) {
+                move.san = Notation::SAN::format(*this->_board, decoded);
+            }
+        }
+        return stats;
+    }
+
     void Game::nextPlayer() {
         this->_currentPlayer = (_currentPlayer == _player1) ? _player2 : _player1;
     }
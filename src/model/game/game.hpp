@@ -1,11 +1,20 @@
 #ifndef GAME_HPP
 #define GAME_HPP
 
+#include <array>
+#include <cstdint>
+#include <string_view>
 #include <unordered_map>
 
+#include "model/nnue/nnue.hpp"
 #include "model/pieces/pieces.hpp"
 #include "model/utils/templates.hpp"
 
+namespace Explorer {
+    class Index;
+    struct Stats;
+} // namespace Explorer
+
 namespace Game {
     class Status {
         enum class _Status {
@@ -13,6 +22,9 @@ namespace Game {
             IN_PROGRESS,
             ENDED_CHECKMATE,
             ENDED_STALEMATE,
+            ENDED_REPETITION,
+            ENDED_FIFTY_MOVES,
+            ENDED_INSUFFICIENT_MATERIAL,
             UNDEFINED = -1
         };
 
@@ -26,10 +38,29 @@ namespace Game {
         static const Status IN_PROGRESS;
         static const Status ENDED_CHECKMATE;
         static const Status ENDED_STALEMATE;
+        /**
+         * @brief Third occurrence of a position with the same player to move,
+         *        castling rights and en passant square
+         */
+        static const Status ENDED_REPETITION;
+        /**
+         * @brief 100 half-moves without a capture or a Pawn move
+         */
+        static const Status ENDED_FIFTY_MOVES;
+        /**
+         * @brief Neither player can checkmate (KvK, KNvK, Bishops on one color)
+         */
+        static const Status ENDED_INSUFFICIENT_MATERIAL;
         static const Status UNDEFINED;
 
         operator std::string() const;
 
+        /**
+         * @brief Drawn by rule while moves remain legal, e.g. when a PGN game
+         *        goes on because no player claimed the draw
+         */
+        bool isDraw() const;
+
         int hash() const;
 
         bool operator==(const Status &other) const;
@@ -37,8 +68,47 @@ namespace Game {
         bool operator!=(const Status &other) const;
     };
 
+    /**
+     * @brief Material signature of a position
+     *    - 4 bits per player and type counting its Pieces, in the order of
+     *      Pieces::Types::index(), then the Bishops on light squares
+     *    - Keys of the known endgames are looked up in a small open-addressing
+     *      table built once
+     */
+    class Material {
+      public:
+        enum class Endgame : std::uint8_t { NONE, INSUFFICIENT, KPK, KXK };
+
+        struct Entry {
+            std::uint64_t key;
+            Endgame endgame;
+            /**
+             * @brief Color of the side that can win, NNUE::Network::WHITE if none
+             */
+            int strong;
+        };
+
+        /**
+         * @brief Part of the key of one Piece, keys of Pieces are added up
+         */
+        static std::uint64_t key(int color, Pieces::Types type, Position position);
+
+        static int count(std::uint64_t key, int color, Pieces::Types type);
+
+        /**
+         * @return an entry of Endgame::NONE if the material is not a known endgame
+         */
+        static const Entry &probe(std::uint64_t key);
+    };
+
     class Board {
       public:
+        /**
+         * @brief Legal moves generated by a call: every move, captures and
+         *        promotions only, or every other move
+         */
+        enum class Generation { ALL, TACTICAL, QUIET };
+
         Board();
         Board(int nRow, int nColumn);
         ~Board();
@@ -53,34 +123,184 @@ namespace Game {
 
         const std::vector<Pieces::Piece *> &pieces() const;
 
+        Pieces::Player *turn() const;
+
+        /**
+         * @brief Target square of an en passant capture, Position() if none
+         */
+        Position enPassant() const;
+
+        /**
+         * @brief Half-moves since the last capture or Pawn move
+         */
+        int halfMoves() const;
+
+        /**
+         * @brief Number of the current full move, starting at 1
+         */
+        int fullMoves() const;
+
         void initialize(Pieces::Player &first, Pieces::Player &second);
 
+        /**
+         * @brief Set up the position described by a FEN record
+         *    - The first Player owns the uppercase pieces and the first row
+         *    - Castling rights, Pawns on their initial row and en passant are
+         *      restored through the Pieces' number of moves
+         *    - Pieces of a previous position are recycled instead of reallocated
+         * @throw std::runtime_error if the record is malformed or a side
+         *        doesn't have exactly one King, the position is then unchanged
+         */
+        void initialize(Pieces::Player &first, Pieces::Player &second, std::string_view fen);
+
+        std::string fen() const;
+
+        /**
+         * @brief Castling rights as in FEN ("KQkq"), "-" if none
+         */
+        std::string castlingRights() const;
+
+        /**
+         * @brief Material signature, see Material
+         *    - Updated by the moves, recomputed when the Board is initialized
+         */
+        std::uint64_t materialKey() const;
+
+        /**
+         * @brief Zobrist key of the position
+         *    - Pieces on their squares, player to move, castling rights and
+         *      en passant square
+         *    - Equal positions get equal keys whatever their Player objects
+         */
+        std::uint64_t hash() const;
+
         void move(Pieces::Piece *piece, Position to);
 
+        /**
+         * @brief Play a move taken from legalMoves() without validating it again
+         *    - Moves are accepted IN_PROGRESS and in drawn statuses
+         */
+        void move(const Pieces::Move &move);
+
         void unMove();
 
         void reMove();
 
+        /**
+         * @brief Hand the turn to the opponent without moving any Piece
+         * @warning The move is not part of the history, it must be undone
+         *          with unNullMove() before any other unMove()
+         */
+        void nullMove();
+
+        void unNullMove();
+
+        /**
+         * @brief Moves of the player to move that don't leave its King threatened
+         *    - Ordered by the Board's piece order then by destination
+         *    - A Pawn reaching the last row yields one Move per promotion
+         *      (QUEEN, ROOK, BISHOP, KNIGHT)
+         */
+        std::vector<Pieces::Move> legalMoves();
+
+        /**
+         * @brief Legal moves of one generation written to a caller buffer, in
+         *        the order of legalMoves()
+         *    - The moves of the other generation are not checked for legality
+         * @return The number of moves written
+         * @throw std::runtime_error if there are more than capacity moves
+         */
+        std::size_t legalMoves(Generation generation, Pieces::Move *moves, std::size_t capacity);
+
+        /**
+         * @brief Whether the move is in legalMoves(), generating only the
+         *        moves of its Piece, e.g. to check a move from another node
+         */
+        bool isPlayable(const Pieces::Move &move);
+
+        bool isInCheck();
+
+        /**
+         * @brief Earlier occurrences of the current position
+         *    - Only the keys since the last capture or Pawn move are compared,
+         *      every other ply since positions alternate the player to move
+         */
+        int repetitions() const;
+
+        /**
+         * @brief Position that the side ahead can't win with best play, as
+         *        far as the material table and the embedded bitbases know
+         *    - Insufficient material also ends the game, other draws like
+         *      King and Pawn against King leave the status untouched
+         */
+        bool isKnownDraw() const;
+
+        std::vector<Pieces::Piece *> attackers(const Position &square,
+                                               const Pieces::Player *player) const;
+
+        /**
+         * @brief Static exchange evaluation of a capture
+         * @return The material balance of the exchange on the destination for
+         *         the moving player, with every recapture done by the least
+         *         valuable attacker
+         */
+        int see(const Pieces::Move &move) const;
+
         std::unordered_map<Position, Pieces::Piece *> promotions(Pieces::Piece *piece);
 
         void promote(Pieces::Piece *piece, Pieces::Types promotion);
 
         std::vector<std::vector<Pieces::Piece *>> serialize() const;
 
+        void network(const NNUE::Network *network);
+
+        const NNUE::Network *network() const;
+
+        const NNUE::Accumulator &accumulator() const;
+
+        int color(const Pieces::Piece *piece) const;
+
+        int color(const Pieces::Player *player) const;
+
       private:
+        struct State {
+            Status status;
+            Position enPassant;
+            int halfMoves;
+        };
+
+        // Ring of the Zobrist keys of the last positions, a power of two above
+        // the 100 half-moves of the fifty-move rule
+        static constexpr int N_KEYS = 128;
+
         std::pair<int, int> _boundaries;
         int _nMoves;
         Status _status;
         Utils::Templates::UndoRedo<Pieces::Move> _moves;
         std::vector<Pieces::Piece *> _pieces;
+        std::pair<Pieces::Player *, Pieces::Player *> _players;
+        Pieces::Player *_turn;
+        Position _enPassant;
+        int _halfMoves;
+        int _initialPly;
+        std::vector<State> _states;
+        std::array<std::uint64_t, N_KEYS> _keys;
+        int _nKeys;
+        std::uint64_t _materialKey;
+        std::vector<Pieces::Move> _legalMoves;
+        bool _isLegalMovesCached;
+        const NNUE::Network *_network;
+        NNUE::Accumulator _accumulator;
+
+        void updateStatus();
 
-        void updateStatus(Pieces::Player &player);
+        void pushState(const Pieces::Move &move);
 
-        bool opponentKingIsLastPiece(Pieces::Player &player);
+        void popState();
 
-        bool opponentKingHasMoves(Pieces::Player &player);
+        void pushKey();
 
-        bool isOpponentKingThreatened(Pieces::Player &player);
+        void clearKeys();
 
         std::vector<Pieces::Piece *> initializePieces(Pieces::Player &player, bool isFirstPlayer);
 
@@ -94,15 +314,54 @@ namespace Game {
         std::vector<Pieces::Action> actions(Pieces::Piece *piece, Position &to,
                                             std::unordered_map<Position, Pieces::Move> &moves);
 
+        void play(const Pieces::Move &move);
+
         void playMove(Pieces::Player &player, std::vector<Pieces::Action> &actions);
 
-        void unPlayMove();
+        void unPlayMove(Pieces::Move &move);
+
+        bool isLegal(const Pieces::Move &move);
+
+        void generateLegalMoves(std::vector<Pieces::Move> &legalMoves, std::size_t limit);
+
+        /**
+         * @brief Call sink with each legal move of the generation, of the
+         *        given Piece only if any, until sink returns false
+         */
+        template <typename Sink>
+        void generateLegalMoves(Generation generation, const Pieces::Piece *only, Sink &&sink);
+
+        void addEnPassant(std::vector<Pieces::Move> &moves, Pieces::Piece *pawn,
+                          std::unordered_map<Position, Pieces::Piece *> &opponents) const;
+
+        std::vector<Pieces::Move> expandPromotions(const Pieces::Move &move);
+
+        Pieces::Piece *sparePiece(Pieces::Player *player, Pieces::Types type);
+
+        Pieces::Player *opponent(const Pieces::Player *player) const;
+
+        Pieces::Piece *king(const Pieces::Player *player) const;
+
+        Pieces::Piece *recyclePiece(std::size_t &cursor, Pieces::Player *player,
+                                    Pieces::Types type, std::vector<Pieces::Piece *> &pieces);
+
+        bool hasCastlingRight(const Pieces::Player *player, int column) const;
+
+        std::vector<Pieces::Piece *> mailbox() const;
+
+        bool isAttacked(const std::vector<Pieces::Piece *> &mailbox, const Position &square,
+                        const Pieces::Player *player,
+                        std::vector<Pieces::Piece *> *attackers = nullptr) const;
+
+        void refreshAccumulator();
+
+        void updateAccumulator(const Pieces::Piece *piece, Position from, Position to);
+
+        void refreshMaterial();
 
-        static Pieces::Piece *findKing(std::unordered_map<Position, Pieces::Piece *> pieces);
+        void updateMaterial(const Pieces::Piece *piece, Position from, Position to);
 
-        static std::vector<Pieces::Piece *> findPieces(std::vector<Pieces::Piece *> pieces,
-                                                       Pieces::Types type,
-                                                       bool throwNotFound = false);
+        static int square(const Position &position);
     };
 
     class Game {
@@ -126,8 +385,34 @@ namespace Game {
         std::vector<std::vector<Pieces::Piece *>> board() const;
 
         void start(std::string &player1, std::string &player2);
+        void start(std::string &player1, std::string &player2, const std::string &fen);
+        std::string fen() const;
         Status status() const;
         std::vector<std::vector<Pieces::Piece *>> move(Position from, Position to);
+        /**
+         * @brief Play a move written in SAN ("Nf3") or LAN ("g1f3")
+         * @return the notation of the played move in SAN
+         */
+        std::string move(std::string_view notation);
+        /**
+         * @brief Play a move written in SAN or LAN without writing it back,
+         *        for replaying games in bulk
+         */
+        void play(std::string_view notation);
+        /**
+         * @brief Set up a new game on the Board and Players of a started game
+         */
+        void restart(std::string_view fen);
+        /**
+         * @brief Result as in PGN: "1-0", "0-1", "1/2-1/2" or "*" if the game
+         *        is not over
+         */
+        std::string result() const;
+        /**
+         * @brief Games of the index that reached the current position, with the
+         *        moves played next written in SAN
+         */
+        Explorer::Stats explore(const Explorer::Index &index) const;
     };
 }; // namespace Game
 
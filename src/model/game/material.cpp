@@ -0,0 +1,128 @@
+#include "game.hpp"
+
+namespace Game {
+    namespace {
+        constexpr int N_SLOTS = 8;
+        constexpr int LIGHT_BISHOPS = 6;
+        constexpr std::size_t TABLE_SIZE = 256;
+
+        /**
+         * @brief Key of one player's pieces: "K", "Q", "R", "N", "P", then "L"
+         *        and "D" for Bishops on light and dark squares
+         */
+        std::uint64_t keyOf(int color, std::string_view pieces) {
+            std::uint64_t key = 0;
+            for (char letter : pieces) {
+                switch (letter) {
+                case 'K':
+                    key += Material::key(color, Pieces::Types::KING, Position());
+                    break;
+                case 'Q':
+                    key += Material::key(color, Pieces::Types::QUEEN, Position());
+                    break;
+                case 'R':
+                    key += Material::key(color, Pieces::Types::ROOK, Position());
+                    break;
+                case 'N':
+                    key += Material::key(color, Pieces::Types::KNIGHT, Position());
+                    break;
+                case 'P':
+                    key += Material::key(color, Pieces::Types::PAWN, Position());
+                    break;
+                case 'L':
+                    key += Material::key(color, Pieces::Types::BISHOP, Position(0, 1));
+                    break;
+                case 'D':
+                    key += Material::key(color, Pieces::Types::BISHOP, Position(0, 0));
+                    break;
+                default:
+                    throw std::runtime_error("Unknown material letter: letter='" +
+                                             std::string(1, letter) + "'");
+                }
+            }
+            return key;
+        }
+
+        std::size_t slot(std::uint64_t key) {
+            return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> 56) % TABLE_SIZE;
+        }
+
+        class Table {
+          public:
+            Table()
+                : _entries() {
+                for (auto &entry : this->_entries) entry = {0, Material::Endgame::NONE, 0};
+
+                this->addBoth("K", "K", Material::Endgame::INSUFFICIENT);
+                this->addBoth("KN", "K", Material::Endgame::INSUFFICIENT);
+                // Bishops on squares of one color never reach a checkmate
+                for (std::string bishop : {"L", "D"}) {
+                    for (int white = 0; white <= 2; ++white) {
+                        for (int black = 0; black <= 2; ++black) {
+                            if (white + black == 0) continue;
+
+                            std::string first = "K", second = "K";
+                            for (int i = 0; i < white; ++i) first += bishop;
+                            for (int i = 0; i < black; ++i) second += bishop;
+                            this->add(keyOf(NNUE::Network::WHITE, first) +
+                                          keyOf(NNUE::Network::BLACK, second),
+                                      Material::Endgame::INSUFFICIENT, NNUE::Network::WHITE);
+                        }
+                    }
+                }
+
+                this->addBoth("KP", "K", Material::Endgame::KPK);
+                for (auto strong : {"KQ", "KR", "KLD", "KLN", "KDN"}) {
+                    this->addBoth(strong, "K", Material::Endgame::KXK);
+                }
+            }
+
+            const Material::Entry &probe(std::uint64_t key) const {
+                static const Material::Entry none{0, Material::Endgame::NONE, 0};
+                for (std::size_t i = slot(key);; i = (i + 1) % TABLE_SIZE) {
+                    auto &entry = this->_entries[i];
+                    if (entry.key == key && key != 0) return entry;
+
+                    if (entry.key == 0) return none;
+                }
+            }
+
+          private:
+            std::array<Material::Entry, TABLE_SIZE> _entries;
+
+            void add(std::uint64_t key, Material::Endgame endgame, int strong) {
+                std::size_t i = slot(key);
+                while (this->_entries[i].key != 0 && this->_entries[i].key != key) {
+                    i = (i + 1) % TABLE_SIZE;
+                }
+                this->_entries[i] = {key, endgame, strong};
+            }
+
+            void addBoth(std::string_view strong, std::string_view weak,
+                         Material::Endgame endgame) {
+                this->add(keyOf(NNUE::Network::WHITE, strong) + keyOf(NNUE::Network::BLACK, weak),
+                          endgame, NNUE::Network::WHITE);
+                this->add(keyOf(NNUE::Network::BLACK, strong) + keyOf(NNUE::Network::WHITE, weak),
+                          endgame, NNUE::Network::BLACK);
+            }
+        };
+    } // namespace
+
+    std::uint64_t Material::key(int color, Pieces::Types type, Position position) {
+        int shift = 4 * color * N_SLOTS;
+        std::uint64_t key = std::uint64_t(1) << (shift + 4 * type.index());
+        if (type == Pieces::Types::BISHOP && (position.row() + position.column()) % 2 != 0) {
+            key += std::uint64_t(1) << (shift + 4 * LIGHT_BISHOPS);
+        }
+        return key;
+    }
+
+    int Material::count(std::uint64_t key, int color, Pieces::Types type) {
+        return static_cast<int>((key >> (4 * (color * N_SLOTS + type.index()))) & 15);
+    }
+
+    const Material::Entry &Material::probe(std::uint64_t key) {
+        static const Table table;
+        return table.probe(key);
+    }
+} // namespace Game
@@ -5,6 +5,10 @@ namespace Game {
     const Status Status::IN_PROGRESS = Status(Status::_Status::IN_PROGRESS);
     const Status Status::ENDED_CHECKMATE = Status(Status::_Status::ENDED_CHECKMATE);
     const Status Status::ENDED_STALEMATE = Status(Status::_Status::ENDED_STALEMATE);
+    const Status Status::ENDED_REPETITION = Status(Status::_Status::ENDED_REPETITION);
+    const Status Status::ENDED_FIFTY_MOVES = Status(Status::_Status::ENDED_FIFTY_MOVES);
+    const Status Status::ENDED_INSUFFICIENT_MATERIAL =
+        Status(Status::_Status::ENDED_INSUFFICIENT_MATERIAL);
     const Status Status::UNDEFINED = Status(Status::_Status::UNDEFINED);
 
     Status::Status()
@@ -22,6 +26,12 @@ namespace Game {
             return "ENDED_CHECKMATE";
         case _Status::ENDED_STALEMATE:
             return "ENDED_STALEMATE";
+        case _Status::ENDED_REPETITION:
+            return "ENDED_REPETITION";
+        case _Status::ENDED_FIFTY_MOVES:
+            return "ENDED_FIFTY_MOVES";
+        case _Status::ENDED_INSUFFICIENT_MATERIAL:
+            return "ENDED_INSUFFICIENT_MATERIAL";
         case _Status::UNDEFINED:
             return "UNDEFINED";
         default:
@@ -30,6 +40,12 @@ namespace Game {
         }
     }
 
+    bool Status::isDraw() const {
+        return this->_status == _Status::ENDED_REPETITION ||
+               this->_status == _Status::ENDED_FIFTY_MOVES ||
+               this->_status == _Status::ENDED_INSUFFICIENT_MATERIAL;
+    }
+
     int Status::hash() const { return static_cast<int>(this->_status) << 1; }
 
     bool Status::operator==(const Status &other) const { return this->hash() == other.hash(); }
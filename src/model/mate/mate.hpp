@@ -0,0 +1,161 @@
+#ifndef MATE_HPP
+#define MATE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "model/game/game.hpp"
+
+/**
+ * @brief Mate in N solver by depth-first proof-number search (df-pn)
+ *    - The player to move is the attacker, a position is proven when every
+ *      defence is checkmated within N of the attacker's moves
+ *    - Proof and disproof numbers are kept in a bounded table, the entries
+ *      that cost the least work to find again are collected when it is full
+ */
+namespace Mate {
+    // Proof and disproof numbers saturate at INFINITE
+    constexpr std::uint32_t INFINITE = 1U << 30;
+
+    struct Entry {
+        std::uint32_t pn = 1;
+        std::uint32_t dn = 1;
+        // Nodes searched below the position, the cost of finding it again
+        std::uint64_t work = 0;
+    };
+
+    class Table {
+      public:
+        explicit Table(std::size_t capacity);
+
+        /**
+         * @return false if the key is not stored
+         */
+        bool probe(std::uint64_t key, Entry &entry) const;
+
+        /**
+         * @brief Store an entry, collecting half of the table first when it is full
+         */
+        void store(std::uint64_t key, const Entry &entry);
+
+        void clear();
+
+        std::size_t size() const;
+        std::size_t capacity() const;
+
+        /**
+         * @brief Entries dropped by the collections since the table was cleared
+         */
+        std::size_t nCollected() const;
+
+      private:
+        std::unordered_map<std::uint64_t, Entry> _entries;
+        std::size_t _capacity;
+        std::size_t _nCollected;
+
+        /**
+         * @brief Drop the unsolved entries with the least work first, then
+         *        the solved ones with the least work
+         */
+        void collect();
+    };
+
+    /**
+     * @brief A move in SAN and the moves answering it
+     *    - After an attacker's move: every defence
+     *    - After a defender's move: the attacker's mating continuation
+     */
+    struct Line {
+        std::string move;
+        std::vector<Line> replies;
+    };
+
+    enum class Verdict { PROVEN, DISPROVEN, UNKNOWN };
+
+    struct Result {
+        Verdict verdict = Verdict::UNKNOWN;
+        // Attacker's moves of the proven mate
+        int moves = 0;
+        // The key move and its defences, empty unless proven
+        std::vector<Line> solution;
+        std::uint64_t nodes = 0;
+        std::chrono::duration<double> elapsed{0};
+
+        double nodesPerSecond() const;
+    };
+
+    class Solver {
+      public:
+        struct Options {
+            // Table entries, about 64 bytes each
+            std::size_t tableSize = std::size_t(1) << 20;
+            // 0 for no limit, UNKNOWN is returned once it is reached
+            std::uint64_t maxNodes = 0;
+            // Try mate in 1, 2, ... up to N to prove the shortest mate
+            bool isShortest = true;
+        };
+
+        Solver();
+        explicit Solver(Options options);
+
+        /**
+         * @throw std::runtime_error if the FEN is malformed
+         */
+        Result solve(std::string_view fen, int moves);
+
+        /**
+         * @brief Prove or disprove a mate in moves for the player to move
+         *    - Positions repeated along a line are draws for the attacker
+         */
+        Result solve(Game::Board &board, int moves);
+
+        /**
+         * @brief One line per move with numbered moves ("1. Ra8#"), defences
+         *        indented below the move they answer
+         */
+        static std::string format(const std::vector<Line> &solution);
+
+        const Table &table() const;
+
+      private:
+        Options _options;
+        Table _table;
+        std::uint64_t _nodes;
+        // Options::maxNodes while solving, 0 while extracting the solution
+        std::uint64_t _maxNodes;
+        bool _isAborted;
+
+        /**
+         * @brief Search until pn >= thresholdPn or dn >= thresholdDn
+         * @param plies Plies left to the attacker's last move, odd when the
+         *        attacker is to move
+         */
+        Entry search(Game::Board &board, int plies, std::uint32_t thresholdPn,
+                     std::uint32_t thresholdDn);
+
+        /**
+         * @brief Entry of a position found solved without a search, if any
+         */
+        static bool isTerminal(Game::Board &board, int plies, Entry &entry);
+
+        /**
+         * @brief Entry of the position, proven again if it was collected
+         */
+        Entry solved(Game::Board &board, int plies);
+
+        /**
+         * @brief Moves of a proven position, the shortest mate of the attacker
+         *        and every defence
+         */
+        std::vector<Line> extract(Game::Board &board, int plies);
+
+        static std::uint64_t key(const Game::Board &board, int plies);
+    };
+} // namespace Mate
+
+#endif // MATE_HPP
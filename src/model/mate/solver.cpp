@@ -0,0 +1,228 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "model/mate/mate.hpp"
+#include "model/notation/notation.hpp"
+
+namespace Mate {
+    namespace {
+        const Entry PROVEN{0, INFINITE, 0};
+        const Entry DISPROVEN{INFINITE, 0, 0};
+
+        std::uint32_t saturate(std::uint64_t number) {
+            return static_cast<std::uint32_t>(std::min<std::uint64_t>(number, INFINITE));
+        }
+
+        /**
+         * @brief Attacker's move then each defence, with the attacker's answer on its line
+         */
+        void append(std::string &out, const Line &attack, int number, int indent) {
+            out += std::to_string(number) + ". " + attack.move + '\n';
+            for (auto &defence : attack.replies) {
+                out += std::string(indent + 2, ' ') + std::to_string(number) + "... " +
+                       defence.move + ' ';
+                if (defence.replies.empty()) {
+                    out += '\n';
+                    continue;
+                }
+                append(out, defence.replies.front(), number + 1, indent + 2);
+            }
+        }
+    } // namespace
+
+    double Result::nodesPerSecond() const {
+        if (this->elapsed.count() <= 0) return 0;
+
+        return static_cast<double>(this->nodes) / this->elapsed.count();
+    }
+
+    Solver::Solver()
+        : Solver(Options()) {}
+
+    Solver::Solver(Options options)
+        : _options(options)
+        , _table(options.tableSize)
+        , _nodes(0)
+        , _maxNodes(0)
+        , _isAborted(false) {}
+
+    Result Solver::solve(std::string_view fen, int moves) {
+        Game::Board board(8, 8);
+        Pieces::Player first("White"), second("Black");
+        board.initialize(first, second, fen);
+        return this->solve(board, moves);
+    }
+
+    Result Solver::solve(Game::Board &board, int moves) {
+        if (moves < 1) {
+            throw std::runtime_error("Mate length must be positive: moves='" +
+                                     std::to_string(moves) + "'");
+        }
+        auto start = std::chrono::steady_clock::now();
+        this->_table.clear();
+        this->_nodes = 0;
+        this->_maxNodes = this->_options.maxNodes;
+        this->_isAborted = false;
+
+        Result result;
+        for (int n = this->_options.isShortest ? 1 : moves; n <= moves; ++n) {
+            auto entry = this->search(board, 2 * n - 1, INFINITE, INFINITE);
+            if (this->_isAborted) {
+                result.verdict = Verdict::UNKNOWN;
+                break;
+            }
+            if (entry.pn == 0) {
+                result.verdict = Verdict::PROVEN;
+                result.moves = n;
+                this->_maxNodes = 0;
+                result.solution = this->extract(board, 2 * n - 1);
+                break;
+            }
+            result.verdict = Verdict::DISPROVEN;
+        }
+        result.nodes = this->_nodes;
+        result.elapsed = std::chrono::steady_clock::now() - start;
+        return result;
+    }
+
+    std::string Solver::format(const std::vector<Line> &solution) {
+        std::string out;
+        for (auto &attack : solution) append(out, attack, 1, 0);
+        return out;
+    }
+
+    const Table &Solver::table() const { return this->_table; }
+
+    Entry Solver::search(Game::Board &board, int plies, std::uint32_t thresholdPn,
+                         std::uint32_t thresholdDn) {
+        auto start = this->_nodes++;
+        if (this->_maxNodes > 0 && this->_nodes > this->_maxNodes) this->_isAborted = true;
+
+        Entry entry;
+        auto key = Solver::key(board, plies);
+        if (isTerminal(board, plies, entry)) {
+            this->_table.store(key, entry);
+            return entry;
+        }
+
+        // Children are checked once for a final position, then only looked up
+        bool isAttacker = plies % 2 == 1;
+        auto moves = board.legalMoves();
+        std::vector<std::uint64_t> keys(moves.size());
+        for (std::size_t i = 0; i < moves.size(); ++i) {
+            board.move(moves[i]);
+            keys[i] = Solver::key(board, plies - 1);
+            Entry child;
+            if (!this->_table.probe(keys[i], child) && isTerminal(board, plies - 1, child)) {
+                this->_table.store(keys[i], child);
+            }
+            board.unMove();
+        }
+
+        while (true) {
+            // The attacker needs one proven move, the defender one disproven move
+            std::uint64_t best = std::uint64_t(INFINITE) + 1, second = INFINITE, sum = 0;
+            std::size_t bestIndex = 0;
+            Entry bestChild;
+            for (std::size_t i = 0; i < moves.size(); ++i) {
+                Entry child;
+                this->_table.probe(keys[i], child);
+                std::uint64_t minimized = isAttacker ? child.pn : child.dn;
+                sum += isAttacker ? child.dn : child.pn;
+                if (minimized < best) {
+                    second = best;
+                    best = minimized;
+                    bestIndex = i;
+                    bestChild = child;
+                } else if (minimized < second) {
+                    second = minimized;
+                }
+            }
+            entry.pn = isAttacker ? saturate(best) : saturate(sum);
+            entry.dn = isAttacker ? saturate(sum) : saturate(best);
+            entry.work = this->_nodes - start;
+            this->_table.store(key, entry);
+            if (entry.pn >= thresholdPn || entry.dn >= thresholdDn || this->_isAborted) {
+                return entry;
+            }
+
+            // 1 + 1/4 times the second best, so that the search doesn't
+            // switch between two children at every step
+            auto widened = saturate(std::min<std::uint64_t>(second, INFINITE) * 5 / 4 + 1);
+            std::uint32_t childPn, childDn;
+            if (isAttacker) {
+                childPn = std::min(thresholdPn, widened);
+                childDn = saturate(std::uint64_t(thresholdDn) - entry.dn + bestChild.dn);
+            } else {
+                childDn = std::min(thresholdDn, widened);
+                childPn = saturate(std::uint64_t(thresholdPn) - entry.pn + bestChild.pn);
+            }
+            board.move(moves[bestIndex]);
+            this->search(board, plies - 1, childPn, childDn);
+            board.unMove();
+        }
+    }
+
+    bool Solver::isTerminal(Game::Board &board, int plies, Entry &entry) {
+        bool isAttacker = plies % 2 == 1;
+        auto status = board.status();
+        if (status == Game::Status::ENDED_CHECKMATE) {
+            entry = isAttacker ? DISPROVEN : PROVEN;
+            return true;
+        }
+        if (status == Game::Status::ENDED_STALEMATE || status.isDraw() || plies <= 0) {
+            entry = DISPROVEN;
+            return true;
+        }
+        return false;
+    }
+
+    Entry Solver::solved(Game::Board &board, int plies) {
+        Entry entry;
+        if (this->_table.probe(Solver::key(board, plies), entry) &&
+            (entry.pn == 0 || entry.dn == 0)) {
+            return entry;
+        }
+        return this->search(board, plies, INFINITE, INFINITE);
+    }
+
+    std::vector<Line> Solver::extract(Game::Board &board, int plies) {
+        std::vector<Line> lines;
+        Entry entry;
+        if (isTerminal(board, plies, entry)) return lines;
+
+        auto moves = board.legalMoves();
+        if (plies % 2 == 0) {
+            for (auto &move : moves) {
+                Line line{Notation::SAN::format(board, move), {}};
+                board.move(move);
+                line.replies = this->extract(board, plies - 1);
+                board.unMove();
+                lines.push_back(std::move(line));
+            }
+            return lines;
+        }
+
+        // The shortest mate: proven with the fewest plies left
+        for (int budget = 1; budget <= plies; budget += 2) {
+            for (auto &move : moves) {
+                board.move(move);
+                bool isProven = this->solved(board, budget - 1).pn == 0;
+                board.unMove();
+                if (!isProven) continue;
+
+                Line line{Notation::SAN::format(board, move), {}};
+                board.move(move);
+                line.replies = this->extract(board, budget - 1);
+                board.unMove();
+                lines.push_back(std::move(line));
+                return lines;
+            }
+        }
+        throw std::runtime_error("Mate proof is missing a move: fen='" + board.fen() + "'");
+    }
+
+    std::uint64_t Solver::key(const Game::Board &board, int plies) {
+        return board.hash() ^ (0x9E3779B97F4A7C15ULL * static_cast<std::uint64_t>(plies + 1));
+    }
+} // namespace Mate
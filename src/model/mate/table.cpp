@@ -0,0 +1,61 @@
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "model/mate/mate.hpp"
+
+namespace Mate {
+    Table::Table(std::size_t capacity)
+        : _entries()
+        , _capacity(capacity)
+        , _nCollected(0) {
+        if (capacity == 0) throw std::runtime_error("Mate table capacity must be positive");
+
+        this->_entries.reserve(capacity);
+    }
+
+    bool Table::probe(std::uint64_t key, Entry &entry) const {
+        auto it = this->_entries.find(key);
+        if (it == this->_entries.end()) return false;
+
+        entry = it->second;
+        return true;
+    }
+
+    void Table::store(std::uint64_t key, const Entry &entry) {
+        auto it = this->_entries.find(key);
+        if (it != this->_entries.end()) {
+            it->second = entry;
+            return;
+        }
+        if (this->_entries.size() >= this->_capacity) this->collect();
+
+        this->_entries.emplace(key, entry);
+    }
+
+    void Table::clear() {
+        this->_entries.clear();
+        this->_nCollected = 0;
+    }
+
+    std::size_t Table::size() const { return this->_entries.size(); }
+
+    std::size_t Table::capacity() const { return this->_capacity; }
+
+    std::size_t Table::nCollected() const { return this->_nCollected; }
+
+    void Table::collect() {
+        // Solved entries rank above every unsolved one, then by work
+        std::vector<std::pair<std::pair<bool, std::uint64_t>, std::uint64_t>> ranks;
+        ranks.reserve(this->_entries.size());
+        for (auto &[key, entry] : this->_entries) {
+            bool isSolved = entry.pn == 0 || entry.dn == 0;
+            ranks.push_back({{isSolved, entry.work}, key});
+        }
+        auto middle = ranks.begin() + static_cast<std::ptrdiff_t>(ranks.size() / 2);
+        std::nth_element(ranks.begin(), middle, ranks.end());
+        for (auto it = ranks.begin(); it != middle; ++it) this->_entries.erase(it->second);
+
+        this->_nCollected += static_cast<std::size_t>(middle - ranks.begin());
+    }
+} // namespace Mate
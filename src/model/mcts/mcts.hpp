@@ -0,0 +1,284 @@
+#ifndef MCTS_HPP
+#define MCTS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "model/search/search.hpp"
+
+/**
+ * @brief Monte Carlo tree search, an alternative to the alpha-beta Searcher
+ *    - Nodes live in a fixed-size arena and refer to their children by index,
+ *      the children of a node being consecutive
+ *    - Threads share one tree: visit counts and value sums are atomic and a
+ *      virtual loss steers the threads toward different lines
+ *    - Memory is bounded: a full arena is recycled by copying the most
+ *      visited part of the tree into a second arena of the same size
+ */
+namespace MCTS {
+    struct Node {
+        static constexpr std::uint32_t NONE = UINT32_MAX;
+        // Fixed-point unit of the value sums
+        static constexpr std::int64_t VALUE_ONE = 1 << 16;
+
+        enum State : std::uint8_t { UNEXPANDED, EXPANDING, EXPANDED, LOST, DRAWN };
+
+        // Virtual losses included while a playout is in flight
+        std::atomic<std::uint32_t> visits{0};
+        // Sum of the results, in VALUE_ONE units, for the player who moved to the node
+        std::atomic<std::int64_t> value{0};
+        // LOST and DRAWN are final positions, LOST for the player to move
+        std::atomic<State> state{UNEXPANDED};
+        std::uint32_t children = NONE;
+        std::uint16_t nChildren = 0;
+        // Index of the move in the parent's Board::legalMoves()
+        std::uint16_t move = 0;
+        float prior = 0;
+
+        /**
+         * @brief Mean result for the player who moved to the node, virtual losses included
+         */
+        double mean() const;
+    };
+
+    /**
+     * @brief Bump allocator of nodes, safe to share between threads
+     */
+    class Arena {
+      public:
+        explicit Arena(std::size_t capacity);
+
+        /**
+         * @return The index of n consecutive nodes, Node::NONE if the arena is full
+         */
+        std::uint32_t allocate(std::size_t n);
+
+        /**
+         * @brief Forget every node
+         * @warning Not synchronized: call it while no thread allocates
+         */
+        void clear();
+
+        Node &operator[](std::uint32_t index);
+        const Node &operator[](std::uint32_t index) const;
+
+        std::size_t size() const;
+        std::size_t capacity() const;
+
+      private:
+        std::unique_ptr<Node[]> _nodes;
+        std::size_t _capacity;
+        std::atomic<std::size_t> _size;
+    };
+
+    /**
+     * @brief Two arenas, the root always being the first node of the active one
+     *    - reroot() and recycle() copy what they keep to the other arena and
+     *      swap them, so that the nodes left behind are reused at once
+     * @warning Nothing but allocate() and the nodes' atomics is synchronized
+     */
+    class Tree {
+      public:
+        // Room for the root and its children whatever is recycled
+        static constexpr std::size_t MIN_CAPACITY = 1024;
+
+        /**
+         * @throw std::runtime_error if capacity is below MIN_CAPACITY
+         */
+        explicit Tree(std::size_t capacity);
+
+        /**
+         * @brief Drop every node but a new unexpanded root
+         */
+        void clear();
+
+        Node &root();
+        Node &operator[](std::uint32_t index);
+        const Node &operator[](std::uint32_t index) const;
+
+        std::uint32_t allocate(std::size_t n);
+
+        /**
+         * @brief Keep only the subtree of a node, which becomes the root
+         */
+        void reroot(std::uint32_t index);
+
+        /**
+         * @brief Keep at most half of the capacity: the children of the least
+         *        visited nodes are dropped while their statistics are kept
+         * @return The number of nodes kept
+         */
+        std::size_t recycle();
+
+        std::size_t size() const;
+        std::size_t capacity() const;
+
+      private:
+        std::unique_ptr<Arena> _active;
+        std::unique_ptr<Arena> _spare;
+
+        /**
+         * @brief Nodes kept when only the nodes visited minVisits times keep their children
+         */
+        std::size_t count(std::uint32_t index, std::uint32_t minVisits) const;
+
+        void compact(std::uint32_t index, std::uint32_t minVisits);
+    };
+
+    class Searcher {
+      public:
+        enum class Selection {
+            // Priors from the static evaluation of the children, AlphaZero-like
+            PUCT,
+            // Uniform exploration, UCB1
+            UCT
+        };
+
+        enum class Playout {
+            // Logistic of the static evaluation of the leaf
+            EVALUATION,
+            // Random moves then the evaluation of the final position
+            ROLLOUT
+        };
+
+        struct Options {
+            std::size_t nThreads = 0;
+            // Nodes of each of the two arenas, about 32 bytes per node
+            std::size_t capacity = std::size_t(1) << 18;
+            Selection selection = Selection::PUCT;
+            Playout playout = Playout::EVALUATION;
+            double exploration = 1.5;
+            std::uint32_t virtualLoss = 3;
+            int rolloutPlies = 8;
+            // Softmax temperature of the priors, in centipawns
+            double temperature = 100;
+            // Centipawns per factor 10 in the odds of winning
+            double scale = 400;
+            std::uint64_t seed = 0;
+            // Keep the subtree of the new position when it was already searched
+            bool isReused = true;
+        };
+
+        using Limits = Search::Searcher::Limits;
+        using Result = Search::Searcher::Result;
+        using Listener = Search::Searcher::Listener;
+
+        Searcher();
+        explicit Searcher(Options options);
+        ~Searcher();
+
+        Options options() const;
+        /**
+         * @brief Also drops the tree
+         */
+        void options(Options options);
+
+        /**
+         * @brief Run playouts until a limit is reached or stop() is called
+         *    - limits.nodes counts playouts, limits.depth stops the search once
+         *      the principal variation is that long or ends in a checkmate
+         *    - The move is the most visited one, the score is derived from
+         *      its mean result and the depth is the length of the principal
+         *      variation
+         *    - The listener is called about once a second and with the result
+         *    - Positions before the board's first searched position are not
+         *      known to the tree, so that repetitions of them are missed
+         */
+        Result search(Game::Board &board, const Limits &limits, const Listener &listener = {});
+
+        /**
+         * @brief Reset the stop flag and the deadline before starting a search
+         *        on another thread, as Search::Searcher::prepare() does
+         */
+        void prepare(const Limits &limits);
+
+        /**
+         * @brief Abort the running search, safe to call from any thread
+         */
+        void stop();
+
+        /**
+         * @brief Move the time limit of the running search to now + time
+         */
+        void deadline(std::chrono::milliseconds time);
+
+        /**
+         * @brief Forget the tree, e.g. between two games
+         */
+        void clear();
+
+        const Tree &tree() const;
+
+        /**
+         * @brief Playouts of the last search
+         */
+        std::uint64_t playouts() const;
+
+        /**
+         * @brief Times the arena was recycled since the tree was created
+         */
+        std::size_t nRecycled() const;
+
+      private:
+        struct Worker;
+
+        Options _options;
+        Tree _tree;
+        // Position of the root: a FEN then move indexes, as replayed by the workers
+        std::string _fen;
+        std::vector<std::uint16_t> _path;
+        std::unique_ptr<Worker> _root;
+        std::atomic<bool> _isStopped;
+        std::atomic<bool> _isFull;
+        // steady_clock ticks, 0 for no deadline
+        std::atomic<std::int64_t> _deadline;
+        // Set by prepare() until the next search starts
+        bool _isPrepared;
+        std::atomic<std::uint64_t> _nPlayouts;
+        std::uint64_t _maxPlayouts;
+        int _maxDepth;
+        std::size_t _nRecycled;
+
+        /**
+         * @brief Move the root to the board's position, within two plies of
+         *        the previous root, or start a new tree
+         */
+        void reuse(const Game::Board &board);
+
+        void work(Worker &worker, Game::Board &board, const Listener &listener,
+                  bool isReporting);
+
+        void playout(Worker &worker);
+
+        std::uint32_t select(const Node &parent) const;
+
+        /**
+         * @brief Create the children of a leaf, or mark it as final
+         * @return false if another thread expands it or the arena is full
+         */
+        bool expand(Worker &worker, Node &node, bool isRoot);
+
+        /**
+         * @brief Result of the leaf for the player to move, from 0 (lost) to 1 (won)
+         */
+        double evaluate(Worker &worker);
+
+        double value(const Game::Board &board) const;
+
+        /**
+         * @brief Most visited line from the root, as node indexes
+         */
+        std::vector<std::uint32_t> principal() const;
+
+        Result result(Game::Board &board) const;
+
+        bool isStopped();
+    };
+} // namespace MCTS
+
+#endif // MCTS_HPP
@@ -0,0 +1,459 @@
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include "model/mcts/mcts.hpp"
+#include "model/notation/notation.hpp"
+
+namespace MCTS {
+    namespace {
+        constexpr auto REPORT_INTERVAL = std::chrono::seconds(1);
+        // Playouts between two checks of the depth limit
+        constexpr std::uint64_t DEPTH_INTERVAL = 64;
+        // First play urgency: unvisited children are assumed a bit worse than their parent
+        constexpr double FPU_REDUCTION = 0.1;
+        // Bounds of the mean results turned into scores, about ±1600 centipawns
+        constexpr double MIN_MEAN = 1e-4;
+
+        bool isFinal(const Node &node) {
+            auto state = node.state.load(std::memory_order_acquire);
+            return state == Node::LOST || state == Node::DRAWN;
+        }
+
+        /**
+         * @brief Child with the most visits, the best mean among them
+         */
+        std::uint32_t mostVisited(const Tree &tree, const Node &node) {
+            std::uint32_t best = node.children;
+            for (std::uint32_t i = 1; i < node.nChildren; ++i) {
+                auto &child = tree[node.children + i];
+                auto &other = tree[best];
+                auto visits = child.visits.load(), bestVisits = other.visits.load();
+                if (visits > bestVisits || (visits == bestVisits && child.mean() > other.mean())) {
+                    best = node.children + i;
+                }
+            }
+            return best;
+        }
+    } // namespace
+
+    struct Searcher::Worker {
+        Pieces::Player first;
+        Pieces::Player second;
+        Game::Board board;
+        std::mt19937_64 generator;
+        // Nodes from the root to the leaf of the running playout
+        std::vector<std::uint32_t> path;
+
+        Worker(std::pair<int, int> boundaries, std::uint64_t seed)
+            : first("White")
+            , second("Black")
+            , board(boundaries.first, boundaries.second)
+            , generator(seed)
+            , path() {}
+
+        /**
+         * @brief Set up the position of a FEN then move indexes
+         */
+        void replay(const std::string &fen, const std::vector<std::uint16_t> &path,
+                    const NNUE::Network *network) {
+            this->board.initialize(this->first, this->second, fen);
+            this->board.network(network);
+            for (auto index : path) this->board.move(this->board.legalMoves()[index]);
+        }
+    };
+
+    Searcher::Searcher()
+        : Searcher(Options()) {}
+
+    Searcher::Searcher(Options options)
+        : _options(options)
+        , _tree(options.capacity)
+        , _fen()
+        , _path()
+        , _root()
+        , _isStopped(false)
+        , _isFull(false)
+        , _deadline(0)
+        , _isPrepared(false)
+        , _nPlayouts(0)
+        , _maxPlayouts(0)
+        , _maxDepth(Search::MAX_PLY - 1)
+        , _nRecycled(0) {}
+
+    Searcher::~Searcher() = default;
+
+    Searcher::Options Searcher::options() const { return this->_options; }
+
+    void Searcher::options(Options options) {
+        this->_tree = Tree(options.capacity);
+        this->_options = options;
+        this->clear();
+    }
+
+    Searcher::Result Searcher::search(Game::Board &board, const Limits &limits,
+                                      const Listener &listener) {
+        if (!this->_isPrepared) this->prepare(limits);
+        this->_isPrepared = false;
+        this->_nPlayouts = 0;
+        this->_maxPlayouts = limits.nodes;
+        this->_maxDepth = limits.depth;
+
+        if (board.legalMoves().empty()) {
+            int score = (board.status() == Game::Status::ENDED_CHECKMATE) ? -Search::MATE : 0;
+            return {Pieces::Move(), score, 0, 0};
+        }
+        this->reuse(board);
+
+        std::size_t nThreads = this->_options.nThreads;
+        if (nThreads == 0) nThreads = std::max(1U, std::thread::hardware_concurrency());
+        std::vector<std::unique_ptr<Worker>> workers;
+        for (std::size_t id = 0; id < nThreads; ++id) {
+            auto seed = this->_options.seed ^ (0x9E3779B97F4A7C15ULL * (id + 1));
+            workers.push_back(std::make_unique<Worker>(board.boundaries(), seed));
+            workers.back()->replay(this->_fen, this->_path, board.network());
+        }
+
+        std::mutex mutex;
+        std::exception_ptr failure;
+        while (true) {
+            this->_isFull = false;
+            std::vector<std::thread> threads;
+            threads.reserve(nThreads);
+            for (std::size_t id = 0; id < nThreads; ++id) {
+                threads.emplace_back([&, id]() {
+                    try {
+                        this->work(*workers[id], board, listener, id == 0);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!failure) failure = std::current_exception();
+                        this->_isStopped = true;
+                    }
+                });
+            }
+            for (auto &thread : threads) thread.join();
+
+            if (failure) std::rethrow_exception(failure);
+
+            if (!this->_isFull || this->_isStopped) break;
+
+            this->_tree.recycle();
+            this->_nRecycled++;
+        }
+
+        auto result = this->result(board);
+        if (listener) listener(result);
+
+        return result;
+    }
+
+    void Searcher::prepare(const Limits &limits) {
+        this->_isStopped = false;
+        this->_deadline = 0;
+        if (limits.time.count() > 0) this->deadline(limits.time);
+        this->_isPrepared = true;
+    }
+
+    void Searcher::stop() { this->_isStopped = true; }
+
+    void Searcher::deadline(std::chrono::milliseconds time) {
+        this->_deadline = (std::chrono::steady_clock::now() + time).time_since_epoch().count();
+    }
+
+    void Searcher::clear() {
+        this->_tree.clear();
+        this->_fen.clear();
+        this->_path.clear();
+        this->_root.reset();
+        this->_nRecycled = 0;
+    }
+
+    const Tree &Searcher::tree() const { return this->_tree; }
+
+    std::uint64_t Searcher::playouts() const { return this->_nPlayouts; }
+
+    std::size_t Searcher::nRecycled() const { return this->_nRecycled; }
+
+    void Searcher::reuse(const Game::Board &board) {
+        auto key = board.hash();
+        if (this->_options.isReused && this->_root != nullptr &&
+            this->_root->board.boundaries() == board.boundaries()) {
+            auto &rootBoard = this->_root->board;
+            if (rootBoard.hash() == key) return;
+
+            auto &tree = this->_tree;
+            auto &root = tree.root();
+            if (root.state.load() == Node::EXPANDED) {
+                auto moves = rootBoard.legalMoves();
+                for (std::uint32_t i = 0; i < root.nChildren; ++i) {
+                    auto index = root.children + i;
+                    auto &child = tree[index];
+                    rootBoard.move(moves[child.move]);
+                    if (rootBoard.hash() == key) {
+                        this->_path.push_back(child.move);
+                        return tree.reroot(index);
+                    }
+                    if (child.state.load() == Node::EXPANDED) {
+                        auto replies = rootBoard.legalMoves();
+                        for (std::uint32_t j = 0; j < child.nChildren; ++j) {
+                            auto &grandChild = tree[child.children + j];
+                            rootBoard.move(replies[grandChild.move]);
+                            if (rootBoard.hash() == key) {
+                                this->_path.push_back(child.move);
+                                this->_path.push_back(grandChild.move);
+                                return tree.reroot(child.children + j);
+                            }
+                            rootBoard.unMove();
+                        }
+                    }
+                    rootBoard.unMove();
+                }
+            }
+        }
+
+        this->_fen = board.fen();
+        this->_path.clear();
+        this->_tree.clear();
+        this->_root = std::make_unique<Worker>(board.boundaries(), this->_options.seed);
+        this->_root->replay(this->_fen, this->_path, nullptr);
+    }
+
+    void Searcher::work(Worker &worker, Game::Board &board, const Listener &listener,
+                        bool isReporting) {
+        auto reported = std::chrono::steady_clock::now();
+        while (!this->_isFull.load(std::memory_order_relaxed) && !this->isStopped()) {
+            auto n = this->_nPlayouts.fetch_add(1, std::memory_order_relaxed);
+            if (this->_maxPlayouts > 0 && n >= this->_maxPlayouts) {
+                this->_nPlayouts.fetch_sub(1, std::memory_order_relaxed);
+                this->_isStopped = true;
+                break;
+            }
+            this->playout(worker);
+
+            if (!isReporting) continue;
+
+            if (n % DEPTH_INTERVAL == 0) {
+                auto line = this->principal();
+                auto &last = this->_tree[line.back()];
+                if (static_cast<int>(line.size()) - 1 >= this->_maxDepth ||
+                    last.state.load() == Node::LOST) {
+                    this->_isStopped = true;
+                }
+            }
+            auto now = std::chrono::steady_clock::now();
+            if (listener && now - reported >= REPORT_INTERVAL) {
+                listener(this->result(board));
+                reported = now;
+            }
+        }
+    }
+
+    void Searcher::playout(Worker &worker) {
+        auto &tree = this->_tree;
+        auto &board = worker.board;
+        auto &path = worker.path;
+        std::uint32_t virtualLoss = std::max<std::uint32_t>(this->_options.virtualLoss, 1);
+
+        path.assign(1, 0);
+        tree.root().visits.fetch_add(virtualLoss, std::memory_order_relaxed);
+        auto *node = &tree.root();
+        int nPlayed = 0;
+        // For the player to move at the leaf
+        double value;
+        while (true) {
+            auto state = node->state.load(std::memory_order_acquire);
+            if (state == Node::LOST || state == Node::DRAWN) {
+                value = (state == Node::LOST) ? 0.0 : 0.5;
+                break;
+            }
+            if (state == Node::EXPANDING && !this->_isStopped.load(std::memory_order_relaxed)) {
+                // Waiting is cheaper than evaluating the same leaf twice
+                std::this_thread::yield();
+                continue;
+            }
+            if (state != Node::EXPANDED) {
+                // A final position found by the expansion is scored as such
+                if (state == Node::UNEXPANDED && this->expand(worker, *node, nPlayed == 0) &&
+                    isFinal(*node)) {
+                    continue;
+                }
+                value = this->evaluate(worker);
+                break;
+            }
+
+            auto index = this->select(*node);
+            auto &child = tree[index];
+            child.visits.fetch_add(virtualLoss, std::memory_order_relaxed);
+            board.move(board.legalMoves()[child.move]);
+            nPlayed++;
+            path.push_back(index);
+            node = &child;
+        }
+        for (; nPlayed > 0; --nPlayed) board.unMove();
+
+        // Each node scores the result for the player who moved to it
+        double result = 1.0 - value;
+        for (auto it = path.rbegin(); it != path.rend(); ++it) {
+            auto &visited = tree[*it];
+            auto fixed = std::llround(result * static_cast<double>(Node::VALUE_ONE));
+            visited.value.fetch_add(fixed, std::memory_order_relaxed);
+            visited.visits.fetch_sub(virtualLoss - 1, std::memory_order_relaxed);
+            result = 1.0 - result;
+        }
+    }
+
+    std::uint32_t Searcher::select(const Node &parent) const {
+        double nParent = std::max<std::uint32_t>(parent.visits.load(std::memory_order_relaxed), 1);
+        double exploration = this->_options.exploration;
+        double sqrtParent = std::sqrt(nParent), logParent = std::log(nParent);
+        double urgency = 1.0 - parent.mean() - FPU_REDUCTION;
+        bool isPuct = this->_options.selection == Selection::PUCT;
+
+        std::uint32_t best = parent.children;
+        double bestScore = -std::numeric_limits<double>::infinity();
+        for (std::uint32_t i = 0; i < parent.nChildren; ++i) {
+            auto &child = this->_tree[parent.children + i];
+            auto n = child.visits.load(std::memory_order_relaxed);
+            if (!isPuct && n == 0) return parent.children + i;
+
+            double mean = (n == 0) ? urgency : child.mean();
+            double score = isPuct ? mean + exploration * child.prior * sqrtParent / (1 + n)
+                                  : mean + exploration * std::sqrt(logParent / n);
+            if (score > bestScore) {
+                bestScore = score;
+                best = parent.children + i;
+            }
+        }
+        return best;
+    }
+
+    bool Searcher::expand(Worker &worker, Node &node, bool isRoot) {
+        auto expected = Node::UNEXPANDED;
+        if (!node.state.compare_exchange_strong(expected, Node::EXPANDING,
+                                                std::memory_order_acq_rel)) {
+            return false;
+        }
+
+        auto &board = worker.board;
+        auto status = board.status();
+        auto moves = board.legalMoves();
+        if (moves.empty() || (!isRoot && status.isDraw())) {
+            bool isLost = moves.empty() && status == Game::Status::ENDED_CHECKMATE;
+            node.state.store(isLost ? Node::LOST : Node::DRAWN, std::memory_order_release);
+            return true;
+        }
+
+        auto children = this->_tree.allocate(moves.size());
+        if (children == Node::NONE) {
+            this->_isFull = true;
+            node.state.store(Node::UNEXPANDED, std::memory_order_release);
+            return false;
+        }
+
+        std::vector<double> priors(moves.size(), 1.0);
+        if (this->_options.selection == Selection::PUCT) {
+            double best = -std::numeric_limits<double>::infinity();
+            for (std::size_t i = 0; i < moves.size(); ++i) {
+                board.move(moves[i]);
+                priors[i] = (board.status() == Game::Status::ENDED_CHECKMATE)
+                                ? Search::KNOWN_WIN
+                                : -Search::Evaluation::evaluate(board);
+                board.unMove();
+                best = std::max(best, priors[i]);
+            }
+            for (auto &prior : priors) {
+                prior = std::exp((prior - best) / this->_options.temperature);
+            }
+        }
+        double sum = 0;
+        for (auto prior : priors) sum += prior;
+
+        for (std::size_t i = 0; i < moves.size(); ++i) {
+            auto &child = this->_tree[static_cast<std::uint32_t>(children + i)];
+            child.visits.store(0, std::memory_order_relaxed);
+            child.value.store(0, std::memory_order_relaxed);
+            child.state.store(Node::UNEXPANDED, std::memory_order_relaxed);
+            child.children = Node::NONE;
+            child.nChildren = 0;
+            child.move = static_cast<std::uint16_t>(i);
+            child.prior = static_cast<float>(priors[i] / sum);
+        }
+        node.children = children;
+        node.nChildren = static_cast<std::uint16_t>(moves.size());
+        node.state.store(Node::EXPANDED, std::memory_order_release);
+        return true;
+    }
+
+    double Searcher::evaluate(Worker &worker) {
+        auto &board = worker.board;
+        if (this->_options.playout == Playout::EVALUATION) return this->value(board);
+
+        int nPlayed = 0;
+        for (; nPlayed < this->_options.rolloutPlies; ++nPlayed) {
+            if (board.status() != Game::Status::IN_PROGRESS) break;
+
+            auto moves = board.legalMoves();
+            board.move(moves[worker.generator() % moves.size()]);
+        }
+        double value = this->value(board);
+        if (nPlayed % 2 == 1) value = 1.0 - value;
+        for (; nPlayed > 0; --nPlayed) board.unMove();
+
+        return value;
+    }
+
+    double Searcher::value(const Game::Board &board) const {
+        auto status = board.status();
+        if (status == Game::Status::ENDED_CHECKMATE) return 0.0;
+        if (status == Game::Status::ENDED_STALEMATE || status.isDraw()) return 0.5;
+
+        double score = Search::Evaluation::evaluate(board);
+        return 1.0 / (1.0 + std::pow(10.0, -score / this->_options.scale));
+    }
+
+    std::vector<std::uint32_t> Searcher::principal() const {
+        std::vector<std::uint32_t> line{0};
+        while (true) {
+            auto &node = this->_tree[line.back()];
+            if (node.state.load(std::memory_order_acquire) != Node::EXPANDED) break;
+            if (node.visits.load() <= 1) break;
+
+            line.push_back(mostVisited(this->_tree, node));
+        }
+        return line;
+    }
+
+    Searcher::Result Searcher::result(Game::Board &board) const {
+        Result result{Pieces::Move(), 0, 0, this->_nPlayouts.load()};
+        auto line = this->principal();
+        if (line.size() < 2) return result;
+
+        // The workers' move order may differ from the board's: go through the notation
+        auto &child = this->_tree[line[1]];
+        auto moves = this->_root->board.legalMoves();
+        result.move = Notation::LAN::parse(board, Notation::LAN::format(moves[child.move]));
+        result.depth = static_cast<int>(line.size()) - 1;
+        if (child.state.load() == Node::LOST) {
+            result.score = Search::MATE - 1;
+        } else {
+            double mean = std::clamp(child.mean(), MIN_MEAN, 1.0 - MIN_MEAN);
+            result.score = static_cast<int>(
+                std::lround(this->_options.scale * std::log10(mean / (1.0 - mean))));
+        }
+        return result;
+    }
+
+    bool Searcher::isStopped() {
+        if (this->_isStopped.load(std::memory_order_relaxed)) return true;
+
+        auto deadline = this->_deadline.load(std::memory_order_relaxed);
+        auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+        if (deadline != 0 && now >= deadline) this->_isStopped = true;
+
+        return this->_isStopped.load(std::memory_order_relaxed);
+    }
+} // namespace MCTS
@@ -0,0 +1,143 @@
+#include <deque>
+#include <stdexcept>
+#include <utility>
+
+#include "model/mcts/mcts.hpp"
+
+namespace MCTS {
+    namespace {
+        void copy(const Node &source, Node &target) {
+            target.visits.store(source.visits.load(std::memory_order_relaxed),
+                                std::memory_order_relaxed);
+            target.value.store(source.value.load(std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+            target.state.store(source.state.load(std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+            target.children = source.children;
+            target.nChildren = source.nChildren;
+            target.move = source.move;
+            target.prior = source.prior;
+        }
+
+        bool isExpanded(const Node &node) {
+            return node.state.load(std::memory_order_relaxed) == Node::EXPANDED;
+        }
+    } // namespace
+
+    double Node::mean() const {
+        auto n = this->visits.load(std::memory_order_relaxed);
+        if (n == 0) return 0.5;
+
+        return static_cast<double>(this->value.load(std::memory_order_relaxed)) /
+               (static_cast<double>(VALUE_ONE) * n);
+    }
+
+    Arena::Arena(std::size_t capacity)
+        : _nodes(new Node[capacity])
+        , _capacity(capacity)
+        , _size(0) {}
+
+    std::uint32_t Arena::allocate(std::size_t n) {
+        auto index = this->_size.fetch_add(n, std::memory_order_relaxed);
+        if (index + n > this->_capacity) return Node::NONE;
+
+        return static_cast<std::uint32_t>(index);
+    }
+
+    void Arena::clear() { this->_size = 0; }
+
+    Node &Arena::operator[](std::uint32_t index) { return this->_nodes[index]; }
+
+    const Node &Arena::operator[](std::uint32_t index) const { return this->_nodes[index]; }
+
+    std::size_t Arena::size() const { return std::min(this->_size.load(), this->_capacity); }
+
+    std::size_t Arena::capacity() const { return this->_capacity; }
+
+    Tree::Tree(std::size_t capacity)
+        : _active()
+        , _spare() {
+        if (capacity < MIN_CAPACITY) {
+            throw std::runtime_error("Tree capacity is too small: capacity='" +
+                                     std::to_string(capacity) + "'");
+        }
+        this->_active = std::make_unique<Arena>(capacity);
+        this->_spare = std::make_unique<Arena>(capacity);
+        this->clear();
+    }
+
+    void Tree::clear() {
+        this->_active->clear();
+        copy(Node(), (*this->_active)[this->_active->allocate(1)]);
+    }
+
+    Node &Tree::root() { return (*this->_active)[0]; }
+
+    Node &Tree::operator[](std::uint32_t index) { return (*this->_active)[index]; }
+
+    const Node &Tree::operator[](std::uint32_t index) const { return (*this->_active)[index]; }
+
+    std::uint32_t Tree::allocate(std::size_t n) { return this->_active->allocate(n); }
+
+    void Tree::reroot(std::uint32_t index) { this->compact(index, 0); }
+
+    std::size_t Tree::recycle() {
+        std::size_t limit = this->capacity() / 2;
+        std::uint32_t minVisits = 1;
+        while (this->count(0, minVisits) > limit) minVisits *= 2;
+
+        this->compact(0, minVisits);
+        return this->size();
+    }
+
+    std::size_t Tree::size() const { return this->_active->size(); }
+
+    std::size_t Tree::capacity() const { return this->_active->capacity(); }
+
+    std::size_t Tree::count(std::uint32_t index, std::uint32_t minVisits) const {
+        std::size_t n = 1;
+        std::vector<std::uint32_t> stack{index};
+        while (!stack.empty()) {
+            auto &node = (*this)[stack.back()];
+            bool isRoot = stack.back() == index;
+            stack.pop_back();
+            if (!isExpanded(node) || (!isRoot && node.visits.load() < minVisits)) continue;
+
+            n += node.nChildren;
+            for (std::uint32_t i = 0; i < node.nChildren; ++i) stack.push_back(node.children + i);
+        }
+        return n;
+    }
+
+    void Tree::compact(std::uint32_t index, std::uint32_t minVisits) {
+        auto &source = *this->_active;
+        auto &target = *this->_spare;
+        target.clear();
+        auto root = target.allocate(1);
+        copy(source[index], target[root]);
+
+        // Breadth first, so that siblings stay consecutive
+        std::deque<std::pair<std::uint32_t, std::uint32_t>> queue{{index, root}};
+        while (!queue.empty()) {
+            auto [from, to] = queue.front();
+            queue.pop_front();
+            auto &node = target[to];
+            bool isKept = isExpanded(node) && (from == index || node.visits.load() >= minVisits);
+            if (!isKept) {
+                if (node.state.load() == Node::EXPANDING) node.state = Node::UNEXPANDED;
+                if (node.state.load() == Node::EXPANDED) node.state = Node::UNEXPANDED;
+                node.children = Node::NONE;
+                node.nChildren = 0;
+                continue;
+            }
+
+            auto children = target.allocate(node.nChildren);
+            for (std::uint32_t i = 0; i < node.nChildren; ++i) {
+                copy(source[node.children + i], target[children + i]);
+                queue.emplace_back(node.children + i, children + i);
+            }
+            node.children = children;
+        }
+        std::swap(this->_active, this->_spare);
+    }
+} // namespace MCTS
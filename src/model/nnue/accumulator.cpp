@@ -0,0 +1,14 @@
+#include "model/nnue/nnue.hpp"
+
+#include <cstring>
+
+namespace NNUE {
+    Accumulator::Accumulator() { std::memset(this->values, 0, sizeof(this->values)); }
+
+    bool Accumulator::operator==(const Accumulator &other) const {
+        return std::memcmp(this->values, other.values, sizeof(this->values)) == 0;
+    }
+
+    bool Accumulator::operator!=(const Accumulator &other) const { return !(*this == other); }
+
+} // namespace NNUE
@@ -0,0 +1,239 @@
+#include "model/nnue/nnue.hpp"
+
+#include <stdexcept>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define NNUE_X86
+    #include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    #define NNUE_NEON
+    #include <arm_neon.h>
+#endif
+
+namespace NNUE {
+    namespace {
+        std::int16_t clipped(std::int16_t value) {
+            if (value < 0) return 0;
+            if (value > Network::CLIPPED_MAX) return Network::CLIPPED_MAX;
+            return value;
+        }
+
+        void addScalar(std::int16_t *accumulator, const std::int16_t *weights) {
+            for (int i = 0; i < N_HIDDEN; ++i) {
+                auto sum = static_cast<std::uint16_t>(accumulator[i]) +
+                           static_cast<std::uint16_t>(weights[i]);
+                accumulator[i] = static_cast<std::int16_t>(static_cast<std::uint16_t>(sum));
+            }
+        }
+
+        void subScalar(std::int16_t *accumulator, const std::int16_t *weights) {
+            for (int i = 0; i < N_HIDDEN; ++i) {
+                auto difference = static_cast<std::uint16_t>(accumulator[i]) -
+                                  static_cast<std::uint16_t>(weights[i]);
+                accumulator[i] = static_cast<std::int16_t>(static_cast<std::uint16_t>(difference));
+            }
+        }
+
+        std::int32_t outputScalar(const std::int16_t *us, const std::int16_t *them,
+                                  const std::int16_t *weights) {
+            std::uint32_t sum = 0;
+            for (int i = 0; i < N_HIDDEN; ++i) {
+                sum += static_cast<std::uint32_t>(clipped(us[i]) * weights[i]);
+                sum += static_cast<std::uint32_t>(clipped(them[i]) * weights[N_HIDDEN + i]);
+            }
+            return static_cast<std::int32_t>(sum);
+        }
+
+#ifdef NNUE_X86
+        __attribute__((target("sse4.1"))) void addSse41(std::int16_t *accumulator,
+                                                        const std::int16_t *weights) {
+            for (int i = 0; i < N_HIDDEN; i += 8) {
+                auto *out = reinterpret_cast<__m128i *>(accumulator + i);
+                __m128i a = _mm_loadu_si128(out);
+                __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i *>(weights + i));
+                _mm_storeu_si128(out, _mm_add_epi16(a, w));
+            }
+        }
+
+        __attribute__((target("sse4.1"))) void subSse41(std::int16_t *accumulator,
+                                                        const std::int16_t *weights) {
+            for (int i = 0; i < N_HIDDEN; i += 8) {
+                auto *out = reinterpret_cast<__m128i *>(accumulator + i);
+                __m128i a = _mm_loadu_si128(out);
+                __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i *>(weights + i));
+                _mm_storeu_si128(out, _mm_sub_epi16(a, w));
+            }
+        }
+
+        __attribute__((target("sse4.1"))) __m128i dotSse41(__m128i sum, const std::int16_t *input,
+                                                           const std::int16_t *weights) {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i max = _mm_set1_epi16(Network::CLIPPED_MAX);
+            for (int i = 0; i < N_HIDDEN; i += 8) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+                __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i *>(weights + i));
+                v = _mm_min_epi16(_mm_max_epi16(v, zero), max);
+                sum = _mm_add_epi32(sum, _mm_madd_epi16(v, w));
+            }
+            return sum;
+        }
+
+        __attribute__((target("sse4.1"))) std::int32_t
+        outputSse41(const std::int16_t *us, const std::int16_t *them, const std::int16_t *weights) {
+            __m128i sum = _mm_setzero_si128();
+            sum = dotSse41(sum, us, weights);
+            sum = dotSse41(sum, them, weights + N_HIDDEN);
+            sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+            sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+            return _mm_cvtsi128_si32(sum);
+        }
+
+        __attribute__((target("avx2"))) void addAvx2(std::int16_t *accumulator,
+                                                     const std::int16_t *weights) {
+            for (int i = 0; i < N_HIDDEN; i += 16) {
+                auto *out = reinterpret_cast<__m256i *>(accumulator + i);
+                __m256i a = _mm256_loadu_si256(out);
+                __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(weights + i));
+                _mm256_storeu_si256(out, _mm256_add_epi16(a, w));
+            }
+        }
+
+        __attribute__((target("avx2"))) void subAvx2(std::int16_t *accumulator,
+                                                     const std::int16_t *weights) {
+            for (int i = 0; i < N_HIDDEN; i += 16) {
+                auto *out = reinterpret_cast<__m256i *>(accumulator + i);
+                __m256i a = _mm256_loadu_si256(out);
+                __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(weights + i));
+                _mm256_storeu_si256(out, _mm256_sub_epi16(a, w));
+            }
+        }
+
+        __attribute__((target("avx2"))) __m256i dotAvx2(__m256i sum, const std::int16_t *input,
+                                                        const std::int16_t *weights) {
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i max = _mm256_set1_epi16(Network::CLIPPED_MAX);
+            for (int i = 0; i < N_HIDDEN; i += 16) {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i));
+                __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(weights + i));
+                v = _mm256_min_epi16(_mm256_max_epi16(v, zero), max);
+                sum = _mm256_add_epi32(sum, _mm256_madd_epi16(v, w));
+            }
+            return sum;
+        }
+
+        __attribute__((target("avx2"))) std::int32_t
+        outputAvx2(const std::int16_t *us, const std::int16_t *them, const std::int16_t *weights) {
+            __m256i sum = _mm256_setzero_si256();
+            sum = dotAvx2(sum, us, weights);
+            sum = dotAvx2(sum, them, weights + N_HIDDEN);
+            __m128i half = _mm_add_epi32(_mm256_castsi256_si128(sum),
+                                         _mm256_extracti128_si256(sum, 1));
+            half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+            half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+            return _mm_cvtsi128_si32(half);
+        }
+#endif
+
+#ifdef NNUE_NEON
+        void addNeon(std::int16_t *accumulator, const std::int16_t *weights) {
+            for (int i = 0; i < N_HIDDEN; i += 8) {
+                vst1q_s16(accumulator + i,
+                          vaddq_s16(vld1q_s16(accumulator + i), vld1q_s16(weights + i)));
+            }
+        }
+
+        void subNeon(std::int16_t *accumulator, const std::int16_t *weights) {
+            for (int i = 0; i < N_HIDDEN; i += 8) {
+                vst1q_s16(accumulator + i,
+                          vsubq_s16(vld1q_s16(accumulator + i), vld1q_s16(weights + i)));
+            }
+        }
+
+        int32x4_t dotNeon(int32x4_t sum, const std::int16_t *input, const std::int16_t *weights) {
+            const int16x8_t zero = vdupq_n_s16(0);
+            const int16x8_t max = vdupq_n_s16(Network::CLIPPED_MAX);
+            for (int i = 0; i < N_HIDDEN; i += 8) {
+                int16x8_t v = vminq_s16(vmaxq_s16(vld1q_s16(input + i), zero), max);
+                int16x8_t w = vld1q_s16(weights + i);
+                sum = vmlal_s16(sum, vget_low_s16(v), vget_low_s16(w));
+                sum = vmlal_s16(sum, vget_high_s16(v), vget_high_s16(w));
+            }
+            return sum;
+        }
+
+        std::int32_t outputNeon(const std::int16_t *us, const std::int16_t *them,
+                                const std::int16_t *weights) {
+            int32x4_t sum = vdupq_n_s32(0);
+            sum = dotNeon(sum, us, weights);
+            sum = dotNeon(sum, them, weights + N_HIDDEN);
+            return vaddvq_s32(sum);
+        }
+#endif
+    } // namespace
+
+    bool Kernels::isSupported(Target target) {
+        switch (target) {
+        case Target::SCALAR:
+            return true;
+#ifdef NNUE_X86
+        case Target::SSE41:
+            return __builtin_cpu_supports("sse4.1");
+        case Target::AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+#ifdef NNUE_NEON
+        case Target::NEON:
+            return true;
+#endif
+        default:
+            return false;
+        }
+    }
+
+    Kernels Kernels::of(Target target) {
+        if (!isSupported(target)) {
+            throw std::runtime_error("NNUE kernels are not supported by this CPU: target='" +
+                                     name(target) + "'");
+        }
+        switch (target) {
+#ifdef NNUE_X86
+        case Target::SSE41:
+            return Kernels{target, addSse41, subSse41, outputSse41};
+        case Target::AVX2:
+            return Kernels{target, addAvx2, subAvx2, outputAvx2};
+#endif
+#ifdef NNUE_NEON
+        case Target::NEON:
+            return Kernels{target, addNeon, subNeon, outputNeon};
+#endif
+        default:
+            return Kernels{Target::SCALAR, addScalar, subScalar, outputScalar};
+        }
+    }
+
+    Kernels Kernels::best() {
+        for (auto target : {Target::AVX2, Target::SSE41, Target::NEON}) {
+            if (isSupported(target)) return of(target);
+        }
+        return of(Target::SCALAR);
+    }
+
+    std::string Kernels::name(Target target) {
+        switch (target) {
+        case Target::SCALAR:
+            return "SCALAR";
+        case Target::SSE41:
+            return "SSE41";
+        case Target::AVX2:
+            return "AVX2";
+        case Target::NEON:
+            return "NEON";
+        default:
+            throw std::runtime_error("Undefined NNUE::Kernels::Target: '" +
+                                     std::to_string(static_cast<int>(target)) + "'");
+        }
+    }
+
+} // namespace NNUE
@@ -0,0 +1,139 @@
+#include "model/nnue/nnue.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace NNUE {
+    namespace {
+        const char MAGIC[4] = {'C', 'H', 'N', 'N'};
+        const std::uint32_t VERSION = 1;
+        const std::size_t HEADER_SIZE = sizeof(MAGIC) + 3 * sizeof(std::uint32_t);
+        const std::size_t FILE_SIZE =
+            HEADER_SIZE +
+            sizeof(std::int16_t) * (N_HIDDEN + N_FEATURES * N_HIDDEN + 2 * N_HIDDEN) +
+            sizeof(std::int32_t);
+
+        std::uint32_t readUint32(const char *data) {
+            std::uint32_t value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        template <typename T>
+        void write(std::ofstream &file, const T *values, std::size_t size) {
+            file.write(reinterpret_cast<const char *>(values),
+                       static_cast<std::streamsize>(size * sizeof(T)));
+        }
+    } // namespace
+
+    Network::Network()
+        : _file()
+        , _featureBiases(nullptr)
+        , _featureWeights(nullptr)
+        , _outputWeights(nullptr)
+        , _outputBias(0)
+        , _kernels(Kernels::best()) {}
+
+    Network::Network(const std::string &path)
+        : Network() {
+        this->load(path);
+    }
+
+    void Network::load(const std::string &path) {
+        Utils::MappedFile file(path);
+        const char *data = file.data();
+        if (file.size() != FILE_SIZE) {
+            throw std::runtime_error("Invalid NNUE file size: path='" + path + "', size='" +
+                                     std::to_string(file.size()) + "', expected='" +
+                                     std::to_string(FILE_SIZE) + "'");
+        }
+        if (std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+            throw std::runtime_error("Invalid NNUE file magic: path='" + path + "'");
+        }
+        const char *header = data + sizeof(MAGIC);
+        if (readUint32(header) != VERSION ||
+            readUint32(header + sizeof(std::uint32_t)) != N_FEATURES ||
+            readUint32(header + 2 * sizeof(std::uint32_t)) != N_HIDDEN) {
+            throw std::runtime_error("Unsupported NNUE architecture: path='" + path + "'");
+        }
+
+        const auto *values = reinterpret_cast<const std::int16_t *>(data + HEADER_SIZE);
+        this->_featureBiases = values;
+        this->_featureWeights = values + N_HIDDEN;
+        this->_outputWeights = this->_featureWeights + N_FEATURES * N_HIDDEN;
+        std::memcpy(&this->_outputBias, this->_outputWeights + 2 * N_HIDDEN,
+                    sizeof(this->_outputBias));
+        this->_file = std::move(file);
+    }
+
+    bool Network::isLoaded() const { return this->_file.isOpen(); }
+
+    Kernels Network::kernels() const { return this->_kernels; }
+
+    void Network::kernels(Kernels kernels) { this->_kernels = kernels; }
+
+    void Network::reset(Accumulator &accumulator) const {
+        if (!this->isLoaded()) throw std::runtime_error("NNUE network is not loaded");
+
+        for (auto &perspective : accumulator.values) {
+            std::memcpy(perspective, this->_featureBiases, sizeof(perspective));
+        }
+    }
+
+    void Network::add(Accumulator &accumulator, int color, Pieces::Types type, int square) const {
+        for (int perspective : {WHITE, BLACK}) {
+            int index = feature(perspective, color, type, square);
+            this->_kernels.add(accumulator.values[perspective], this->weights(index));
+        }
+    }
+
+    void Network::remove(Accumulator &accumulator, int color, Pieces::Types type,
+                         int square) const {
+        for (int perspective : {WHITE, BLACK}) {
+            int index = feature(perspective, color, type, square);
+            this->_kernels.sub(accumulator.values[perspective], this->weights(index));
+        }
+    }
+
+    int Network::evaluate(const Accumulator &accumulator, int perspective) const {
+        if (!this->isLoaded()) throw std::runtime_error("NNUE network is not loaded");
+
+        const std::int16_t *us = accumulator.values[perspective];
+        const std::int16_t *them = accumulator.values[perspective ^ 1];
+        auto sum = static_cast<std::int64_t>(this->_kernels.output(us, them, this->_outputWeights));
+        sum += this->_outputBias;
+        return static_cast<int>(sum * EVALUATION_SCALE / (CLIPPED_MAX * OUTPUT_SCALE));
+    }
+
+    int Network::feature(int perspective, int color, Pieces::Types type, int square) {
+        if (perspective == BLACK) {
+            color ^= 1;
+            square ^= 56;
+        }
+        return (color * 6 + type.index()) * N_SQUARES + square;
+    }
+
+    void Network::save(const std::string &path, const Parameters &parameters) {
+        if (parameters.featureBiases.size() != N_HIDDEN ||
+            parameters.featureWeights.size() != static_cast<std::size_t>(N_FEATURES * N_HIDDEN) ||
+            parameters.outputWeights.size() != 2 * N_HIDDEN) {
+            throw std::runtime_error("Invalid NNUE parameters dimensions");
+        }
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) throw std::runtime_error("Cannot write NNUE file: path='" + path + "'");
+
+        const std::uint32_t header[3] = {VERSION, N_FEATURES, N_HIDDEN};
+        file.write(MAGIC, sizeof(MAGIC));
+        write(file, header, 3);
+        write(file, parameters.featureBiases.data(), parameters.featureBiases.size());
+        write(file, parameters.featureWeights.data(), parameters.featureWeights.size());
+        write(file, parameters.outputWeights.data(), parameters.outputWeights.size());
+        write(file, &parameters.outputBias, 1);
+    }
+
+    const std::int16_t *Network::weights(int feature) const {
+        return this->_featureWeights + static_cast<std::size_t>(feature) * N_HIDDEN;
+    }
+
+} // namespace NNUE
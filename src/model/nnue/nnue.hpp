@@ -0,0 +1,104 @@
+#ifndef NNUE_HPP
+#define NNUE_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "model/pieces/pieces.hpp"
+#include "model/utils/mapped_file.hpp"
+
+namespace NNUE {
+    constexpr int N_SQUARES = 64;
+    constexpr int N_FEATURES = 2 * 6 * N_SQUARES;
+    constexpr int N_HIDDEN = 256;
+
+    /**
+     * @brief Feature transformer output of both perspectives
+     *    - values[0] is the white perspective, values[1] the black one
+     *    - Each value is the int16 sum of the bias and the weights of the active features
+     */
+    class Accumulator {
+      public:
+        Accumulator();
+
+        bool operator==(const Accumulator &other) const;
+        bool operator!=(const Accumulator &other) const;
+
+        alignas(64) std::int16_t values[2][N_HIDDEN];
+    };
+
+    /**
+     * @brief Integer kernels of the network
+     * @warning Every target must produce bit-identical results: int16 sums
+     *          wrap around and the output is summed in wrapping int32.
+     */
+    class Kernels {
+      public:
+        enum class Target { SCALAR, SSE41, AVX2, NEON };
+
+        Target target;
+        void (*add)(std::int16_t *accumulator, const std::int16_t *weights);
+        void (*sub)(std::int16_t *accumulator, const std::int16_t *weights);
+        std::int32_t (*output)(const std::int16_t *us, const std::int16_t *them,
+                               const std::int16_t *weights);
+
+        static bool isSupported(Target target);
+        static Kernels of(Target target);
+        static Kernels best();
+        static std::string name(Target target);
+    };
+
+    class Network {
+      public:
+        static const int WHITE = 0;
+        static const int BLACK = 1;
+        static const int CLIPPED_MAX = 127;
+        static const int OUTPUT_SCALE = 64;
+        static const int EVALUATION_SCALE = 400;
+
+        /**
+         * @brief Layout of a network file, all values little-endian
+         *    - header: "CHNN", version, N_FEATURES, N_HIDDEN as uint32
+         *    - featureBiases[N_HIDDEN], featureWeights[N_FEATURES][N_HIDDEN] as int16
+         *    - outputWeights[2 * N_HIDDEN] as int16, outputBias as int32
+         */
+        struct Parameters {
+            std::vector<std::int16_t> featureBiases;
+            std::vector<std::int16_t> featureWeights;
+            std::vector<std::int16_t> outputWeights;
+            std::int32_t outputBias;
+        };
+
+        Network();
+        explicit Network(const std::string &path);
+
+        void load(const std::string &path);
+        bool isLoaded() const;
+
+        Kernels kernels() const;
+        void kernels(Kernels kernels);
+
+        void reset(Accumulator &accumulator) const;
+        void add(Accumulator &accumulator, int color, Pieces::Types type, int square) const;
+        void remove(Accumulator &accumulator, int color, Pieces::Types type, int square) const;
+
+        int evaluate(const Accumulator &accumulator, int perspective) const;
+
+        static int feature(int perspective, int color, Pieces::Types type, int square);
+
+        static void save(const std::string &path, const Parameters &parameters);
+
+      private:
+        Utils::MappedFile _file;
+        const std::int16_t *_featureBiases;
+        const std::int16_t *_featureWeights;
+        const std::int16_t *_outputWeights;
+        std::int32_t _outputBias;
+        Kernels _kernels;
+
+        const std::int16_t *weights(int feature) const;
+    };
+} // namespace NNUE
+
+#endif // NNUE_HPP
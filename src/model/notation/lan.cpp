@@ -0,0 +1,56 @@
+#include "model/notation/notation.hpp"
+
+namespace Notation {
+    namespace {
+        constexpr std::string_view PROMOTION_LETTERS = "kqrbnp";
+
+        Pieces::Types promotionType(char letter) {
+            switch (letter) {
+            case 'q':
+                return Pieces::Types::QUEEN;
+            case 'r':
+                return Pieces::Types::ROOK;
+            case 'b':
+                return Pieces::Types::BISHOP;
+            case 'n':
+                return Pieces::Types::KNIGHT;
+            default:
+                return Pieces::Types::UNDEFINED;
+            }
+        }
+
+        std::runtime_error error(const std::string &reason, std::string_view lan) {
+            return std::runtime_error(reason + ": lan='" + std::string(lan) + "'");
+        }
+    } // namespace
+
+    Pieces::Move LAN::parse(Game::Board &board, std::string_view lan) {
+        if (lan.size() != 4 && lan.size() != 5) throw error("Malformed LAN move", lan);
+
+        Position from = parseSquare(lan.substr(0, 2)), to = parseSquare(lan.substr(2, 2));
+        auto promotion = (lan.size() == 5) ? promotionType(lan[4]) : Pieces::Types::UNDEFINED;
+        if (from == Position() || to == Position() ||
+            (lan.size() == 5 && promotion == Pieces::Types::UNDEFINED)) {
+            throw error("Malformed LAN move", lan);
+        }
+
+        for (auto &move : board.legalMoves()) {
+            if (move.from() != from || move.to() != to) continue;
+
+            auto *promoted = move.promoted();
+            auto promotedType = (promoted == nullptr) ? Pieces::Types::UNDEFINED : promoted->type();
+            if (promotedType == promotion) return move;
+        }
+        throw error("Illegal LAN move", lan);
+    }
+
+    std::string LAN::format(const Pieces::Move &move) {
+        std::string lan;
+        lan.reserve(5);
+        appendSquare(lan, move.from());
+        appendSquare(lan, move.to());
+        auto *promoted = move.promoted();
+        if (promoted != nullptr) lan += PROMOTION_LETTERS[promoted->type().index()];
+        return lan;
+    }
+} // namespace Notation
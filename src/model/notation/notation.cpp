@@ -0,0 +1,29 @@
+#include "model/notation/notation.hpp"
+
+namespace Notation {
+    Position parseSquare(std::string_view square) {
+        if (square.size() != 2 || square[0] < 'a' || square[0] > 'z' || square[1] < '1' ||
+            square[1] > '9') {
+            return Position();
+        }
+        return Position(square[1] - '1', square[0] - 'a');
+    }
+
+    void appendSquare(std::string &out, Position position) {
+        out += static_cast<char>('a' + position.column());
+        out += static_cast<char>('1' + position.row());
+    }
+
+    std::string square(Position position) {
+        std::string out;
+        appendSquare(out, position);
+        return out;
+    }
+
+    Pieces::Move parse(Game::Board &board, std::string_view notation) {
+        bool isLAN = (notation.size() == 4 || notation.size() == 5) &&
+                     parseSquare(notation.substr(0, 2)) != Position() &&
+                     parseSquare(notation.substr(2, 2)) != Position();
+        return isLAN ? LAN::parse(board, notation) : SAN::parse(board, notation);
+    }
+} // namespace Notation
@@ -0,0 +1,52 @@
+#ifndef NOTATION_HPP
+#define NOTATION_HPP
+
+#include <string>
+#include <string_view>
+
+#include "model/game/game.hpp"
+
+namespace Notation {
+    /**
+     * @brief Square name like "e4"
+     *    - Files start at 'a' on column 0 and ranks at '1' on row 0
+     *    - parseSquare() returns Position() if the name is malformed
+     */
+    Position parseSquare(std::string_view square);
+    void appendSquare(std::string &out, Position position);
+    std::string square(Position position);
+
+    /**
+     * @brief Standard algebraic notation ("Nbd7", "exd5", "O-O", "e8=Q+")
+     *    - Moves are resolved against Board::legalMoves() of the player to move
+     *    - format() expects the board before the move is played
+     */
+    class SAN {
+      public:
+        /**
+         * @throw std::runtime_error if the move is malformed, illegal or ambiguous
+         */
+        static Pieces::Move parse(Game::Board &board, std::string_view san);
+        static std::string format(Game::Board &board, const Pieces::Move &move);
+    };
+
+    /**
+     * @brief Long algebraic notation of UCI ("e2e4", "e7e8q", "e1g1" to castle)
+     */
+    class LAN {
+      public:
+        /**
+         * @throw std::runtime_error if the move is malformed or illegal
+         */
+        static Pieces::Move parse(Game::Board &board, std::string_view lan);
+        static std::string format(const Pieces::Move &move);
+    };
+
+    /**
+     * @brief Parse either notation, LAN is tried first
+     * @throw std::runtime_error if neither notation matches a legal move
+     */
+    Pieces::Move parse(Game::Board &board, std::string_view notation);
+} // namespace Notation
+
+#endif // NOTATION_HPP
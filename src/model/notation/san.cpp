@@ -0,0 +1,167 @@
+#include "model/notation/notation.hpp"
+
+namespace Notation {
+    namespace {
+        constexpr std::string_view PIECE_LETTERS = "KQRBNP";
+
+        Pieces::Types pieceType(char letter) {
+            switch (letter) {
+            case 'K':
+                return Pieces::Types::KING;
+            case 'Q':
+                return Pieces::Types::QUEEN;
+            case 'R':
+                return Pieces::Types::ROOK;
+            case 'B':
+                return Pieces::Types::BISHOP;
+            case 'N':
+                return Pieces::Types::KNIGHT;
+            default:
+                return Pieces::Types::UNDEFINED;
+            }
+        }
+
+        std::runtime_error error(const std::string &reason, std::string_view san) {
+            return std::runtime_error(reason + ": san='" + std::string(san) + "'");
+        }
+
+        bool isFile(char c) { return c >= 'a' && c <= 'z'; }
+
+        bool isRank(char c) { return c >= '1' && c <= '9'; }
+    } // namespace
+
+    Pieces::Move SAN::parse(Game::Board &board, std::string_view san) {
+        std::string_view body = san;
+        while (!body.empty() && (body.back() == '+' || body.back() == '#' || body.back() == '!' ||
+                                 body.back() == '?')) {
+            body.remove_suffix(1);
+        }
+
+        auto moves = board.legalMoves();
+        bool isKingCastling = (body == "O-O" || body == "0-0");
+        if (isKingCastling || body == "O-O-O" || body == "0-0-0") {
+            int column = isKingCastling ? 6 : 2;
+            for (auto &move : moves) {
+                if (move.type() == Pieces::Move::Type::SWAP && move.to().column() == column) {
+                    return move;
+                }
+            }
+            throw error("Illegal SAN move", san);
+        }
+
+        auto type = Pieces::Types::PAWN;
+        if (!body.empty() && pieceType(body.front()) != Pieces::Types::UNDEFINED) {
+            type = pieceType(body.front());
+            body.remove_prefix(1);
+        }
+
+        auto promotion = Pieces::Types::UNDEFINED;
+        if (type == Pieces::Types::PAWN && body.size() > 2 &&
+            pieceType(body.back()) != Pieces::Types::UNDEFINED) {
+            promotion = pieceType(body.back());
+            body.remove_suffix(1);
+            if (body.back() == '=') body.remove_suffix(1);
+        }
+
+        std::size_t size = body.size();
+        if (size < 2 || !isFile(body[size - 2]) || !isRank(body[size - 1])) {
+            throw error("Malformed SAN move", san);
+        }
+        Position to(body[size - 1] - '1', body[size - 2] - 'a');
+        body.remove_suffix(2);
+        bool isCapture = !body.empty() && (body.back() == 'x' || body.back() == ':');
+        if (isCapture) body.remove_suffix(1);
+
+        int fromRow = -1, fromColumn = -1;
+        if (body.size() > 2) throw error("Malformed SAN move", san);
+        for (char c : body) {
+            if (isFile(c)) {
+                fromColumn = c - 'a';
+            } else if (isRank(c)) {
+                fromRow = c - '1';
+            } else {
+                throw error("Malformed SAN move", san);
+            }
+        }
+        if (isCapture && type == Pieces::Types::PAWN && fromColumn < 0) {
+            throw error("Malformed SAN move", san);
+        }
+
+        const Pieces::Move *found = nullptr;
+        int nFound = 0;
+        for (auto &move : moves) {
+            if (move.to() != to || move.piece()->type() != type) continue;
+
+            if (isCapture && move.captured() == nullptr) continue;
+
+            Position from = move.from();
+            if ((fromColumn >= 0 && from.column() != fromColumn) ||
+                (fromRow >= 0 && from.row() != fromRow)) {
+                continue;
+            }
+
+            auto *promoted = move.promoted();
+            auto promotedType = (promoted == nullptr) ? Pieces::Types::UNDEFINED : promoted->type();
+            if (promotedType != promotion) continue;
+
+            found = &move;
+            nFound++;
+        }
+        if (nFound == 0) throw error("Illegal SAN move", san);
+
+        if (nFound > 1) throw error("Ambiguous SAN move", san);
+
+        return *found;
+    }
+
+    std::string SAN::format(Game::Board &board, const Pieces::Move &move) {
+        std::string san;
+        san.reserve(8);
+        Position from = move.from(), to = move.to();
+        auto *piece = move.piece();
+        auto *captured = move.captured();
+        if (move.type() == Pieces::Move::Type::SWAP) {
+            san = (to.column() < from.column()) ? "O-O-O" : "O-O";
+        } else if (piece->type() == Pieces::Types::PAWN) {
+            if (captured != nullptr) {
+                san += static_cast<char>('a' + from.column());
+                san += 'x';
+            }
+            appendSquare(san, to);
+        } else {
+            san += PIECE_LETTERS[piece->type().index()];
+            bool isAmbiguous = false, isSameColumn = false, isSameRow = false;
+            for (auto &other : board.legalMoves()) {
+                if (other.piece() == piece || other.to() != to ||
+                    other.piece()->type() != piece->type() ||
+                    other.type() == Pieces::Move::Type::SWAP) {
+                    continue;
+                }
+                isAmbiguous = true;
+                isSameColumn |= other.from().column() == from.column();
+                isSameRow |= other.from().row() == from.row();
+            }
+            if (isAmbiguous && (!isSameColumn || isSameRow)) {
+                san += static_cast<char>('a' + from.column());
+            }
+            if (isAmbiguous && isSameColumn) san += static_cast<char>('1' + from.row());
+            if (captured != nullptr) san += 'x';
+            appendSquare(san, to);
+        }
+
+        auto *promoted = move.promoted();
+        if (promoted != nullptr) {
+            san += '=';
+            san += PIECE_LETTERS[promoted->type().index()];
+        }
+
+        board.move(move);
+        if (board.status() == Game::Status::ENDED_CHECKMATE) {
+            san += '#';
+        } else if (board.isInCheck()) {
+            san += '+';
+        }
+        board.unMove();
+        return san;
+    }
+} // namespace Notation
@@ -0,0 +1,85 @@
+#ifndef PGN_HPP
+#define PGN_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "model/game/game.hpp"
+#include "model/utils/mapped_file.hpp"
+
+namespace PGN {
+    constexpr std::string_view STANDARD_FEN =
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+    /**
+     * @brief Callbacks of Reader, every view points into the text being read
+     *    - begin() and end() surround each game, tags come before the moves
+     *    - move() is called once the move is played on the board
+     *    - After error() the remaining moves of the game are skipped
+     */
+    class Visitor {
+      public:
+        virtual ~Visitor() = default;
+
+        virtual void begin() {}
+        virtual void tag(std::string_view /*name*/, std::string_view /*value*/) {}
+        virtual void move(std::string_view /*san*/, const Pieces::Move & /*move*/,
+                          const Game::Board & /*board*/) {}
+        virtual void end(std::string_view /*result*/) {}
+        virtual void error(const std::string & /*message*/) {}
+    };
+
+    /**
+     * @brief Streaming reader of PGN databases
+     *    - The file is mapped and tokenized in place, nothing is copied
+     *    - Comments, variations, NAGs and escaped lines are skipped
+     *    - Games start from the standard position or from their FEN tag
+     */
+    class Reader {
+      public:
+        Reader();
+        explicit Reader(const std::string &path);
+
+        void open(const std::string &path);
+
+        /**
+         * @return the number of games read
+         * @throw std::runtime_error if no file is open
+         */
+        std::size_t read(Visitor &visitor) const;
+        static std::size_t read(std::string_view text, Visitor &visitor);
+
+      private:
+        Utils::MappedFile _file;
+    };
+
+    /**
+     * @brief Visitor writing the games it receives as PGN text
+     *    - Tag values are written as received, escapes included
+     *    - Movetext lines are wrapped before MAX_LINE characters
+     */
+    class Writer : public Visitor {
+      public:
+        static constexpr std::size_t MAX_LINE = 80;
+
+        explicit Writer(std::ostream &out);
+
+        void begin() override;
+        void tag(std::string_view name, std::string_view value) override;
+        void move(std::string_view san, const Pieces::Move &move,
+                  const Game::Board &board) override;
+        void end(std::string_view result) override;
+
+      private:
+        std::ostream &_out;
+        std::string _line;
+        bool _hasTags;
+        bool _isFirstMove;
+
+        void append(std::string_view token);
+    };
+} // namespace PGN
+
+#endif // PGN_HPP
@@ -0,0 +1,227 @@
+#include "model/notation/notation.hpp"
+#include "model/pgn/pgn.hpp"
+
+namespace PGN {
+    namespace {
+        bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+        bool isDelimiter(char c) {
+            return isSpace(c) || c == '{' || c == '}' || c == '(' || c == ')' || c == '[' ||
+                   c == ']' || c == ';' || c == '$';
+        }
+
+        bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+        bool isResult(std::string_view token) {
+            return token == "1-0" || token == "0-1" || token == "1/2-1/2" || token == "*";
+        }
+
+        class Tokenizer {
+          public:
+            enum class Token { MOVE, RESULT, END };
+
+            explicit Tokenizer(std::string_view text)
+                : _text(text)
+                , _cursor(0) {}
+
+            /**
+             * @brief Skip blanks, comments and escaped lines
+             * @return false at the end of the text
+             */
+            bool skip() {
+                while (this->_cursor < this->_text.size()) {
+                    char c = this->_text[this->_cursor];
+                    if (isSpace(c)) {
+                        this->_cursor++;
+                    } else if (c == '{') {
+                        this->skipPast('}');
+                    } else if (c == ';' || (c == '%' && this->isLineStart())) {
+                        this->skipPast('\n');
+                    } else {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            bool isTag() const {
+                return this->_cursor < this->_text.size() && this->_text[this->_cursor] == '[';
+            }
+
+            /**
+             * @brief Read [Name "value"], the value keeps its escapes
+             * @return false if the tag is malformed, the line is skipped then
+             */
+            bool tag(std::string_view &name, std::string_view &value) {
+                std::size_t start = ++this->_cursor;
+                while (this->_cursor < this->_text.size() && !isDelimiter(this->_text[this->_cursor]) &&
+                       this->_text[this->_cursor] != '"') {
+                    this->_cursor++;
+                }
+                name = this->_text.substr(start, this->_cursor - start);
+                while (this->_cursor < this->_text.size() && isSpace(this->_text[this->_cursor])) {
+                    this->_cursor++;
+                }
+                if (name.empty() || this->_cursor >= this->_text.size() ||
+                    this->_text[this->_cursor] != '"') {
+                    this->skipPast('\n');
+                    return false;
+                }
+
+                start = ++this->_cursor;
+                while (this->_cursor < this->_text.size() && this->_text[this->_cursor] != '"') {
+                    if (this->_text[this->_cursor] == '\\') this->_cursor++;
+                    this->_cursor++;
+                }
+                if (this->_cursor >= this->_text.size()) {
+                    this->_cursor = this->_text.size();
+                    return false;
+                }
+                value = this->_text.substr(start, this->_cursor - start);
+                this->skipPast(']');
+                return true;
+            }
+
+            /**
+             * @brief Next move or result of the movetext
+             *    - END is returned before the next tag or at the end of the text
+             */
+            Token next(std::string_view &token) {
+                while (this->skip()) {
+                    char c = this->_text[this->_cursor];
+                    if (c == '[') return Token::END;
+
+                    if (c == '(') {
+                        this->skipVariation();
+                        continue;
+                    }
+                    if (c == '$' || c == ')' || c == '}' || c == ']') {
+                        this->_cursor++;
+                        while (this->_cursor < this->_text.size() &&
+                               isDigit(this->_text[this->_cursor])) {
+                            this->_cursor++;
+                        }
+                        continue;
+                    }
+
+                    std::size_t start = this->_cursor;
+                    while (this->_cursor < this->_text.size() &&
+                           isDigit(this->_text[this->_cursor])) {
+                        this->_cursor++;
+                    }
+                    // Move numbers are "12." or "12..." and may touch the move
+                    if (this->_cursor > start &&
+                        (this->_cursor == this->_text.size() || this->_text[this->_cursor] == '.' ||
+                         isSpace(this->_text[this->_cursor]))) {
+                        while (this->_cursor < this->_text.size() &&
+                               this->_text[this->_cursor] == '.') {
+                            this->_cursor++;
+                        }
+                        continue;
+                    }
+                    while (this->_cursor < this->_text.size() &&
+                           !isDelimiter(this->_text[this->_cursor])) {
+                        this->_cursor++;
+                    }
+                    token = this->_text.substr(start, this->_cursor - start);
+                    return isResult(token) ? Token::RESULT : Token::MOVE;
+                }
+                return Token::END;
+            }
+
+          private:
+            std::string_view _text;
+            std::size_t _cursor;
+
+            bool isLineStart() const {
+                return this->_cursor == 0 || this->_text[this->_cursor - 1] == '\n';
+            }
+
+            void skipPast(char c) {
+                std::size_t found = this->_text.find(c, this->_cursor);
+                this->_cursor = (found == std::string_view::npos) ? this->_text.size() : found + 1;
+            }
+
+            void skipVariation() {
+                int depth = 0;
+                while (this->_cursor < this->_text.size()) {
+                    char c = this->_text[this->_cursor];
+                    if (c == '{') {
+                        this->skipPast('}');
+                        continue;
+                    }
+                    if (c == ';') {
+                        this->skipPast('\n');
+                        continue;
+                    }
+                    this->_cursor++;
+                    if (c == '(') depth++;
+                    if (c == ')' && --depth == 0) return;
+                }
+            }
+        };
+    } // namespace
+
+    Reader::Reader()
+        : _file() {}
+
+    Reader::Reader(const std::string &path)
+        : _file(path) {}
+
+    void Reader::open(const std::string &path) { this->_file.open(path); }
+
+    std::size_t Reader::read(Visitor &visitor) const {
+        if (!this->_file.isOpen()) throw std::runtime_error("PGN file is not open");
+
+        return read(this->_file.view(), visitor);
+    }
+
+    std::size_t Reader::read(std::string_view text, Visitor &visitor) {
+        Tokenizer tokenizer(text);
+        Pieces::Player white("White"), black("Black");
+        Game::Board board(8, 8);
+        std::size_t nGames = 0;
+        while (tokenizer.skip()) {
+            visitor.begin();
+            std::string_view fen = STANDARD_FEN;
+            while (tokenizer.isTag()) {
+                std::string_view name, value;
+                if (tokenizer.tag(name, value)) {
+                    if (name == "FEN") fen = value;
+                    visitor.tag(name, value);
+                } else {
+                    visitor.error("Invalid PGN tag: game='" + std::to_string(nGames + 1) + "'");
+                }
+                tokenizer.skip();
+            }
+
+            bool isValid = true;
+            try {
+                board.initialize(white, black, fen);
+            } catch (const std::runtime_error &e) {
+                visitor.error(e.what());
+                isValid = false;
+            }
+
+            std::string_view token, result = "*";
+            Tokenizer::Token type;
+            while ((type = tokenizer.next(token)) == Tokenizer::Token::MOVE) {
+                if (!isValid) continue;
+
+                try {
+                    auto move = Notation::SAN::parse(board, token);
+                    board.move(move);
+                    visitor.move(token, move, board);
+                } catch (const std::runtime_error &e) {
+                    visitor.error(e.what());
+                    isValid = false;
+                }
+            }
+            if (type == Tokenizer::Token::RESULT) result = token;
+
+            visitor.end(result);
+            nGames++;
+        }
+        return nGames;
+    }
+} // namespace PGN
@@ -0,0 +1,54 @@
+#include "model/pgn/pgn.hpp"
+
+namespace PGN {
+    Writer::Writer(std::ostream &out)
+        : _out(out)
+        , _line()
+        , _hasTags(false)
+        , _isFirstMove(true) {}
+
+    void Writer::begin() {
+        this->_line.clear();
+        this->_hasTags = false;
+        this->_isFirstMove = true;
+    }
+
+    void Writer::tag(std::string_view name, std::string_view value) {
+        this->_out << '[' << name << " \"" << value << "\"]\n";
+        this->_hasTags = true;
+    }
+
+    void Writer::move(std::string_view san, const Pieces::Move & /*move*/,
+                      const Game::Board &board) {
+        if (this->_isFirstMove && this->_hasTags) this->_out << '\n';
+
+        // The board is given after the move, so the mover is the opponent of turn()
+        bool isFirstPlayer = board.color(board.turn()) == NNUE::Network::BLACK;
+        // Move numbers stay on the line of their move
+        if (isFirstPlayer || this->_isFirstMove) {
+            int number = board.fullMoves() - (isFirstPlayer ? 0 : 1);
+            this->append(std::to_string(number) + (isFirstPlayer ? ". " : "... ") +
+                         std::string(san));
+        } else {
+            this->append(san);
+        }
+        this->_isFirstMove = false;
+    }
+
+    void Writer::end(std::string_view result) {
+        if (this->_isFirstMove && this->_hasTags) this->_out << '\n';
+
+        this->append(result);
+        this->_out << this->_line << "\n\n";
+        this->_line.clear();
+    }
+
+    void Writer::append(std::string_view token) {
+        if (!this->_line.empty() && this->_line.size() + 1 + token.size() >= MAX_LINE) {
+            this->_out << this->_line << '\n';
+            this->_line.clear();
+        }
+        if (!this->_line.empty()) this->_line += ' ';
+        this->_line += token;
+    }
+} // namespace PGN
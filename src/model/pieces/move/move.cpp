@@ -9,6 +9,33 @@ namespace Pieces {
     Move::Type Move::type() const { return _type; }
     std::vector<Action> Move::actions() const { return _actions; }
 
+    Piece *Move::piece() const {
+        if (_actions.empty()) throw std::runtime_error("Move has no action");
+        return _actions.front().piece();
+    }
+
+    Position Move::from() const { return _actions.empty() ? Position() : _actions.front().initial(); }
+
+    Position Move::to() const { return _actions.empty() ? Position() : _actions.front().final(); }
+
+    Piece *Move::captured() const {
+        if (_type != Type::CAPTURE) return nullptr;
+
+        for (size_t i = 1; i < _actions.size(); ++i) {
+            if (_actions[i].final() == Position()) {
+                return _actions[i].piece();
+            }
+        }
+        return nullptr;
+    }
+
+    Piece *Move::promoted() const {
+        for (size_t i = 1; i < _actions.size(); ++i) {
+            if (_actions[i].initial() == Position()) return _actions[i].piece();
+        }
+        return nullptr;
+    }
+
     void Move::add(const Action &action) { _actions.push_back(action); }
 
     int Move::hash() const {
@@ -61,6 +61,12 @@ namespace Pieces {
         Type type() const;
         std::vector<Action> actions() const;
 
+        Piece *piece() const;
+        Position from() const;
+        Position to() const;
+        Piece *captured() const;
+        Piece *promoted() const;
+
         void add(const Action &action);
 
         int hash() const;
@@ -32,6 +32,8 @@ namespace Pieces {
         operator std::string() const;
 
         int hash() const;
+        int index() const;
+        int value() const;
 
         bool operator==(const Types &other) const;
         bool operator!=(const Types &other) const;
@@ -53,6 +55,12 @@ namespace Pieces {
         Player *owner() const;
 
         void move(const Position position);
+        void unMove(const Position position);
+
+        /**
+         * @brief Put the Piece on a position as if it had already moved nMoves times
+         */
+        void place(const Position position, int nMoves = 0);
         std::unordered_map<Position, Move> moves(std::unordered_map<Position, Piece *> &friendlies,
                                                  int nRow, int nColumn,
                                                  std::unordered_map<Position, Piece *> &opponents);
@@ -148,6 +156,9 @@ namespace Pieces {
 
         void extractPositionsFromMoves(std::unordered_set<Position> &threatenings,
                                        const std::unordered_map<Position, Move> &moves);
+
+        void extractPositionsAround(std::unordered_set<Position> &threatenings, const Piece *piece,
+                                    const std::vector<std::pair<int, int>> &offsets);
     };
 
     class Queen : public Piece {
@@ -204,6 +215,9 @@ namespace Pieces {
         Pawn();
         Pawn(const Position &position);
         Pawn(const Position &position, Player *owner);
+        Pawn(const Position &position, Player *owner, Move::Direction forward);
+
+        Move::Direction forward() const;
 
       protected:
         std::unordered_map<Position, Move> &_moves(std::unordered_map<Position, Move> &moves,
@@ -216,6 +230,8 @@ namespace Pieces {
         std::unordered_map<Position, Move> &
         completeCaptureMoves(std::unordered_map<Position, Move> &moves,
                              std::unordered_map<Position, Move> &captures);
+
+        Move::Direction _forward;
     };
 
 } // namespace Pieces
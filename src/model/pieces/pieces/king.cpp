@@ -92,17 +92,18 @@ namespace Pieces {
         Position rookInitialPosition;
         Position rookFinalPosition;
         Position initialPosition = position();
+        int row = initialPosition.row();
         auto isKingCastling = [](Position &kingPosition, Position &rookPosition) {
             return (rookPosition.column() - kingPosition.column()) > 0;
         };
         for (auto &[position, rook] : rooks) {
             rookInitialPosition = rook->position();
             if (isKingCastling(initialPosition, rookInitialPosition)) {
-                finalPosition = Position(0, 6);
-                rookFinalPosition = Position(0, 5);
+                finalPosition = Position(row, 6);
+                rookFinalPosition = Position(row, 5);
             } else {
-                finalPosition = Position(0, 2);
-                rookFinalPosition = Position(0, 3);
+                finalPosition = Position(row, 2);
+                rookFinalPosition = Position(row, 3);
             }
             Move move = Move::createMove(*this, initialPosition, finalPosition, Move::Type::SWAP);
             Move::addAction(move, &*rook, rookInitialPosition, rookFinalPosition);
@@ -113,7 +114,9 @@ namespace Pieces {
 
     std::unordered_map<Position, Piece *> King::validRooks(std::pair<int, int> boundaries) {
         std::unordered_map<Position, Piece *> &friendlies = this->friendlies();
-        std::vector<Position> rookPositions = {Position(0, 0), Position(0, boundaries.second - 1)};
+        int row = position().row();
+        std::vector<Position> rookPositions = {Position(row, 0),
+                                               Position(row, boundaries.second - 1)};
         std::unordered_map<Position, Piece *> rooks;
 
         for (auto &position : rookPositions) {
@@ -147,7 +150,7 @@ namespace Pieces {
         int columnDiff = rookColumn - initialColumn;
         int columnUnitDiff =
             (columnDiff > 0) ? (columnDiff / columnDiff) : -(columnDiff / columnDiff);
-        int column = initialColumn;
+        int column = initialColumn + columnUnitDiff;
         Position positionToRook;
         while (!(positionToRook == rookPosition)) {
             positionToRook = Position(initialRow, column);
@@ -171,10 +174,23 @@ namespace Pieces {
         std::unordered_map<Position, Piece *> &friendlies = this->friendlies();
         std::unordered_map<Position, Piece *> &opponents = this->opponents();
         std::unordered_map<Position, Piece *> emptyOpponents;
+        std::unordered_map<Position, Piece *> blockers = friendlies;
+        blockers.insert(opponents.begin(), opponents.end());
         std::unordered_map<Position, Move> opponentMoves;
         for (auto &[position, opponent] : opponents) {
+            if (opponent->type() == Types::PAWN) {
+                int rowDiff = std::pair<int, int>(static_cast<Pawn *>(opponent)->forward()).first;
+                extractPositionsAround(threatenings, opponent, {{rowDiff, -1}, {rowDiff, 1}});
+                continue;
+            }
+            if (opponent->type() == Types::KING) {
+                extractPositionsAround(threatenings, opponent,
+                                       {{1, -1}, {1, 0}, {1, 1}, {0, -1}, {0, 1}, {-1, -1},
+                                        {-1, 0}, {-1, 1}});
+                continue;
+            }
             opponentMoves =
-                opponent->moves(emptyOpponents, boundaries.first, boundaries.second, friendlies);
+                opponent->moves(emptyOpponents, boundaries.first, boundaries.second, blockers);
 
             extractPositionsFromMoves(threatenings, opponentMoves);
         }
@@ -191,4 +207,14 @@ namespace Pieces {
         }
     }
 
+    void King::extractPositionsAround(std::unordered_set<Position> &threatenings,
+                                      const Piece *piece,
+                                      const std::vector<std::pair<int, int>> &offsets) {
+        Position initialPosition = piece->position();
+        for (const auto &[rowDiff, columnDiff] : offsets) {
+            threatenings.insert(
+                Position(initialPosition.row() + rowDiff, initialPosition.column() + columnDiff));
+        }
+    }
+
 } // namespace Pieces
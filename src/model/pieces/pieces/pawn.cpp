@@ -2,11 +2,19 @@
 
 namespace Pieces {
     Pawn::Pawn()
-        : Piece(Types::PAWN) {}
+        : Piece(Types::PAWN)
+        , _forward(Move::Direction::UP) {}
     Pawn::Pawn(const Position &position)
-        : Piece(position, Types::PAWN) {}
+        : Piece(position, Types::PAWN)
+        , _forward(Move::Direction::UP) {}
     Pawn::Pawn(const Position &position, Player *player)
-        : Piece(position, player, Types::PAWN) {}
+        : Piece(position, player, Types::PAWN)
+        , _forward(Move::Direction::UP) {}
+    Pawn::Pawn(const Position &position, Player *player, Move::Direction forward)
+        : Piece(position, player, Types::PAWN)
+        , _forward(forward) {}
+
+    Move::Direction Pawn::forward() const { return _forward; }
 
     std::unordered_map<Position, Move> &Pawn::_moves(std::unordered_map<Position, Move> &moves,
                                                      int &nRow, int &nColumn) {
@@ -23,10 +31,11 @@ namespace Pieces {
         int initialRow = initialPosition.row();
         int initialColumn = initialPosition.column();
 
+        int rowDiff = std::pair<int, int>(_forward).first;
         int maxDisplacement = (nMoves() == 0) ? 2 : 1;
-        Position endDisplacement(initialRow + maxDisplacement, initialColumn);
+        Position endDisplacement(initialRow + maxDisplacement * rowDiff, initialColumn);
 
-        genMovesInDirection(moves, endDisplacement, Move::Direction::UP, captures);
+        genMovesInDirection(moves, endDisplacement, _forward, captures);
         completeCaptureMoves(moves, captures);
         return removeMovesOutsideBounds(moves, boundaries);
     }
@@ -37,8 +46,10 @@ namespace Pieces {
         Position initialPosition = position();
         int initialRow = initialPosition.row();
         int initialColumn = initialPosition.column();
-        std::vector<Position> capturePositions = {Position(initialRow + 1, initialColumn - 1),
-                                                  Position(initialRow + 1, initialColumn + 1)};
+        int rowDiff = std::pair<int, int>(_forward).first;
+        std::vector<Position> capturePositions = {
+            Position(initialRow + rowDiff, initialColumn - 1),
+            Position(initialRow + rowDiff, initialColumn + 1)};
 
         for (const Position &capturePosition : capturePositions) {
             if (!isInBounds(capturePosition, nRow, nColumn)) continue;
@@ -55,6 +55,16 @@ namespace Pieces {
         _nMoves++;
     };
 
+    void Piece::unMove(const Position position) {
+        _position = position;
+        _nMoves--;
+    };
+
+    void Piece::place(const Position position, int nMoves) {
+        _position = position;
+        _nMoves = nMoves;
+    };
+
     std::unordered_map<Position, Move>
     Piece::moves(std::unordered_map<Position, Piece *> &friendlies, int nRow, int nColumn,
                  std::unordered_map<Position, Piece *> &opponents) {
@@ -36,6 +36,27 @@ namespace Pieces {
 
     int Types::hash() const { return static_cast<int>(_type) << 1; }
 
+    int Types::index() const { return static_cast<int>(_type); }
+
+    int Types::value() const {
+        switch (_type) {
+        case Types::_Types::KING:
+            return 20000;
+        case Types::_Types::QUEEN:
+            return 900;
+        case Types::_Types::ROOK:
+            return 500;
+        case Types::_Types::BISHOP:
+            return 330;
+        case Types::_Types::KNIGHT:
+            return 320;
+        case Types::_Types::PAWN:
+            return 100;
+        default:
+            return 0;
+        }
+    }
+
     bool Types::operator==(const Types &other) const { return _type == other._type; };
 
     bool Types::operator!=(const Types &other) const { return !(_type == other._type); };
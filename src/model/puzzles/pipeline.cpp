@@ -0,0 +1,237 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "model/notation/notation.hpp"
+#include "model/puzzles/puzzles.hpp"
+#include "model/utils/bounded_queue.hpp"
+
+namespace Puzzles {
+    namespace {
+        bool isEmpty(const Pieces::Move &move) {
+            return Search::Heuristics::key(move) == Search::Heuristics::NO_MOVE;
+        }
+
+        std::size_t poolSize(std::size_t n) {
+            return (n == 0) ? std::max(1U, std::thread::hardware_concurrency()) : n;
+        }
+    } // namespace
+
+    std::string Puzzle::epd() const {
+        // Position fields only: the clocks give way to the operations
+        std::string epd;
+        int nFields = 0;
+        for (char c : this->fen) {
+            if (c == ' ' && ++nFields == 4) break;
+
+            epd += c;
+        }
+        epd += " bm " + this->moves.front() + "; pv";
+        for (auto &move : this->moves) epd += " " + move;
+        epd += "; ce " + std::to_string(this->score) + "; id \"" + std::to_string(this->game + 1) +
+               "." + std::to_string(this->ply) + "\";";
+        return epd;
+    }
+
+    Pipeline::Pipeline()
+        : Pipeline(Options()) {}
+
+    Pipeline::Pipeline(Options options)
+        : _options(options) {}
+
+    Stats Pipeline::run(const Archive::Reader &reader, std::ostream &out) const {
+        auto &options = this->_options;
+        std::size_t nAnalyzers = poolSize(options.nAnalyzers);
+        std::size_t nVerifiers = poolSize(options.nVerifiers);
+        std::size_t queueSize = std::max<std::size_t>(options.queueSize, 1);
+        Utils::BoundedQueue<Archived> games(queueSize);
+        Utils::BoundedQueue<Candidate> candidates(queueSize);
+        Utils::BoundedQueue<Puzzle> puzzles(queueSize);
+
+        std::mutex mutex;
+        std::exception_ptr failure;
+        // Closing every queue unblocks every stage
+        auto fail = [&]() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!failure) failure = std::current_exception();
+            }
+            games.close();
+            candidates.close();
+            puzzles.close();
+        };
+
+        Stats stats;
+        std::atomic<std::size_t> nPositions{0}, nCandidates{0};
+        std::atomic<std::size_t> nAnalyzing{nAnalyzers}, nVerifying{nVerifiers};
+        std::vector<std::thread> threads;
+
+        threads.emplace_back([&]() {
+            try {
+                for (std::size_t i = 0; i < reader.size(); ++i) {
+                    auto record = reader.record(i);
+                    if (!games.push({i, std::string(record.fen()), std::move(record.moves)})) break;
+
+                    stats.nGames++;
+                }
+            } catch (...) {
+                fail();
+            }
+            games.close();
+        });
+        for (std::size_t id = 0; id < nAnalyzers; ++id) {
+            threads.emplace_back([&]() {
+                try {
+                    Game::Board board(8, 8);
+                    Pieces::Player first("White"), second("Black");
+                    Search::Searcher searcher;
+                    Archived archived;
+                    while (games.pop(archived)) {
+                        auto analysis = this->analyze(archived, board, first, second, searcher);
+                        nPositions += analysis.nPositions;
+                        for (auto &candidate : analysis.candidates) {
+                            if (!candidates.push(std::move(candidate))) break;
+
+                            nCandidates++;
+                        }
+                    }
+                } catch (...) {
+                    fail();
+                }
+                if (--nAnalyzing == 0) candidates.close();
+            });
+        }
+        for (std::size_t id = 0; id < nVerifiers; ++id) {
+            threads.emplace_back([&]() {
+                try {
+                    Game::Board board(8, 8);
+                    Pieces::Player first("White"), second("Black");
+                    Search::Searcher searcher;
+                    Candidate candidate;
+                    while (candidates.pop(candidate)) {
+                        Puzzle puzzle;
+                        if (!this->verify(candidate, board, first, second, searcher, puzzle)) {
+                            continue;
+                        }
+                        if (!puzzles.push(std::move(puzzle))) break;
+                    }
+                } catch (...) {
+                    fail();
+                }
+                if (--nVerifying == 0) puzzles.close();
+            });
+        }
+        threads.emplace_back([&]() {
+            try {
+                Puzzle puzzle;
+                while (puzzles.pop(puzzle)) {
+                    out << puzzle.epd() << '\n';
+                    stats.nPuzzles++;
+                }
+                out.flush();
+            } catch (...) {
+                fail();
+            }
+        });
+        for (auto &thread : threads) thread.join();
+
+        if (failure) std::rethrow_exception(failure);
+
+        stats.nPositions = nPositions;
+        stats.nCandidates = nCandidates;
+        return stats;
+    }
+
+    Analysis Pipeline::analyze(const Archived &archived, Game::Board &board,
+                               Pieces::Player &first, Pieces::Player &second,
+                               Search::Searcher &searcher) const {
+        auto &options = this->_options;
+        Search::Searcher::Limits limits;
+        limits.depth = options.depth;
+        board.initialize(first, second, archived.fen);
+        searcher.heuristics().clear();
+
+        Analysis analysis;
+        // Score of the player to move before the last move, valid from minPly on
+        int previous = 0;
+        for (int ply = 0; ply <= static_cast<int>(archived.moves.size()); ++ply) {
+            if (ply >= options.minPly && board.status() == Game::Status::IN_PROGRESS) {
+                int score = searcher.search(board, limits).score;
+                analysis.nPositions++;
+                // The previous mover lost swing and the player to move now wins
+                if (ply > options.minPly && previous + score >= options.swing &&
+                    score >= options.winScore && previous > -options.winScore) {
+                    analysis.candidates.push_back({archived.index, ply, board.fen(), score});
+                }
+                previous = score;
+            }
+            if (ply == static_cast<int>(archived.moves.size())) break;
+
+            board.move(Archive::decodeMove(board, archived.moves[ply]));
+        }
+        return analysis;
+    }
+
+    bool Pipeline::verify(const Candidate &candidate, Game::Board &board, Pieces::Player &first,
+                          Pieces::Player &second, Search::Searcher &searcher,
+                          Puzzle &puzzle) const {
+        auto &options = this->_options;
+        board.initialize(first, second, candidate.fen);
+        searcher.heuristics().clear();
+        puzzle = {candidate.game, candidate.ply, candidate.fen, {}, 0};
+
+        Search::Searcher::Limits limits;
+        limits.depth = options.verifyDepth;
+        for (int i = 0; i < options.maxMoves; ++i) {
+            int score;
+            auto move = this->unique(board, searcher, score);
+            if (isEmpty(move)) {
+                // The line ends with a move of the solver
+                if (!puzzle.moves.empty()) puzzle.moves.pop_back();
+                break;
+            }
+            if (i == 0) puzzle.score = score;
+            puzzle.moves.push_back(Notation::SAN::format(board, move));
+            board.move(move);
+            if (board.status() != Game::Status::IN_PROGRESS || i + 1 == options.maxMoves) break;
+
+            auto reply = searcher.search(board, limits).move;
+            puzzle.moves.push_back(Notation::SAN::format(board, reply));
+            board.move(reply);
+            if (board.status() != Game::Status::IN_PROGRESS) {
+                puzzle.moves.pop_back();
+                break;
+            }
+        }
+        return !puzzle.moves.empty();
+    }
+
+    Pieces::Move Pipeline::unique(Game::Board &board, Search::Searcher &searcher,
+                                  int &score) const {
+        auto &options = this->_options;
+        Search::Searcher::Limits limits;
+        limits.depth = options.verifyDepth;
+        auto best = searcher.search(board, limits);
+        score = best.score;
+        if (isEmpty(best.move) || best.score < options.winScore) return Pieces::Move();
+
+        // Every other move, searched one ply less from the opponent's side
+        int bound = std::min(best.score - options.margin, options.winScore);
+        limits.depth = std::max(options.verifyDepth - 1, 1);
+        for (auto &move : board.legalMoves()) {
+            if (move == best.move) continue;
+
+            board.move(move);
+            int other = (board.status() == Game::Status::ENDED_CHECKMATE)
+                            ? Search::MATE
+                        : (board.status() == Game::Status::IN_PROGRESS)
+                            ? -searcher.search(board, limits).score
+                            : 0;
+            board.unMove();
+            if (other >= bound) return Pieces::Move();
+        }
+        return best.move;
+    }
+} // namespace Puzzles
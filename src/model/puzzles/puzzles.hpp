@@ -0,0 +1,128 @@
+#ifndef PUZZLES_HPP
+#define PUZZLES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "model/archive/archive.hpp"
+#include "model/search/search.hpp"
+
+/**
+ * @brief Tactical puzzles found in archived games
+ *    - A reader thread streams the games, a pool of analyzers searches every
+ *      position for a move that throws the game away, a pool of verifiers
+ *      keeps the positions with a single winning line and a writer thread
+ *      prints them as EPD
+ *    - Stages are connected by bounded queues, so that a slow stage
+ *      throttles the previous ones instead of growing memory
+ */
+namespace Puzzles {
+    struct Options {
+        // 0 for one thread per core in each pool
+        std::size_t nAnalyzers = 0;
+        std::size_t nVerifiers = 0;
+        std::size_t queueSize = 64;
+        // Search depth of every position of a game
+        int depth = 3;
+        // Search depth of the solver's moves, the other moves get one ply less
+        int verifyDepth = 4;
+        // Plies skipped at the start of a game
+        int minPly = 0;
+        // Candidate when a move loses swing centipawns and leaves the
+        // opponent at winScore or more
+        int swing = 200;
+        int winScore = 250;
+        // Unique when every other move scores below min(best - margin, winScore)
+        int margin = 150;
+        // Solver's moves of the longest solution
+        int maxMoves = 3;
+    };
+
+    /**
+     * @brief A game taken from the archive, owning its strings
+     */
+    struct Archived {
+        std::size_t index = 0;
+        std::string fen;
+        std::vector<std::uint16_t> moves;
+    };
+
+    /**
+     * @brief Position right after a losing move, the opponent to move
+     */
+    struct Candidate {
+        std::size_t game = 0;
+        // Plies played from the start of the game
+        int ply = 0;
+        std::string fen;
+        // Score of the opponent found by the analyzer
+        int score = 0;
+    };
+
+    struct Analysis {
+        std::vector<Candidate> candidates;
+        std::size_t nPositions = 0;
+    };
+
+    struct Puzzle {
+        std::size_t game = 0;
+        int ply = 0;
+        std::string fen;
+        // Solution in SAN, the solver's moves and the opponent's replies
+        std::vector<std::string> moves;
+        int score = 0;
+
+        /**
+         * @brief EPD record: "bm" the first move, "pv" the solution, "ce" the
+         *        score and "id" the game number from 1 and the ply
+         */
+        std::string epd() const;
+    };
+
+    struct Stats {
+        std::size_t nGames = 0;
+        std::size_t nPositions = 0;
+        std::size_t nCandidates = 0;
+        std::size_t nPuzzles = 0;
+    };
+
+    class Pipeline {
+      public:
+        Pipeline();
+        explicit Pipeline(Options options);
+
+        /**
+         * @brief Write the puzzles of every game of the archive, one EPD line
+         *        each, in completion order
+         * @throw std::runtime_error if a stage fails, after every thread has stopped
+         */
+        Stats run(const Archive::Reader &reader, std::ostream &out) const;
+
+        /**
+         * @brief Search every position of a game and keep the ones after a losing move
+         */
+        Analysis analyze(const Archived &archived, Game::Board &board, Pieces::Player &first,
+                         Pieces::Player &second, Search::Searcher &searcher) const;
+
+        /**
+         * @brief Follow the solver's unique winning moves from a candidate
+         * @return false if the first move already isn't unique
+         */
+        bool verify(const Candidate &candidate, Game::Board &board, Pieces::Player &first,
+                    Pieces::Player &second, Search::Searcher &searcher, Puzzle &puzzle) const;
+
+      private:
+        Options _options;
+
+        /**
+         * @brief The winning move of the player to move if it is the only one,
+         *        a move with no action otherwise
+         */
+        Pieces::Move unique(Game::Board &board, Search::Searcher &searcher, int &score) const;
+    };
+} // namespace Puzzles
+
+#endif // PUZZLES_HPP
@@ -0,0 +1,130 @@
+#include "model/search/search.hpp"
+
+namespace Search {
+    namespace {
+        Parameters &current() {
+            static Parameters parameters = Parameters::defaults();
+            return parameters;
+        }
+
+        int evaluatePosition(const Game::Board &board) {
+            auto *player = board.turn();
+            int perspective = board.color(player);
+            if (board.network() != nullptr) {
+                return board.network()->evaluate(board.accumulator(), perspective);
+            }
+
+            auto &parameters = current();
+            auto boundaries = board.boundaries();
+            bool hasTables = (boundaries.first == 8) && (boundaries.second == 8);
+            int score = 0;
+            Position captured;
+            for (auto *piece : board.pieces()) {
+                auto position = piece->position();
+                if (position == captured) continue;
+
+                auto type = piece->type();
+                int color = board.color(piece);
+                int value = parameters.material[type.index()];
+                if (hasTables) {
+                    int row = (color == NNUE::Network::BLACK) ? 7 - position.row() : position.row();
+                    value += parameters.tables[type.index()][row * 8 + position.column()];
+                }
+                score += (color == perspective) ? value : -value;
+            }
+            return score;
+        }
+
+        int evaluateKPK(const Game::Board &board) {
+            Tablebase::WDL wdl;
+            if (!Tablebase::KPK::probe(board, wdl)) return evaluatePosition(board);
+
+            if (wdl == Tablebase::WDL::DRAW) return 0;
+
+            // A won King and Pawn against King is worth more than the Pawn
+            // but less than the Queen it promotes to
+            int bonus = Pieces::Types::ROOK.value();
+            if (wdl == Tablebase::WDL::LOSS) bonus = -bonus;
+            return evaluatePosition(board) + bonus;
+        }
+
+        int distance(Position a, Position b) {
+            return std::max(std::abs(a.row() - b.row()), std::abs(a.column() - b.column()));
+        }
+
+        /**
+         * @brief Mating material against a bare King: drive the King to the
+         *        edge, or to a corner of the Bishop's color with Bishop and Knight
+         */
+        int evaluateKXK(const Game::Board &board, const Game::Material::Entry &entry) {
+            auto boundaries = board.boundaries();
+            int lastRow = boundaries.first - 1, lastColumn = boundaries.second - 1;
+            Position kings[2], bishop, knight;
+            int material = 0;
+            Position captured;
+            for (auto *piece : board.pieces()) {
+                auto position = piece->position();
+                if (position == captured) continue;
+
+                auto type = piece->type();
+                if (type == Pieces::Types::KING) {
+                    kings[board.color(piece)] = position;
+                    continue;
+                }
+                material += type.value();
+                if (type == Pieces::Types::BISHOP) bishop = position;
+                if (type == Pieces::Types::KNIGHT) knight = position;
+            }
+            Position weak = kings[1 - entry.strong];
+
+            int push;
+            if (knight != captured && bishop != captured) {
+                int parity = (bishop.row() + bishop.column()) % 2;
+                int corner = std::max(lastRow, lastColumn);
+                for (Position to : {Position(0, 0), Position(0, lastColumn), Position(lastRow, 0),
+                                    Position(lastRow, lastColumn)}) {
+                    if ((to.row() + to.column()) % 2 != parity) continue;
+
+                    corner = std::min(corner, distance(weak, to));
+                }
+                push = 4 * (std::max(lastRow, lastColumn) - corner);
+            } else {
+                push = std::abs(2 * weak.row() - lastRow) +
+                       std::abs(2 * weak.column() - lastColumn);
+            }
+            int score = KNOWN_WIN + material + 20 * push - 10 * distance(kings[0], kings[1]);
+            return (board.color(board.turn()) == entry.strong) ? score : -score;
+        }
+    } // namespace
+
+    int Evaluation::evaluate(const Game::Board &board) {
+        auto &entry = Game::Material::probe(board.materialKey());
+        switch (entry.endgame) {
+        case Game::Material::Endgame::INSUFFICIENT:
+            return 0;
+        case Game::Material::Endgame::KPK:
+            return evaluateKPK(board);
+        case Game::Material::Endgame::KXK:
+            return evaluateKXK(board, entry);
+        default:
+            return evaluatePosition(board);
+        }
+    }
+
+    const Parameters &Evaluation::parameters() { return current(); }
+
+    void Evaluation::parameters(const Parameters &parameters) { current() = parameters; }
+
+    int Evaluation::mvvLva(const Pieces::Move &move) {
+        int score = 0;
+        auto *captured = move.captured();
+        if (captured != nullptr) score += 10 * captured->type().value();
+
+        auto *promoted = move.promoted();
+        if (promoted != nullptr) score += 10 * promoted->type().value();
+
+        if (score == 0) return 0;
+
+        return score - move.piece()->type().value() / 10;
+    }
+} // namespace Search
@@ -0,0 +1,122 @@
+#include "model/search/search.hpp"
+
+namespace Search {
+    namespace {
+        const int N_KEYS = Heuristics::N_SQUARES * Heuristics::N_SQUARES;
+        const int N_CONTINUATIONS = Heuristics::N_PIECES * Heuristics::N_SQUARES;
+        const int BONUS_MAX = Heuristics::HISTORY_MAX / 8;
+
+        int square(const Position &position) { return position.row() * 8 + position.column(); }
+    } // namespace
+
+    Heuristics::Heuristics()
+        : _history(2 * N_KEYS, 0)
+        , _continuation(N_CONTINUATIONS * N_CONTINUATIONS, 0)
+        , _counterMoves(2 * N_KEYS, NO_MOVE)
+        , _killers() {
+        this->clear();
+    }
+
+    void Heuristics::clear() {
+        std::fill(this->_history.begin(), this->_history.end(), 0);
+        std::fill(this->_continuation.begin(), this->_continuation.end(), 0);
+        std::fill(this->_counterMoves.begin(), this->_counterMoves.end(), NO_MOVE);
+        for (auto &killers : this->_killers) {
+            killers.fill(NO_MOVE);
+        }
+    }
+
+    void Heuristics::age() {
+        for (auto &entry : this->_history) {
+            entry /= 2;
+        }
+        for (auto &entry : this->_continuation) {
+            entry /= 2;
+        }
+        for (auto &killers : this->_killers) {
+            killers.fill(NO_MOVE);
+        }
+    }
+
+    int Heuristics::killer(int ply, int slot) const { return this->_killers[ply][slot]; }
+
+    int Heuristics::counterMove(int side, const Pieces::Move *previous) const {
+        if (previous == nullptr) return NO_MOVE;
+
+        int previousKey = key(*previous);
+        return (previousKey == NO_MOVE) ? NO_MOVE : this->_counterMoves[side * N_KEYS + previousKey];
+    }
+
+    int Heuristics::history(int side, const Pieces::Move &move) const {
+        return this->_history[side * N_KEYS + key(move)];
+    }
+
+    int Heuristics::continuation(const Game::Board &board, const Pieces::Move *previous,
+                                 const Pieces::Move &move) const {
+        if (previous == nullptr || key(*previous) == NO_MOVE) return 0;
+
+        int from = piece(board, *previous) * N_SQUARES + square(previous->to());
+        int to = piece(board, move) * N_SQUARES + square(move.to());
+        return this->_continuation[from * N_CONTINUATIONS + to];
+    }
+
+    int Heuristics::quietScore(const Game::Board &board, const Pieces::Move &move,
+                               const Pieces::Move *previous) const {
+        int side = board.color(board.turn());
+        return this->history(side, move) + this->continuation(board, previous, move);
+    }
+
+    void Heuristics::update(const Game::Board &board, const Pieces::Move &best, int depth,
+                            int ply, const Pieces::Move *previous,
+                            const Pieces::Move *const *tried, int nTried) {
+        int bestKey = key(best);
+        auto &killers = this->_killers[ply];
+        if (killers[0] != bestKey) {
+            killers[1] = killers[0];
+            killers[0] = static_cast<std::int16_t>(bestKey);
+        }
+
+        int side = board.color(board.turn());
+        if (previous != nullptr && key(*previous) != NO_MOVE) {
+            this->_counterMoves[side * N_KEYS + key(*previous)] =
+                static_cast<std::int16_t>(bestKey);
+        }
+
+        int bonus = std::min(16 * depth * depth, BONUS_MAX);
+        this->updateScores(board, best, previous, bonus);
+        for (int i = 0; i < nTried; ++i) {
+            if (key(*tried[i]) == bestKey) continue;
+
+            this->updateScores(board, *tried[i], previous, -bonus);
+        }
+    }
+
+    int Heuristics::key(const Pieces::Move &move) {
+        Position from = move.from();
+        if (from.row() < 0) return NO_MOVE;
+
+        return square(from) * N_SQUARES + square(move.to());
+    }
+
+    void Heuristics::updateScores(const Game::Board &board, const Pieces::Move &move,
+                                  const Pieces::Move *previous, int bonus) {
+        int side = board.color(board.turn());
+        gravity(this->_history[side * N_KEYS + key(move)], bonus);
+
+        if (previous == nullptr || key(*previous) == NO_MOVE) return;
+
+        int from = piece(board, *previous) * N_SQUARES + square(previous->to());
+        int to = piece(board, move) * N_SQUARES + square(move.to());
+        gravity(this->_continuation[from * N_CONTINUATIONS + to], bonus);
+    }
+
+    int Heuristics::piece(const Game::Board &board, const Pieces::Move &move) {
+        auto *piece = move.piece();
+        return board.color(piece) * 6 + piece->type().index();
+    }
+
+    void Heuristics::gravity(std::int16_t &entry, int bonus) {
+        int value = entry + bonus - entry * std::abs(bonus) / HISTORY_MAX;
+        entry = static_cast<std::int16_t>(std::clamp(value, -HISTORY_MAX, HISTORY_MAX));
+    }
+} // namespace Search
@@ -0,0 +1,172 @@
+#include "model/search/search.hpp"
+
+namespace Search {
+    MovePicker::MovePicker(Game::Board &board, const Pieces::Move &ttMove,
+                           const Heuristics *heuristics, int ply, const Pieces::Move *previous)
+        : _board(board)
+        , _heuristics(heuristics)
+        , _previous(previous)
+        , _ttMove(ttMove)
+        , _hasTTMove(false)
+        , _isSkippingQuiets(false)
+        , _refutations()
+        , _stage(Stage::TT_MOVE)
+        , _current(0)
+        , _end(0)
+        , _nTactical(0)
+        , _nMoves(-1)
+        , _nBadCaptures(0)
+        , _nYielded(0)
+        , _moves()
+        , _indexes()
+        , _scores()
+        , _badCaptures()
+        , _yielded() {
+        this->_refutations.fill(Heuristics::NO_MOVE);
+        if (heuristics != nullptr) {
+            for (int slot = 0; slot < Heuristics::N_KILLERS; ++slot) {
+                this->_refutations[slot] = heuristics->killer(ply, slot);
+            }
+            this->_refutations[Heuristics::N_KILLERS] =
+                heuristics->counterMove(board.color(board.turn()), previous);
+        }
+    }
+
+    const Pieces::Move *MovePicker::next() {
+        while (true) {
+            switch (this->_stage) {
+            case Stage::TT_MOVE:
+                if (!this->_hasTTMove) {
+                    this->_hasTTMove = this->_board.isPlayable(this->_ttMove);
+                    if (this->_hasTTMove) return &this->_ttMove;
+                }
+                this->_stage = Stage::GOOD_CAPTURES;
+                break;
+
+            case Stage::GOOD_CAPTURES: {
+                if (this->_nMoves < 0) this->scoreCaptures();
+                int index = this->pickBest();
+                if (index < 0) {
+                    this->_stage = Stage::REFUTATIONS;
+                    this->_current = 0;
+                    break;
+                }
+                if (this->_board.see(this->_moves[index]) < 0) {
+                    this->_badCaptures[this->_nBadCaptures++] = index;
+                    break;
+                }
+                return &this->_moves[index];
+            }
+
+            case Stage::REFUTATIONS:
+                while (!this->_isSkippingQuiets && this->_current < N_REFUTATIONS) {
+                    int key = this->_refutations[this->_current++];
+                    if (key == Heuristics::NO_MOVE) continue;
+
+                    this->generateQuiets();
+                    int index = this->findQuiet(key);
+                    if (index < 0 || this->isSkipped(index)) continue;
+
+                    this->_yielded[this->_nYielded++] = index;
+                    return &this->_moves[index];
+                }
+                this->_stage = Stage::QUIETS;
+                this->scoreQuiets();
+                break;
+
+            case Stage::QUIETS: {
+                int index = this->_isSkippingQuiets ? -1 : this->pickBest();
+                if (index >= 0) return &this->_moves[index];
+
+                this->_stage = Stage::BAD_CAPTURES;
+                this->_current = 0;
+                break;
+            }
+
+            case Stage::BAD_CAPTURES:
+                if (this->_current < this->_nBadCaptures) {
+                    return &this->_moves[this->_badCaptures[this->_current++]];
+                }
+                this->_stage = Stage::DONE;
+                break;
+
+            case Stage::DONE:
+                return nullptr;
+            }
+        }
+    }
+
+    void MovePicker::skipQuiets() { this->_isSkippingQuiets = true; }
+
+    MovePicker::Stage MovePicker::stage() const { return this->_stage; }
+
+    void MovePicker::generateQuiets() {
+        if (this->_nMoves > this->_nTactical) return;
+
+        this->_nMoves += static_cast<int>(
+            this->_board.legalMoves(Game::Board::Generation::QUIET, &this->_moves[this->_nMoves],
+                                    MAX_MOVES - this->_nMoves));
+    }
+
+    void MovePicker::scoreCaptures() {
+        this->_nTactical = static_cast<int>(this->_board.legalMoves(
+            Game::Board::Generation::TACTICAL, this->_moves.data(), MAX_MOVES));
+        this->_nMoves = this->_nTactical;
+        this->_current = 0;
+        this->_end = 0;
+        for (int index = 0; index < this->_nTactical; ++index) {
+            auto &move = this->_moves[index];
+            if (this->_hasTTMove && move == this->_ttMove) continue;
+
+            this->_indexes[this->_end] = index;
+            this->_scores[this->_end++] = Evaluation::mvvLva(move);
+        }
+    }
+
+    void MovePicker::scoreQuiets() {
+        this->_current = 0;
+        this->_end = 0;
+        if (this->_isSkippingQuiets) return;
+
+        this->generateQuiets();
+        for (int index = this->_nTactical; index < this->_nMoves; ++index) {
+            if (this->isSkipped(index)) continue;
+
+            int score = 0;
+            if (this->_heuristics != nullptr) {
+                score = this->_heuristics->quietScore(this->_board, this->_moves[index],
+                                                      this->_previous);
+            }
+            this->_indexes[this->_end] = index;
+            this->_scores[this->_end++] = score;
+        }
+    }
+
+    int MovePicker::pickBest() {
+        if (this->_current >= this->_end) return -1;
+
+        int best = this->_current;
+        for (int i = this->_current + 1; i < this->_end; ++i) {
+            if (this->_scores[i] > this->_scores[best]) best = i;
+        }
+        std::swap(this->_indexes[best], this->_indexes[this->_current]);
+        std::swap(this->_scores[best], this->_scores[this->_current]);
+        return this->_indexes[this->_current++];
+    }
+
+    int MovePicker::findQuiet(int key) const {
+        for (int index = this->_nTactical; index < this->_nMoves; ++index) {
+            if (Heuristics::key(this->_moves[index]) == key) return index;
+        }
+        return -1;
+    }
+
+    bool MovePicker::isSkipped(int index) const {
+        if (this->_hasTTMove && this->_moves[index] == this->_ttMove) return true;
+
+        for (int i = 0; i < this->_nYielded; ++i) {
+            if (this->_yielded[i] == index) return true;
+        }
+        return false;
+    }
+} // namespace Search
@@ -0,0 +1,137 @@
+#include <fstream>
+#include <sstream>
+
+#include "model/search/search.hpp"
+
+namespace Search {
+    namespace {
+        // Piece-square tables from the first player's side, indexed by row * 8 + column
+        // clang-format off
+        const int PAWN_TABLE[64] = {
+             0,  0,   0,   0,   0,   0,  0,  0,
+             5, 10,  10, -20, -20,  10, 10,  5,
+             5, -5, -10,   0,   0, -10, -5,  5,
+             0,  0,   0,  20,  20,   0,  0,  0,
+             5,  5,  10,  25,  25,  10,  5,  5,
+            10, 10,  20,  30,  30,  20, 10, 10,
+            50, 50,  50,  50,  50,  50, 50, 50,
+             0,  0,   0,   0,   0,   0,  0,  0};
+        const int KNIGHT_TABLE[64] = {
+            -50, -40, -30, -30, -30, -30, -40, -50,
+            -40, -20,   0,   5,   5,   0, -20, -40,
+            -30,   5,  10,  15,  15,  10,   5, -30,
+            -30,   0,  15,  20,  20,  15,   0, -30,
+            -30,   5,  15,  20,  20,  15,   5, -30,
+            -30,   0,  10,  15,  15,  10,   0, -30,
+            -40, -20,   0,   0,   0,   0, -20, -40,
+            -50, -40, -30, -30, -30, -30, -40, -50};
+        const int BISHOP_TABLE[64] = {
+            -20, -10, -10, -10, -10, -10, -10, -20,
+            -10,   5,   0,   0,   0,   0,   5, -10,
+            -10,  10,  10,  10,  10,  10,  10, -10,
+            -10,   0,  10,  10,  10,  10,   0, -10,
+            -10,   5,   5,  10,  10,   5,   5, -10,
+            -10,   0,   5,  10,  10,   5,   0, -10,
+            -10,   0,   0,   0,   0,   0,   0, -10,
+            -20, -10, -10, -10, -10, -10, -10, -20};
+        const int ROOK_TABLE[64] = {
+             0,  0,  0,  5,  5,  0,  0,  0,
+            -5,  0,  0,  0,  0,  0,  0, -5,
+            -5,  0,  0,  0,  0,  0,  0, -5,
+            -5,  0,  0,  0,  0,  0,  0, -5,
+            -5,  0,  0,  0,  0,  0,  0, -5,
+            -5,  0,  0,  0,  0,  0,  0, -5,
+             5, 10, 10, 10, 10, 10, 10,  5,
+             0,  0,  0,  0,  0,  0,  0,  0};
+        const int QUEEN_TABLE[64] = {
+            -20, -10, -10, -5, -5, -10, -10, -20,
+            -10,   0,   5,  0,  0,   0,   0, -10,
+            -10,   5,   5,  5,  5,   5,   0, -10,
+              0,   0,   5,  5,  5,   5,   0,  -5,
+             -5,   0,   5,  5,  5,   5,   0,  -5,
+            -10,   0,   5,  5,  5,   5,   0, -10,
+            -10,   0,   0,  0,  0,   0,   0, -10,
+            -20, -10, -10, -5, -5, -10, -10, -20};
+        const int KING_TABLE[64] = {
+             20,  30,  10,   0,   0,  10,  30,  20,
+             20,  20,   0,   0,   0,   0,  20,  20,
+            -10, -20, -20, -20, -20, -20, -20, -10,
+            -20, -30, -30, -40, -40, -30, -30, -20,
+            -30, -40, -40, -50, -50, -40, -40, -30,
+            -30, -40, -40, -50, -50, -40, -40, -30,
+            -30, -40, -40, -50, -50, -40, -40, -30,
+            -30, -40, -40, -50, -50, -40, -40, -30};
+        // clang-format on
+
+        const int *const TABLES[6] = {KING_TABLE,   QUEEN_TABLE,  ROOK_TABLE,
+                                      BISHOP_TABLE, KNIGHT_TABLE, PAWN_TABLE};
+
+        const Pieces::Types TYPES[Parameters::N_TYPES] = {
+            Pieces::Types::KING,   Pieces::Types::QUEEN,  Pieces::Types::ROOK,
+            Pieces::Types::BISHOP, Pieces::Types::KNIGHT, Pieces::Types::PAWN};
+    } // namespace
+
+    Parameters Parameters::defaults() {
+        Parameters parameters;
+        for (int type = 0; type < N_TYPES; ++type) {
+            // The King is never captured, its value would only cancel out
+            parameters.material[type] =
+                (TYPES[type] == Pieces::Types::KING) ? 0 : TYPES[type].value();
+            std::copy(TABLES[type], TABLES[type] + N_SQUARES, parameters.tables[type].begin());
+        }
+        return parameters;
+    }
+
+    Parameters Parameters::load(const std::string &path) {
+        std::ifstream file(path);
+        if (!file) throw std::runtime_error("Cannot open parameters: path='" + path + "'");
+
+        auto invalid = [&path](const std::string &reason) {
+            return std::runtime_error("Invalid parameters " + reason + ": path='" + path + "'");
+        };
+        Parameters parameters = defaults();
+        std::string line, name;
+        while (std::getline(file, line)) {
+            std::istringstream words(line);
+            if (!(words >> name) || name[0] == '#') continue;
+
+            int *values = nullptr;
+            int size = N_SQUARES;
+            if (name == "MATERIAL") {
+                values = parameters.material.data();
+                size = N_TYPES;
+            }
+            for (int type = 0; type < N_TYPES && values == nullptr; ++type) {
+                if (name == std::string(TYPES[type])) values = parameters.tables[type].data();
+            }
+            if (values == nullptr) throw invalid("name '" + name + "'");
+
+            for (int i = 0; i < size; ++i) {
+                if (!(words >> values[i])) throw invalid("values of '" + name + "'");
+            }
+            std::string extra;
+            if (words >> extra) throw invalid("values of '" + name + "'");
+        }
+        return parameters;
+    }
+
+    void Parameters::save(const std::string &path) const {
+        std::ofstream file(path, std::ios::trunc);
+        if (!file) throw std::runtime_error("Cannot create parameters: path='" + path + "'");
+
+        file << "# Evaluation parameters, in centipawns\nMATERIAL";
+        for (int value : this->material) file << ' ' << value;
+        file << '\n';
+        for (int type = 0; type < N_TYPES; ++type) {
+            file << std::string(TYPES[type]);
+            for (int value : this->tables[type]) file << ' ' << value;
+            file << '\n';
+        }
+        file.close();
+        if (!file) throw std::runtime_error("Cannot write parameters: path='" + path + "'");
+    }
+
+    bool Parameters::operator==(const Parameters &other) const {
+        return this->material == other.material && this->tables == other.tables;
+    }
+} // namespace Search
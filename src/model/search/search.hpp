@@ -0,0 +1,354 @@
+#ifndef SEARCH_HPP
+#define SEARCH_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "model/game/game.hpp"
+#include "model/tablebase/tablebase.hpp"
+
+namespace Search {
+    constexpr int MATE = 32000;
+    constexpr int INFINITE = MATE + 1;
+    constexpr int MAX_PLY = 64;
+    /**
+     * @brief Score of an endgame known to be won, far from the mate scores
+     */
+    constexpr int KNOWN_WIN = 10000;
+
+    /**
+     * @brief Weights of the hand-written evaluation, in centipawns
+     *    - material and tables are indexed by Pieces::Types::index()
+     *    - Tables are seen from the first player's side, indexed by
+     *      row * 8 + column, and only apply to 8x8 boards
+     *    - File: one line per array, "MATERIAL" then the type names
+     *      ("KING", "QUEEN", ...) followed by their values, '#' comments
+     */
+    struct Parameters {
+        static constexpr int N_TYPES = 6;
+        static constexpr int N_SQUARES = 64;
+        // Loaded at startup when it exists in the working directory
+        static constexpr const char *PATH = "evaluation.txt";
+
+        std::array<int, N_TYPES> material;
+        std::array<std::array<int, N_SQUARES>, N_TYPES> tables;
+
+        static Parameters defaults();
+        /**
+         * @throw std::runtime_error if the file is missing or malformed
+         */
+        static Parameters load(const std::string &path);
+        void save(const std::string &path) const;
+
+        bool operator==(const Parameters &other) const;
+    };
+
+    class Evaluation {
+      public:
+        /**
+         * @brief Static evaluation relative to the player to move
+         *    - Uses the Board's NNUE network when one is attached
+         *    - Falls back on material and piece-square tables otherwise
+         *    - Known endgames are dispatched on the Board's material key:
+         *      insufficient material scores 0, King and Pawn against King is
+         *      looked up in the KPK bitbase, mating material against a bare
+         *      King scores KNOWN_WIN plus a bonus to corner the King
+         */
+        static int evaluate(const Game::Board &board);
+
+        /**
+         * @brief Weights used without a network, Parameters::defaults() at first
+         * @warning Not synchronized: set them while no search is running
+         */
+        static const Parameters &parameters();
+        static void parameters(const Parameters &parameters);
+
+        /**
+         * @brief Most Valuable Victim - Least Valuable Aggressor score of a move
+         * @return 0 for a quiet move
+         */
+        static int mvvLva(const Pieces::Move &move);
+    };
+
+    /**
+     * @brief Move ordering memory shared by the nodes of a search
+     *    - Killers: two quiet moves per ply that caused a cutoff
+     *    - History: butterfly table indexed [side][from][to]
+     *    - Continuation: table indexed [previous piece][previous to][piece][to]
+     *    - Countermoves: quiet reply to a move indexed [side][from][to]
+     * Tables are flat arrays of int16 and moves are stored as from * 64 + to
+     * keys so that the whole memory stays small and contiguous.
+     */
+    class Heuristics {
+      public:
+        static constexpr int N_SQUARES = 64;
+        static constexpr int N_PIECES = 12;
+        static constexpr int N_KILLERS = 2;
+        static constexpr int NO_MOVE = -1;
+        static constexpr int HISTORY_MAX = 16384;
+
+        Heuristics();
+
+        /**
+         * @brief Forget everything, e.g. between two games
+         */
+        void clear();
+
+        /**
+         * @brief Halve every score and drop the killers, e.g. between two searches
+         */
+        void age();
+
+        int killer(int ply, int slot) const;
+
+        int counterMove(int side, const Pieces::Move *previous) const;
+
+        int history(int side, const Pieces::Move &move) const;
+
+        int continuation(const Game::Board &board, const Pieces::Move *previous,
+                         const Pieces::Move &move) const;
+
+        /**
+         * @brief Ordering score of a quiet move of the player to move
+         */
+        int quietScore(const Game::Board &board, const Pieces::Move &move,
+                       const Pieces::Move *previous) const;
+
+        /**
+         * @brief Reward the quiet move that caused a cutoff and penalize the
+         *        quiet moves searched before it
+         *    - Scores move toward ±HISTORY_MAX with a gravity update:
+         *      entry += bonus - entry * |bonus| / HISTORY_MAX
+         */
+        void update(const Game::Board &board, const Pieces::Move &best, int depth, int ply,
+                    const Pieces::Move *previous, const Pieces::Move *const *tried, int nTried);
+
+        static int key(const Pieces::Move &move);
+
+      private:
+        std::vector<std::int16_t> _history;
+        std::vector<std::int16_t> _continuation;
+        std::vector<std::int16_t> _counterMoves;
+        std::array<std::array<std::int16_t, N_KILLERS>, MAX_PLY> _killers;
+
+        void updateScores(const Game::Board &board, const Pieces::Move &move,
+                          const Pieces::Move *previous, int bonus);
+
+        static int piece(const Game::Board &board, const Pieces::Move &move);
+
+        static void gravity(std::int16_t &entry, int bonus);
+    };
+
+    /**
+     * @brief Yields the moves of a node stage by stage, each stage being
+     *        generated and scored only once it is reached
+     *    - TT_MOVE: the transposition table move when it is legal
+     *    - GOOD_CAPTURES: captures and promotions with a non-negative SEE, by MVV-LVA
+     *    - REFUTATIONS: killer moves then the countermove, when legal and quiet
+     *    - QUIETS: remaining quiet moves by history and continuation scores
+     *    - BAD_CAPTURES: captures losing material, in MVV-LVA order
+     *    - Quiet moves are only generated when REFUTATIONS is reached, so
+     *      that a cutoff by the TT move or a capture never generates them
+     * @warning Moves, indexes and scores live in fixed-size arrays, the
+     *          returned pointers stay valid as long as the picker
+     */
+    class MovePicker {
+      public:
+        enum class Stage { TT_MOVE, GOOD_CAPTURES, REFUTATIONS, QUIETS, BAD_CAPTURES, DONE };
+
+        static constexpr int MAX_MOVES = 256;
+        static constexpr int N_REFUTATIONS = Heuristics::N_KILLERS + 1;
+
+        /**
+         * @param heuristics Source of the refutations and quiet scores,
+         *        nullptr to keep the generation order
+         * @param previous The move that led to the node, nullptr at the root
+         */
+        MovePicker(Game::Board &board, const Pieces::Move &ttMove = Pieces::Move(),
+                   const Heuristics *heuristics = nullptr, int ply = 0,
+                   const Pieces::Move *previous = nullptr);
+
+        /**
+         * @return The next move or nullptr once every move was yielded
+         */
+        const Pieces::Move *next();
+
+        /**
+         * @brief Leave out the REFUTATIONS and QUIETS stages from now on,
+         *        without generating the quiet moves if they aren't yet
+         */
+        void skipQuiets();
+
+        /**
+         * @brief Stage of the last move returned by next()
+         */
+        Stage stage() const;
+
+      private:
+        Game::Board &_board;
+        const Heuristics *_heuristics;
+        const Pieces::Move *_previous;
+        Pieces::Move _ttMove;
+        bool _hasTTMove;
+        bool _isSkippingQuiets;
+        std::array<int, N_REFUTATIONS> _refutations;
+        Stage _stage;
+        int _current;
+        int _end;
+        // Generated moves: the tactical ones, then the quiet ones from _nTactical
+        int _nTactical;
+        int _nMoves;
+        int _nBadCaptures;
+        int _nYielded;
+        std::array<Pieces::Move, MAX_MOVES> _moves;
+        std::array<std::uint16_t, MAX_MOVES> _indexes;
+        std::array<int, MAX_MOVES> _scores;
+        std::array<std::uint16_t, MAX_MOVES> _badCaptures;
+        std::array<int, N_REFUTATIONS> _yielded;
+
+        void generateQuiets();
+        void scoreCaptures();
+        void scoreQuiets();
+        int pickBest();
+        int findQuiet(int key) const;
+        bool isSkipped(int index) const;
+    };
+
+    class Searcher {
+      public:
+        /**
+         * @brief Selectivity features, each one can be switched off to
+         *        measure its effect
+         */
+        struct Options {
+            bool nullMove = true;
+            bool lateMoveReductions = true;
+            bool futility = true;
+            bool reverseFutility = true;
+            bool principalVariation = true;
+            bool aspirationWindows = true;
+        };
+
+        struct Result {
+            Pieces::Move move;
+            int score;
+            int depth;
+            std::uint64_t nodes;
+        };
+
+        /**
+         * @brief When to stop iterative deepening, 0 for no time or node limit
+         */
+        struct Limits {
+            int depth = MAX_PLY - 1;
+            std::chrono::milliseconds time{0};
+            std::uint64_t nodes = 0;
+        };
+
+        /**
+         * @brief Moves expected until the next time control when unknown
+         */
+        static constexpr int MOVES_TO_GO = 30;
+
+        /**
+         * @brief Called with the result of every completed iteration
+         */
+        using Listener = std::function<void(const Result &)>;
+
+        Searcher();
+        explicit Searcher(Options options);
+
+        Options options() const;
+        void options(Options options);
+
+        /**
+         * @brief Iterative deepening up to depth
+         *    - Each iteration after the first searches an aspiration window
+         *      around the previous score, widened on failure
+         *    - The best move of an iteration is tried first by the next one
+         */
+        Result search(Game::Board &board, int depth);
+
+        /**
+         * @brief Iterative deepening until a limit is reached or stop() is called
+         *    - The result is the one of the last completed iteration, an
+         *      interrupted first iteration still yields a legal move
+         *    - The stop flag and the deadline are checked at every node
+         */
+        Result search(Game::Board &board, const Limits &limits, const Listener &listener = {});
+
+        /**
+         * @brief Reset the stop flag and the deadline before starting a search
+         *        on another thread, search() then keeps a stop() or deadline()
+         *        called in between instead of resetting them itself
+         */
+        void prepare(const Limits &limits);
+
+        /**
+         * @brief Abort the running search, safe to call from any thread
+         */
+        void stop();
+
+        /**
+         * @brief Move the time limit of the running search to now + time,
+         *        safe to call from any thread (e.g. on a ponder hit)
+         */
+        void deadline(std::chrono::milliseconds time);
+
+        /**
+         * @brief Time for one move: a share of the clock plus most of the
+         *        increment, never more than half of the clock
+         */
+        static std::chrono::milliseconds allocate(std::chrono::milliseconds remaining,
+                                                  std::chrono::milliseconds increment,
+                                                  int movesToGo = MOVES_TO_GO);
+
+        /**
+         * @brief Search captures and promotions until the position is quiet
+         *    - Captures losing material according to Board::see() are pruned
+         *    - Every evasion is searched when the player to move is in check
+         */
+        int quiescence(Game::Board &board, int alpha, int beta, int ply);
+
+        std::uint64_t nodes() const;
+
+        Heuristics &heuristics();
+
+        /**
+         * @brief Tables probed below the root, nullptr to disable them
+         */
+        void tablebases(const Tablebase::Tablebases *tablebases);
+
+      private:
+        Options _options;
+        std::uint64_t _nodes;
+        std::uint64_t _maxNodes;
+        std::atomic<bool> _isStopped;
+        // steady_clock ticks, 0 for no deadline
+        std::atomic<std::int64_t> _deadline;
+        // Set by prepare() until the next search starts
+        bool _isPrepared;
+        Heuristics _heuristics;
+        std::array<Pieces::Move, MAX_PLY> _stack;
+        Pieces::Move _rootMove;
+        const Tablebase::Tablebases *_tablebases;
+
+        int alphaBeta(Game::Board &board, int depth, int alpha, int beta, int ply,
+                      Pieces::Move *best);
+
+        bool isStopped();
+
+        int nullMove(Game::Board &board, int depth, int beta, int ply);
+
+        int reduction(const Game::Board &board, const Pieces::Move &move, int depth,
+                      int moveCount, int ply) const;
+
+        static bool hasNonPawnMaterial(const Game::Board &board);
+    };
+} // namespace Search
+
+#endif // SEARCH_HPP
@@ -0,0 +1,338 @@
+#include "model/search/search.hpp"
+
+namespace Search {
+    namespace {
+        const int ASPIRATION_DELTA = 50;
+        const int NULL_MOVE_MIN_DEPTH = 3;
+        const int REVERSE_FUTILITY_MAX_DEPTH = 3;
+        const int REVERSE_FUTILITY_MARGIN = 120;
+        const int FUTILITY_MAX_DEPTH = 2;
+        const int FUTILITY_MARGIN = 150;
+        const int REDUCTION_MIN_DEPTH = 3;
+        const int REDUCTION_MIN_MOVES = 3;
+        const int MATE_BOUND = MATE - MAX_PLY;
+        // Nodes between two reads of the clock
+        const std::uint64_t CLOCK_PERIOD = 16;
+    } // namespace
+
+    Searcher::Searcher()
+        : Searcher(Options()) {}
+
+    Searcher::Searcher(Options options)
+        : _options(options)
+        , _nodes(0)
+        , _maxNodes(0)
+        , _isStopped(false)
+        , _deadline(0)
+        , _isPrepared(false)
+        , _heuristics()
+        , _stack()
+        , _rootMove()
+        , _tablebases(nullptr) {}
+
+    Searcher::Options Searcher::options() const { return this->_options; }
+
+    void Searcher::options(Options options) { this->_options = options; }
+
+    Searcher::Result Searcher::search(Game::Board &board, int depth) {
+        if (depth < 1) throw std::runtime_error("Search depth must be positive: depth=" +
+                                                std::to_string(depth));
+
+        Limits limits;
+        limits.depth = depth;
+        return this->search(board, limits);
+    }
+
+    Searcher::Result Searcher::search(Game::Board &board, const Limits &limits,
+                                      const Listener &listener) {
+        if (!this->_isPrepared) this->prepare(limits);
+        this->_isPrepared = false;
+        if (limits.depth < 1) throw std::runtime_error("Search depth must be positive: depth=" +
+                                                       std::to_string(limits.depth));
+
+        this->_nodes = 0;
+        this->_maxNodes = limits.nodes;
+        this->_heuristics.age();
+        this->_rootMove = Pieces::Move();
+        Result result{Pieces::Move(), 0, 0, 0};
+        int maxDepth = std::min(limits.depth, MAX_PLY - 1);
+        for (int iteration = 1; iteration <= maxDepth; ++iteration) {
+            int delta = ASPIRATION_DELTA;
+            int alpha = -INFINITE, beta = INFINITE;
+            if (this->_options.aspirationWindows && iteration > 1 &&
+                std::abs(result.score) < MATE_BOUND) {
+                alpha = result.score - delta;
+                beta = result.score + delta;
+            }
+
+            while (true) {
+                Pieces::Move move;
+                int score = this->alphaBeta(board, iteration, alpha, beta, 0, &move);
+                if (this->_isStopped) {
+                    if (iteration == 1) result.move = move;
+                    break;
+                }
+                if (score <= alpha && alpha > -INFINITE) {
+                    alpha = std::max(score - delta, -INFINITE);
+                } else if (score >= beta && beta < INFINITE) {
+                    beta = std::min(score + delta, INFINITE);
+                } else {
+                    result.move = move;
+                    result.score = score;
+                    result.depth = iteration;
+                    break;
+                }
+                delta *= 2;
+            }
+            if (this->_isStopped) break;
+
+            this->_rootMove = result.move;
+            result.nodes = this->_nodes;
+            if (listener) listener(result);
+        }
+        if (Heuristics::key(result.move) == Heuristics::NO_MOVE && !board.status().isDraw()) {
+            auto moves = board.legalMoves();
+            if (!moves.empty()) result.move = moves.front();
+        }
+        result.nodes = this->_nodes;
+        return result;
+    }
+
+    void Searcher::prepare(const Limits &limits) {
+        this->_isStopped = false;
+        this->_deadline = 0;
+        if (limits.time.count() > 0) this->deadline(limits.time);
+        this->_isPrepared = true;
+    }
+
+    void Searcher::stop() { this->_isStopped = true; }
+
+    void Searcher::deadline(std::chrono::milliseconds time) {
+        auto deadline = std::chrono::steady_clock::now() + time;
+        this->_deadline = deadline.time_since_epoch().count();
+    }
+
+    std::chrono::milliseconds Searcher::allocate(std::chrono::milliseconds remaining,
+                                                 std::chrono::milliseconds increment,
+                                                 int movesToGo) {
+        if (remaining.count() <= 0) return std::chrono::milliseconds(0);
+
+        auto time = remaining / std::max(movesToGo, 1) + increment * 3 / 4;
+        return std::min(time, remaining / 2);
+    }
+
+    bool Searcher::isStopped() {
+        if (this->_isStopped.load(std::memory_order_relaxed)) return true;
+
+        if (this->_maxNodes > 0 && this->_nodes >= this->_maxNodes) {
+            this->_isStopped = true;
+        } else if (this->_nodes % CLOCK_PERIOD == 0) {
+            auto deadline = this->_deadline.load(std::memory_order_relaxed);
+            auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+            if (deadline != 0 && now >= deadline) this->_isStopped = true;
+        }
+        return this->_isStopped.load(std::memory_order_relaxed);
+    }
+
+    int Searcher::quiescence(Game::Board &board, int alpha, int beta, int ply) {
+        this->_nodes++;
+        if (this->isStopped() || board.status().isDraw()) return 0;
+
+        if (board.status() == Game::Status::ENDED_CHECKMATE) return -MATE + ply;
+        if (board.status() == Game::Status::ENDED_STALEMATE) return 0;
+
+        bool inCheck = board.isInCheck();
+        if (ply >= MAX_PLY) return Evaluation::evaluate(board);
+
+        if (!inCheck) {
+            int standPat = Evaluation::evaluate(board);
+            if (standPat >= beta) return standPat;
+
+            alpha = std::max(alpha, standPat);
+        }
+
+        MovePicker picker(board);
+        if (!inCheck) picker.skipQuiets();
+        int bestScore = inCheck ? -INFINITE : alpha;
+        const Pieces::Move *move = nullptr;
+        while ((move = picker.next()) != nullptr) {
+            if (!inCheck) {
+                if (picker.stage() != MovePicker::Stage::GOOD_CAPTURES) break;
+
+                auto *promoted = move->promoted();
+                if (promoted != nullptr && promoted->type() != Pieces::Types::QUEEN) continue;
+            }
+
+            board.move(*move);
+            int score = -this->quiescence(board, -beta, -alpha, ply + 1);
+            board.unMove();
+            if (this->_isStopped) return 0;
+
+            bestScore = std::max(bestScore, score);
+            if (score >= beta) return score;
+
+            alpha = std::max(alpha, score);
+        }
+        // The status isn't updated by a null move, a mate shows up as no move
+        if (bestScore == -INFINITE) return -MATE + ply;
+
+        return bestScore;
+    }
+
+    std::uint64_t Searcher::nodes() const { return this->_nodes; }
+
+    Heuristics &Searcher::heuristics() { return this->_heuristics; }
+
+    void Searcher::tablebases(const Tablebase::Tablebases *tablebases) {
+        this->_tablebases = tablebases;
+    }
+
+    int Searcher::alphaBeta(Game::Board &board, int depth, int alpha, int beta, int ply,
+                            Pieces::Move *best) {
+        if (depth <= 0 || ply >= MAX_PLY) return this->quiescence(board, alpha, beta, ply);
+
+        this->_nodes++;
+        if (this->isStopped()) return 0;
+
+        // A repetition inside the tree is scored as a draw, it could be repeated again
+        if (board.status().isDraw() || (ply > 0 && board.repetitions() > 0)) return 0;
+
+        Tablebase::Result probe;
+        if (ply > 0 && this->_tablebases != nullptr && this->_tablebases->probe(board, probe)) {
+            if (probe.wdl == Tablebase::WDL::WIN) return MATE - ply - probe.dtm;
+            if (probe.wdl == Tablebase::WDL::LOSS) return -MATE + ply + probe.dtm;
+            return 0;
+        }
+
+        if (board.status() == Game::Status::ENDED_CHECKMATE) return -MATE + ply;
+        if (board.status() == Game::Status::ENDED_STALEMATE) return 0;
+
+        bool inCheck = board.isInCheck();
+
+        const Pieces::Move *previous = (ply > 0) ? &this->_stack[ply - 1] : nullptr;
+        bool isPV = (beta - alpha) > 1;
+        bool canPrune = !isPV && !inCheck && (ply > 0);
+        int staticEval = canPrune ? Evaluation::evaluate(board) : 0;
+
+        if (canPrune && this->_options.reverseFutility && depth <= REVERSE_FUTILITY_MAX_DEPTH &&
+            std::abs(beta) < MATE_BOUND &&
+            staticEval - REVERSE_FUTILITY_MARGIN * depth >= beta) {
+            return staticEval;
+        }
+
+        // A null move right after another one would only give the turn back
+        if (canPrune && this->_options.nullMove && depth >= NULL_MOVE_MIN_DEPTH &&
+            staticEval >= beta && Heuristics::key(*previous) != Heuristics::NO_MOVE &&
+            hasNonPawnMaterial(board)) {
+            int score = this->nullMove(board, depth, beta, ply);
+            if (score >= beta) return (score >= MATE_BOUND) ? beta : score;
+        }
+
+        bool isFutile = canPrune && this->_options.futility && depth <= FUTILITY_MAX_DEPTH &&
+                        std::abs(alpha) < MATE_BOUND &&
+                        staticEval + FUTILITY_MARGIN * depth <= alpha;
+
+        Pieces::Move ttMove = (ply == 0) ? this->_rootMove : Pieces::Move();
+        MovePicker picker(board, ttMove, &this->_heuristics, ply, previous);
+
+        std::array<const Pieces::Move *, MovePicker::MAX_MOVES> quiets;
+        int nQuiets = 0;
+        int moveCount = 0;
+        int bestScore = -INFINITE;
+        const Pieces::Move *move = nullptr;
+        while ((move = picker.next()) != nullptr) {
+            bool isQuiet = (move->captured() == nullptr) && (move->promoted() == nullptr);
+            if (isFutile && moveCount > 0) {
+                picker.skipQuiets();
+                if (isQuiet) continue;
+            }
+
+            int reduction = 0;
+            if (this->_options.lateMoveReductions && isQuiet && !inCheck) {
+                reduction = this->reduction(board, *move, depth, moveCount, ply);
+                if (picker.stage() == MovePicker::Stage::REFUTATIONS) {
+                    reduction = std::max(reduction - 1, 0);
+                }
+            }
+
+            this->_stack[ply] = *move;
+            board.move(*move);
+            int score;
+            if (moveCount == 0) {
+                score = -this->alphaBeta(board, depth - 1, -beta, -alpha, ply + 1, nullptr);
+            } else if (this->_options.principalVariation) {
+                score = -this->alphaBeta(board, depth - 1 - reduction, -alpha - 1, -alpha,
+                                         ply + 1, nullptr);
+                if (reduction > 0 && score > alpha) {
+                    score = -this->alphaBeta(board, depth - 1, -alpha - 1, -alpha, ply + 1,
+                                             nullptr);
+                }
+                if (score > alpha && score < beta) {
+                    score = -this->alphaBeta(board, depth - 1, -beta, -alpha, ply + 1, nullptr);
+                }
+            } else {
+                score = -this->alphaBeta(board, depth - 1 - reduction, -beta, -alpha, ply + 1,
+                                         nullptr);
+                if (reduction > 0 && score > alpha) {
+                    score = -this->alphaBeta(board, depth - 1, -beta, -alpha, ply + 1, nullptr);
+                }
+            }
+            board.unMove();
+            if (this->_isStopped) return 0;
+
+            moveCount++;
+
+            if (isQuiet) quiets[nQuiets++] = move;
+            if (score <= bestScore) continue;
+
+            bestScore = score;
+            if (best != nullptr) *best = *move;
+            if (score >= beta) {
+                if (isQuiet) {
+                    this->_heuristics.update(board, *move, depth, ply, previous, quiets.data(),
+                                             nQuiets);
+                }
+                break;
+            }
+
+            alpha = std::max(alpha, score);
+        }
+        // The status isn't updated by a null move, a mate shows up as no move
+        if (moveCount == 0) return inCheck ? -MATE + ply : 0;
+
+        return bestScore;
+    }
+
+    int Searcher::nullMove(Game::Board &board, int depth, int beta, int ply) {
+        int reduction = 2 + depth / 4;
+        this->_stack[ply] = Pieces::Move();
+        board.nullMove();
+        int score =
+            -this->alphaBeta(board, depth - 1 - reduction, -beta, -beta + 1, ply + 1, nullptr);
+        board.unNullMove();
+        return score;
+    }
+
+    int Searcher::reduction(const Game::Board &board, const Pieces::Move &move, int depth,
+                            int moveCount, int ply) const {
+        if (depth < REDUCTION_MIN_DEPTH || moveCount < REDUCTION_MIN_MOVES) return 0;
+
+        int reduction = 1 + (depth >= 6) + (moveCount >= 8);
+        const Pieces::Move *previous = (ply > 0) ? &this->_stack[ply - 1] : nullptr;
+        int score = this->_heuristics.quietScore(board, move, previous);
+        if (score > Heuristics::HISTORY_MAX / 2) reduction--;
+        if (score < 0) reduction++;
+        return std::clamp(reduction, 0, depth - 2);
+    }
+
+    bool Searcher::hasNonPawnMaterial(const Game::Board &board) {
+        Position captured;
+        for (auto *piece : board.pieces()) {
+            if (piece->owner() != board.turn() || piece->position() == captured) continue;
+
+            auto type = piece->type();
+            if (type != Pieces::Types::KING && type != Pieces::Types::PAWN) return true;
+        }
+        return false;
+    }
+} // namespace Search
@@ -0,0 +1,174 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include "model/selfplay/selfplay.hpp"
+#include "model/utils/bounded_queue.hpp"
+
+namespace SelfPlay {
+    namespace {
+        /**
+         * @brief Result of a game over on the board, "*" while it goes on
+         */
+        std::string resultOf(const Game::Board &board) {
+            auto status = board.status();
+            if (status == Game::Status::ENDED_CHECKMATE) {
+                return (board.color(board.turn()) == NNUE::Network::WHITE) ? "0-1" : "1-0";
+            }
+            if (status == Game::Status::ENDED_STALEMATE || status.isDraw()) return "1/2-1/2";
+
+            return "*";
+        }
+    } // namespace
+
+    Runner::Runner()
+        : Runner(Options()) {}
+
+    Runner::Runner(Options options)
+        : _options(std::move(options))
+        , _book(nullptr) {}
+
+    void Runner::book(const Book::Polyglot *book) { this->_book = book; }
+
+    Played Runner::play(std::size_t index, Game::Board &board, Pieces::Player &first,
+                        Pieces::Player &second, Search::Searcher &searcher) const {
+        auto &options = this->_options;
+        std::mt19937_64 generator(options.seed ^ (0x9E3779B97F4A7C15ULL * (index + 1)));
+        Played played;
+        played.index = index;
+        played.fen = options.fen;
+        board.initialize(first, second, options.fen);
+        searcher.heuristics().clear();
+
+        auto isOver = [&board]() { return board.status() != Game::Status::IN_PROGRESS; };
+        int ply = 0;
+        for (; ply < options.bookPlies && this->_book != nullptr && !isOver(); ++ply) {
+            auto move = this->_book->random(board, generator);
+            if (Search::Heuristics::key(move) == Search::Heuristics::NO_MOVE) break;
+
+            played.moves.push_back(Archive::encodeMove(board, move));
+            board.move(move);
+        }
+        // Codes don't depend on the order of the legal moves, neither do the picks
+        for (int i = 0; i < options.randomPlies && !isOver(); ++i, ++ply) {
+            auto pick = static_cast<std::uint16_t>(generator() % board.legalMoves().size());
+            played.moves.push_back(pick);
+            board.move(Archive::decodeMove(board, pick));
+        }
+
+        // Scores from the first player's side, to see both sides agree
+        int nWinning = 0, nLosing = 0, nDrawn = 0;
+        while (!isOver()) {
+            if (ply >= options.maxPlies) {
+                played.result = "1/2-1/2";
+                played.isAdjudicated = true;
+                break;
+            }
+            auto result = searcher.search(board, options.limits);
+            played.nNodes += result.nodes;
+            int score = (board.color(board.turn()) == NNUE::Network::WHITE) ? result.score
+                                                                             : -result.score;
+
+            nWinning = (score >= options.winScore) ? nWinning + 1 : 0;
+            nLosing = (score <= -options.winScore) ? nLosing + 1 : 0;
+            nDrawn = (ply >= options.drawPly && std::abs(score) <= options.drawScore) ? nDrawn + 1
+                                                                                      : 0;
+            if (nWinning >= options.winPlies || nLosing >= options.winPlies ||
+                nDrawn >= options.drawPlies) {
+                played.result = (nDrawn >= options.drawPlies) ? "1/2-1/2"
+                                : (nWinning > 0)              ? "1-0"
+                                                              : "0-1";
+                played.isAdjudicated = true;
+                break;
+            }
+
+            played.moves.push_back(Archive::encodeMove(board, result.move));
+            board.move(result.move);
+            ++ply;
+        }
+        if (!played.isAdjudicated) played.result = resultOf(board);
+
+        return played;
+    }
+
+    Stats Runner::run(Archive::Writer &writer) {
+        auto &options = this->_options;
+        std::size_t nThreads = options.nThreads;
+        if (nThreads == 0) nThreads = std::max(1U, std::thread::hardware_concurrency());
+        nThreads = std::max<std::size_t>(std::min(nThreads, options.nGames), 1);
+
+        Utils::BoundedQueue<Played> queue(std::max<std::size_t>(options.queueSize, 1));
+        std::atomic<std::size_t> next{0};
+        std::mutex mutex;
+        std::exception_ptr failure;
+        auto fail = [&]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!failure) failure = std::current_exception();
+            next = options.nGames;
+        };
+
+        Stats stats;
+        std::thread output([&]() {
+            bool isWriting = true;
+            Played played;
+            while (queue.pop(played)) {
+                if (!isWriting) continue;
+
+                try {
+                    Archive::Record record;
+                    auto round = std::to_string(played.index + 1);
+                    record.tags.emplace_back("Round", round);
+                    if (played.fen != PGN::STANDARD_FEN) record.tags.emplace_back("FEN", played.fen);
+                    record.result = played.result;
+                    record.moves = std::move(played.moves);
+                    writer.write(record);
+
+                    stats.nGames++;
+                    stats.nPlies += record.moves.size();
+                } catch (...) {
+                    // Keep draining so that no worker stays blocked on a full queue
+                    isWriting = false;
+                    fail();
+                    continue;
+                }
+                stats.nNodes += played.nNodes;
+                if (played.isAdjudicated) stats.nAdjudicated++;
+                if (played.result == "1-0") {
+                    stats.nWhiteWins++;
+                } else if (played.result == "0-1") {
+                    stats.nBlackWins++;
+                } else {
+                    stats.nDraws++;
+                }
+            }
+        });
+
+        std::vector<std::thread> workers;
+        workers.reserve(nThreads);
+        for (std::size_t id = 0; id < nThreads; ++id) {
+            workers.emplace_back([&]() {
+                try {
+                    Game::Board board(8, 8);
+                    Pieces::Player first("White"), second("Black");
+                    Search::Searcher searcher;
+                    std::size_t index;
+                    while ((index = next.fetch_add(1)) < options.nGames) {
+                        if (!queue.push(this->play(index, board, first, second, searcher))) break;
+                    }
+                } catch (...) {
+                    fail();
+                }
+            });
+        }
+        for (auto &worker : workers) worker.join();
+        queue.close();
+        output.join();
+
+        if (failure) std::rethrow_exception(failure);
+
+        return stats;
+    }
+} // namespace SelfPlay
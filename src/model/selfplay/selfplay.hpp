@@ -0,0 +1,100 @@
+#ifndef SELFPLAY_HPP
+#define SELFPLAY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "model/archive/archive.hpp"
+#include "model/book/book.hpp"
+#include "model/pgn/pgn.hpp"
+#include "model/search/search.hpp"
+
+/**
+ * @brief Engine against engine games played in parallel
+ *    - Every worker owns its Board, Players and Searcher, games are handed
+ *      out through an atomic counter so that workers never wait on each other
+ *    - Finished games go through a bounded queue to a single writer thread
+ *      which appends them to an Archive
+ *    - The openings of game i only depend on the seed and i, not on the
+ *      worker playing it
+ */
+namespace SelfPlay {
+    struct Options {
+        std::size_t nThreads = 0;
+        std::size_t nGames = 1;
+        std::uint64_t seed = 0;
+        std::string fen = std::string(PGN::STANDARD_FEN);
+        Search::Searcher::Limits limits = {4, std::chrono::milliseconds(0), 0};
+        // Book moves drawn by weight first, then random legal moves
+        int bookPlies = 16;
+        int randomPlies = 8;
+        // Adjudicated as a draw when reached
+        int maxPlies = 400;
+        // Win when both sides agree that |score| >= winScore for winPlies plies in a row
+        int winScore = 1000;
+        int winPlies = 4;
+        // Draw when |score| <= drawScore for drawPlies plies in a row from drawPly on
+        int drawScore = 10;
+        int drawPlies = 12;
+        int drawPly = 80;
+        std::size_t queueSize = 256;
+    };
+
+    struct Stats {
+        std::size_t nGames = 0;
+        std::size_t nWhiteWins = 0;
+        std::size_t nBlackWins = 0;
+        std::size_t nDraws = 0;
+        std::size_t nAdjudicated = 0;
+        std::uint64_t nPlies = 0;
+        std::uint64_t nNodes = 0;
+    };
+
+    /**
+     * @brief A finished game owning its strings, as queued for the writer
+     */
+    struct Played {
+        std::size_t index = 0;
+        std::string fen;
+        std::string result = "*";
+        bool isAdjudicated = false;
+        // Archive::encodeMove() codes
+        std::vector<std::uint16_t> moves;
+        std::uint64_t nNodes = 0;
+    };
+
+    class Runner {
+      public:
+        Runner();
+        explicit Runner(Options options);
+
+        /**
+         * @brief Openings are drawn from the book, nullptr for random plies only
+         * @warning The book is shared by the workers and must outlive run()
+         */
+        void book(const Book::Polyglot *book);
+
+        /**
+         * @brief Play every game and write it to the archive, in completion order
+         *    - Each record has a "Round" tag with the game number from 1, and
+         *      a "FEN" tag unless it starts from the standard position
+         * @throw std::runtime_error if a worker or the writer fails, after
+         *        every thread has stopped
+         */
+        Stats run(Archive::Writer &writer);
+
+        /**
+         * @brief Play game index on the given board and searcher
+         */
+        Played play(std::size_t index, Game::Board &board, Pieces::Player &first,
+                    Pieces::Player &second, Search::Searcher &searcher) const;
+
+      private:
+        Options _options;
+        const Book::Polyglot *_book;
+    };
+} // namespace SelfPlay
+
+#endif // SELFPLAY_HPP
@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "model/stress/stress.hpp"
+
+namespace Stress {
+    void Stats::add(const Outcome &outcome) {
+        this->nGames++;
+        this->nPlies += outcome.nPlies;
+        auto &status = outcome.status;
+        if (status == Game::Status::ENDED_CHECKMATE) {
+            if (outcome.loser == NNUE::Network::WHITE) {
+                this->nBlackWins++;
+            } else {
+                this->nWhiteWins++;
+            }
+        } else if (status == Game::Status::ENDED_STALEMATE) {
+            this->nStalemates++;
+        } else if (status == Game::Status::ENDED_REPETITION) {
+            this->nRepetitions++;
+        } else if (status == Game::Status::ENDED_FIFTY_MOVES) {
+            this->nFiftyMoves++;
+        } else if (status == Game::Status::ENDED_INSUFFICIENT_MATERIAL) {
+            this->nInsufficientMaterial++;
+        } else {
+            this->nUnfinished++;
+        }
+    }
+
+    Stats &Stats::operator+=(const Stats &other) {
+        this->nGames += other.nGames;
+        this->nPlies += other.nPlies;
+        this->nWhiteWins += other.nWhiteWins;
+        this->nBlackWins += other.nBlackWins;
+        this->nStalemates += other.nStalemates;
+        this->nRepetitions += other.nRepetitions;
+        this->nFiftyMoves += other.nFiftyMoves;
+        this->nInsufficientMaterial += other.nInsufficientMaterial;
+        this->nUnfinished += other.nUnfinished;
+        return *this;
+    }
+
+    double Stats::gamesPerSecond() const {
+        if (this->elapsed.count() <= 0) return 0;
+
+        return static_cast<double>(this->nGames) / this->elapsed.count();
+    }
+
+    double Stats::pliesPerSecond() const {
+        if (this->elapsed.count() <= 0) return 0;
+
+        return static_cast<double>(this->nPlies) / this->elapsed.count();
+    }
+
+    double Stats::averageLength() const {
+        if (this->nGames == 0) return 0;
+
+        return static_cast<double>(this->nPlies) / static_cast<double>(this->nGames);
+    }
+
+    Generator::Generator()
+        : Generator(Options()) {}
+
+    Generator::Generator(Options options)
+        : _options(std::move(options)) {}
+
+    Outcome Generator::play(std::size_t index, Game::Board &board, Pieces::Player &first,
+                            Pieces::Player &second) const {
+        auto &options = this->_options;
+        std::mt19937_64 generator(options.seed ^ (0x9E3779B97F4A7C15ULL * (index + 1)));
+        board.initialize(first, second, options.fen);
+        auto key = board.hash();
+        auto status = board.status();
+        auto fen = options.isUndone ? board.fen() : std::string();
+
+        Outcome outcome;
+        while (board.status() == Game::Status::IN_PROGRESS && outcome.nPlies < options.maxPlies) {
+            auto moves = board.legalMoves();
+            board.move(moves[generator() % moves.size()]);
+            outcome.nPlies++;
+        }
+        outcome.status = board.status();
+        outcome.hash = board.hash();
+        if (outcome.status == Game::Status::ENDED_CHECKMATE) {
+            outcome.loser = board.color(board.turn());
+        }
+
+        if (options.isUndone) {
+            for (int i = 0; i < outcome.nPlies; ++i) board.unMove();
+            if (board.hash() != key || board.status() != status || board.fen() != fen) {
+                throw std::runtime_error("Random game did not unwind: index='" +
+                                         std::to_string(index) + "'");
+            }
+        }
+        return outcome;
+    }
+
+    Stats Generator::run() {
+        auto &options = this->_options;
+        std::size_t nThreads = options.nThreads;
+        if (nThreads == 0) nThreads = std::max(1U, std::thread::hardware_concurrency());
+        nThreads = std::max<std::size_t>(std::min(nThreads, options.nGames), 1);
+
+        std::atomic<std::size_t> next{0};
+        std::mutex mutex;
+        std::exception_ptr failure;
+        Stats stats;
+        auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> workers;
+        workers.reserve(nThreads);
+        for (std::size_t id = 0; id < nThreads; ++id) {
+            workers.emplace_back([&]() {
+                Stats local;
+                try {
+                    Game::Board board(8, 8);
+                    Pieces::Player first("White"), second("Black");
+                    std::size_t index;
+                    while ((index = next.fetch_add(1)) < options.nGames) {
+                        local.add(this->play(index, board, first, second));
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!failure) failure = std::current_exception();
+                    next = options.nGames;
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                stats += local;
+            });
+        }
+        for (auto &worker : workers) worker.join();
+
+        if (failure) std::rethrow_exception(failure);
+
+        stats.elapsed = std::chrono::steady_clock::now() - start;
+        return stats;
+    }
+} // namespace Stress
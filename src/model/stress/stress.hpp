@@ -0,0 +1,85 @@
+#ifndef STRESS_HPP
+#define STRESS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "model/game/game.hpp"
+#include "model/pgn/pgn.hpp"
+
+/**
+ * @brief Games of uniformly random legal moves, to stress and time the rules
+ *        end to end: move generation, Board::move(), status updates and the
+ *        end of the game
+ *    - Every thread owns its Board and Stats, games are handed out through
+ *      an atomic counter and the Stats are only merged at the end
+ *    - Game i only depends on the seed and i, not on the thread playing it
+ */
+namespace Stress {
+    struct Options {
+        std::size_t nThreads = 0;
+        std::size_t nGames = 1000;
+        std::uint64_t seed = 0;
+        std::string fen = std::string(PGN::STANDARD_FEN);
+        // Games still in progress are counted as unfinished
+        int maxPlies = 1000;
+        // Undo every game and check that the start position is back
+        bool isUndone = false;
+    };
+
+    struct Outcome {
+        Game::Status status = Game::Status::IN_PROGRESS;
+        int nPlies = 0;
+        // Color of the checkmated player, -1 otherwise
+        int loser = -1;
+        // Zobrist key of the final position
+        std::uint64_t hash = 0;
+    };
+
+    struct Stats {
+        std::size_t nGames = 0;
+        std::uint64_t nPlies = 0;
+        std::size_t nWhiteWins = 0;
+        std::size_t nBlackWins = 0;
+        std::size_t nStalemates = 0;
+        std::size_t nRepetitions = 0;
+        std::size_t nFiftyMoves = 0;
+        std::size_t nInsufficientMaterial = 0;
+        std::size_t nUnfinished = 0;
+        std::chrono::duration<double> elapsed{0};
+
+        void add(const Outcome &outcome);
+        Stats &operator+=(const Stats &other);
+
+        double gamesPerSecond() const;
+        double pliesPerSecond() const;
+        double averageLength() const;
+    };
+
+    class Generator {
+      public:
+        Generator();
+        explicit Generator(Options options);
+
+        /**
+         * @brief Play every game, the elapsed time being the wall-clock time
+         * @throw std::runtime_error if a game fails, after every thread has stopped
+         */
+        Stats run();
+
+        /**
+         * @brief Play game index on the given board
+         * @throw std::runtime_error if isUndone is set and undoing the game
+         *        doesn't restore its start position
+         */
+        Outcome play(std::size_t index, Game::Board &board, Pieces::Player &first,
+                     Pieces::Player &second) const;
+
+      private:
+        Options _options;
+    };
+} // namespace Stress
+
+#endif // STRESS_HPP
@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "model/notation/notation.hpp"
+#include "model/suite/suite.hpp"
+#include "model/utils/bounded_queue.hpp"
+#include "model/utils/reorder_buffer.hpp"
+
+namespace Suite {
+    namespace {
+        bool isEmpty(const Pieces::Move &move) {
+            return Search::Heuristics::key(move) == Search::Heuristics::NO_MOVE;
+        }
+
+        std::vector<Pieces::Move> resolve(Game::Board &board,
+                                          const std::vector<std::string> &notations) {
+            std::vector<Pieces::Move> moves;
+            moves.reserve(notations.size());
+            for (auto &notation : notations) moves.push_back(Notation::parse(board, notation));
+            return moves;
+        }
+
+        bool contains(const std::vector<Pieces::Move> &moves, const Pieces::Move &move) {
+            return std::find(moves.begin(), moves.end(), move) != moves.end();
+        }
+    } // namespace
+
+    std::string Result::format() const {
+        auto out = std::to_string(this->index + 1);
+        if (!this->error.empty()) return out + " error: " + this->error;
+
+        out += ' ' + (this->move.empty() ? std::string("-") : this->move);
+        out += " score " + std::to_string(this->score) + " depth " + std::to_string(this->depth) +
+               " nodes " + std::to_string(this->nodes);
+        if (this->verdict == Verdict::SOLVED) out += " solved";
+        if (this->verdict == Verdict::FAILED) out += " failed";
+        if (!this->id.empty()) out += " id \"" + this->id + "\"";
+        return out;
+    }
+
+    void Stats::add(const Result &result) {
+        this->nPositions++;
+        if (!result.error.empty()) this->nErrors++;
+        if (result.verdict != Verdict::NONE) this->nTests++;
+        if (result.verdict == Verdict::SOLVED) this->nSolved++;
+        this->nodes += result.nodes;
+    }
+
+    double Stats::solveRate() const {
+        if (this->nTests == 0) return 0;
+
+        return static_cast<double>(this->nSolved) / static_cast<double>(this->nTests);
+    }
+
+    double Stats::nodesPerSecond() const {
+        if (this->elapsed.count() <= 0) return 0;
+
+        return static_cast<double>(this->nodes) / this->elapsed.count();
+    }
+
+    Analyzer::Analyzer()
+        : Analyzer(Options()) {}
+
+    Analyzer::Analyzer(Options options)
+        : _options(options) {}
+
+    Stats Analyzer::run(std::istream &in, std::ostream &out) const {
+        auto &options = this->_options;
+        std::size_t nThreads = options.nThreads;
+        if (nThreads == 0) nThreads = std::max(1U, std::thread::hardware_concurrency());
+        std::size_t window = std::max<std::size_t>(options.window, 1);
+        Utils::BoundedQueue<std::pair<std::size_t, std::string>> lines(window);
+        Utils::ReorderBuffer<Result> results(window);
+
+        std::mutex mutex;
+        std::exception_ptr failure;
+        auto fail = [&]() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!failure) failure = std::current_exception();
+            }
+            lines.close();
+            results.close();
+        };
+
+        Stats stats;
+        auto start = std::chrono::steady_clock::now();
+        std::atomic<std::size_t> nWorking{nThreads};
+        std::vector<std::thread> threads;
+        threads.emplace_back([&]() {
+            try {
+                std::size_t index = 0;
+                std::string line;
+                while (std::getline(in, line)) {
+                    auto first = line.find_first_not_of(" \t\r");
+                    if (first == std::string::npos || line[first] == '#') continue;
+                    if (!lines.push({index++, std::move(line)})) break;
+                }
+            } catch (...) {
+                fail();
+            }
+            lines.close();
+        });
+        for (std::size_t id = 0; id < nThreads; ++id) {
+            threads.emplace_back([&]() {
+                try {
+                    Game::Board board(8, 8);
+                    Pieces::Player first("White"), second("Black");
+                    Search::Searcher searcher;
+                    std::pair<std::size_t, std::string> line;
+                    // Lines are popped in order, so the oldest unfinished one
+                    // is always being searched and put() can't wait forever
+                    while (lines.pop(line)) {
+                        auto result =
+                            this->analyze(line.first, line.second, board, first, second, searcher);
+                        if (!results.put(line.first, std::move(result))) break;
+                    }
+                } catch (...) {
+                    fail();
+                }
+                if (--nWorking == 0) results.close();
+            });
+        }
+
+        try {
+            Result result;
+            while (results.take(result)) {
+                out << result.format() << '\n';
+                stats.add(result);
+            }
+            out.flush();
+        } catch (...) {
+            fail();
+        }
+        for (auto &thread : threads) thread.join();
+
+        if (failure) std::rethrow_exception(failure);
+
+        stats.elapsed = std::chrono::steady_clock::now() - start;
+        return stats;
+    }
+
+    Result Analyzer::analyze(std::size_t index, std::string_view line, Game::Board &board,
+                             Pieces::Player &first, Pieces::Player &second,
+                             Search::Searcher &searcher) const {
+        Result result;
+        result.index = index;
+        try {
+            auto record = Record::parse(line);
+            result.id = record.id;
+            board.initialize(first, second, record.fen);
+            auto best = resolve(board, record.bestMoves);
+            auto avoid = resolve(board, record.avoidMoves);
+
+            Search::Searcher::Limits limits;
+            limits.depth = std::clamp(this->_options.depth, 1, Search::MAX_PLY - 1);
+            limits.nodes = this->_options.nodes;
+            searcher.heuristics().clear();
+            auto found = searcher.search(board, limits);
+            result.score = found.score;
+            result.depth = found.depth;
+            result.nodes = found.nodes;
+            if (!isEmpty(found.move)) result.move = Notation::SAN::format(board, found.move);
+
+            if (!best.empty() || !avoid.empty()) {
+                bool isSolved = !isEmpty(found.move) &&
+                                (best.empty() || contains(best, found.move)) &&
+                                !contains(avoid, found.move);
+                result.verdict = isSolved ? Verdict::SOLVED : Verdict::FAILED;
+            }
+        } catch (const std::exception &error) {
+            result.error = error.what();
+        }
+        return result;
+    }
+} // namespace Suite
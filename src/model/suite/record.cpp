@@ -0,0 +1,92 @@
+#include <cctype>
+#include <stdexcept>
+
+#include "model/suite/suite.hpp"
+
+namespace Suite {
+    namespace {
+        bool isSpace(char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; }
+
+        /**
+         * @brief Next word from position, position is moved past it
+         */
+        std::string_view word(std::string_view text, std::size_t &position) {
+            while (position < text.size() && isSpace(text[position])) ++position;
+            auto start = position;
+            while (position < text.size() && !isSpace(text[position])) ++position;
+            return text.substr(start, position - start);
+        }
+
+        bool isNumber(std::string_view text) {
+            if (text.empty()) return false;
+
+            for (char c : text) {
+                if (!std::isdigit(static_cast<unsigned char>(c))) return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Operands of an operation without the quotes of a string
+         */
+        std::string_view operand(std::string_view text) {
+            while (!text.empty() && isSpace(text.front())) text.remove_prefix(1);
+            while (!text.empty() && isSpace(text.back())) text.remove_suffix(1);
+            if (text.size() >= 2 && text.front() == '"' && text.back() == '"') {
+                text = text.substr(1, text.size() - 2);
+            }
+            return text;
+        }
+    } // namespace
+
+    Record Record::parse(std::string_view line) {
+        Record record;
+        std::size_t position = 0;
+        for (int i = 0; i < 4; ++i) {
+            auto field = word(line, position);
+            if (field.empty()) {
+                throw std::runtime_error("EPD record is missing a field: line='" +
+                                         std::string(line) + "'");
+            }
+            if (i > 0) record.fen += ' ';
+            record.fen += field;
+        }
+
+        // FEN clocks, when both are there
+        std::string_view halfmove = "0", fullmove = "1";
+        auto operations = position;
+        auto first = word(line, position), second = word(line, position);
+        if (isNumber(first) && isNumber(second)) {
+            halfmove = first;
+            fullmove = second;
+            operations = position;
+        }
+
+        auto rest = line.substr(operations);
+        while (!rest.empty()) {
+            auto end = rest.find(';');
+            auto operation = rest.substr(0, end);
+            rest = (end == std::string_view::npos) ? std::string_view() : rest.substr(end + 1);
+
+            std::size_t at = 0;
+            auto opcode = word(operation, at);
+            if (opcode == "bm" || opcode == "am") {
+                auto &moves = (opcode == "bm") ? record.bestMoves : record.avoidMoves;
+                for (auto move = word(operation, at); !move.empty(); move = word(operation, at)) {
+                    moves.emplace_back(move);
+                }
+            } else if (opcode == "id") {
+                record.id = operand(operation.substr(at));
+            } else if (opcode == "hmvc" && isNumber(operand(operation.substr(at)))) {
+                halfmove = operand(operation.substr(at));
+            } else if (opcode == "fmvn" && isNumber(operand(operation.substr(at)))) {
+                fullmove = operand(operation.substr(at));
+            }
+        }
+        record.fen += ' ';
+        record.fen += halfmove;
+        record.fen += ' ';
+        record.fen += fullmove;
+        return record;
+    }
+} // namespace Suite
@@ -0,0 +1,118 @@
+#ifndef SUITE_HPP
+#define SUITE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "model/search/search.hpp"
+
+/**
+ * @brief Test suites of FEN or EPD positions searched in parallel
+ *    - A reader thread streams the lines, a pool of workers searches each
+ *      position to a fixed depth or node count and the calling thread
+ *      prints the results in input order
+ *    - Lines wait in a bounded queue and results in a reorder buffer of
+ *      window slots, memory doesn't grow with the number of positions
+ */
+namespace Suite {
+    struct Options {
+        // 0 for one thread per core
+        std::size_t nThreads = 0;
+        int depth = 6;
+        // 0 for no node limit
+        std::uint64_t nodes = 0;
+        // Positions searched or printed ahead of the oldest unfinished one
+        std::size_t window = 256;
+    };
+
+    /**
+     * @brief A FEN or EPD line
+     *    - EPD: the 4 position fields then "opcode operands;" operations,
+     *      "bm" and "am" list moves in SAN or LAN, "id" names the position,
+     *      "hmvc" and "fmvn" give the clocks
+     *    - FEN: the 6 fields, operations may follow
+     */
+    struct Record {
+        // Complete FEN, "0 1" clocks if missing
+        std::string fen;
+        std::vector<std::string> bestMoves;
+        std::vector<std::string> avoidMoves;
+        std::string id;
+
+        /**
+         * @throw std::runtime_error if a position field is missing
+         */
+        static Record parse(std::string_view line);
+    };
+
+    // NONE when the record has no "bm" or "am" operation
+    enum class Verdict { NONE, SOLVED, FAILED };
+
+    struct Result {
+        // Line number among the positions, from 0
+        std::size_t index = 0;
+        std::string id;
+        // Best move found in SAN, empty if the game is over
+        std::string move;
+        int score = 0;
+        int depth = 0;
+        std::uint64_t nodes = 0;
+        Verdict verdict = Verdict::NONE;
+        // Reason the position was not searched, empty otherwise
+        std::string error;
+
+        /**
+         * @brief "3 Ra8# score 31999 depth 6 nodes 1234 solved id "mate.1"",
+         *        "3 error: ..." if the position was not searched
+         */
+        std::string format() const;
+    };
+
+    struct Stats {
+        std::size_t nPositions = 0;
+        std::size_t nErrors = 0;
+        // Positions with a "bm" or "am" operation
+        std::size_t nTests = 0;
+        std::size_t nSolved = 0;
+        std::uint64_t nodes = 0;
+        std::chrono::duration<double> elapsed{0};
+
+        void add(const Result &result);
+
+        double solveRate() const;
+        double nodesPerSecond() const;
+    };
+
+    class Analyzer {
+      public:
+        Analyzer();
+        explicit Analyzer(Options options);
+
+        /**
+         * @brief Write one result per position of the input in input order,
+         *        blank lines and lines starting with '#' are skipped
+         *    - A malformed position gives an error result, not an exception
+         * @throw std::runtime_error if a thread fails, after every thread has stopped
+         */
+        Stats run(std::istream &in, std::ostream &out) const;
+
+        /**
+         * @brief Search the position of a line and check the move against
+         *        its "bm" and "am" operations
+         */
+        Result analyze(std::size_t index, std::string_view line, Game::Board &board,
+                       Pieces::Player &first, Pieces::Player &second,
+                       Search::Searcher &searcher) const;
+
+      private:
+        Options _options;
+    };
+} // namespace Suite
+
+#endif // SUITE_HPP
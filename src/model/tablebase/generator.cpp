@@ -0,0 +1,482 @@
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <thread>
+
+#include "model/tablebase/tablebase.hpp"
+
+namespace Tablebase {
+    namespace {
+        constexpr std::int16_t INVALID = std::numeric_limits<std::int16_t>::min();
+        constexpr std::uint8_t NEVER = 0xFF;
+        constexpr int MAX_PLY = 255;
+        constexpr std::uint64_t LOSS_EVENT = std::uint64_t(1) << 63;
+
+        constexpr int KING = 0;
+        constexpr int QUEEN = 1;
+        constexpr int ROOK = 2;
+        constexpr int BISHOP = 3;
+        constexpr int KNIGHT = 4;
+        constexpr int PAWN = 5;
+        constexpr int PROMOTIONS[] = {QUEEN, ROOK, BISHOP, KNIGHT};
+
+        constexpr int ROOK_DIRECTIONS[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+        constexpr int BISHOP_DIRECTIONS[4][2] = {{1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+        constexpr int KING_STEPS[8][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1},
+                                          {1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+        constexpr int KNIGHT_STEPS[8][2] = {{1, 2}, {2, 1}, {2, -1}, {1, -2},
+                                            {-1, -2}, {-2, -1}, {-2, 1}, {-1, 2}};
+
+        constexpr std::uint64_t bit(int square) { return std::uint64_t(1) << square; }
+
+        constexpr bool isOnBoard(int row, int column) {
+            return row >= 0 && row < 8 && column >= 0 && column < 8;
+        }
+
+        constexpr std::array<std::uint64_t, 64> stepAttacks(const int (&steps)[8][2]) {
+            std::array<std::uint64_t, 64> attacks{};
+            for (int square = 0; square < 64; ++square) {
+                for (auto &step : steps) {
+                    int row = square / 8 + step[0], column = square % 8 + step[1];
+                    if (isOnBoard(row, column)) attacks[square] |= bit(row * 8 + column);
+                }
+            }
+            return attacks;
+        }
+
+        constexpr std::array<std::array<std::uint64_t, 64>, 2> pawnAttacks() {
+            std::array<std::array<std::uint64_t, 64>, 2> attacks{};
+            for (int color = 0; color < 2; ++color) {
+                int forward = (color == 0) ? 1 : -1;
+                for (int square = 0; square < 64; ++square) {
+                    for (int side : {-1, 1}) {
+                        int row = square / 8 + forward, column = square % 8 + side;
+                        if (isOnBoard(row, column)) attacks[color][square] |= bit(row * 8 + column);
+                    }
+                }
+            }
+            return attacks;
+        }
+
+        constexpr auto KING_ATTACKS = stepAttacks(KING_STEPS);
+        constexpr auto KNIGHT_ATTACKS = stepAttacks(KNIGHT_STEPS);
+        constexpr auto PAWN_ATTACKS = pawnAttacks();
+
+        std::uint64_t slide(int square, std::uint64_t occupied, const int (&directions)[4][2]) {
+            std::uint64_t attacks = 0;
+            for (auto &direction : directions) {
+                int row = square / 8 + direction[0], column = square % 8 + direction[1];
+                for (; isOnBoard(row, column); row += direction[0], column += direction[1]) {
+                    attacks |= bit(row * 8 + column);
+                    if (occupied & bit(row * 8 + column)) break;
+                }
+            }
+            return attacks;
+        }
+
+        std::uint64_t attacks(int type, int color, int square, std::uint64_t occupied) {
+            switch (type) {
+            case KING:
+                return KING_ATTACKS[square];
+            case QUEEN:
+                return slide(square, occupied, ROOK_DIRECTIONS) |
+                       slide(square, occupied, BISHOP_DIRECTIONS);
+            case ROOK:
+                return slide(square, occupied, ROOK_DIRECTIONS);
+            case BISHOP:
+                return slide(square, occupied, BISHOP_DIRECTIONS);
+            case KNIGHT:
+                return KNIGHT_ATTACKS[square];
+            default:
+                return PAWN_ATTACKS[color][square];
+            }
+        }
+
+        template <typename Function>
+        void parallel(std::size_t nThreads, std::uint64_t size, Function function) {
+            nThreads = std::max<std::size_t>(1, std::min<std::uint64_t>(nThreads, size));
+            std::vector<std::thread> threads;
+            std::uint64_t chunk = (size + nThreads - 1) / std::max<std::size_t>(nThreads, 1);
+            for (std::size_t thread = 0; thread < nThreads; ++thread) {
+                std::uint64_t begin = thread * chunk, end = std::min(size, begin + chunk);
+                threads.emplace_back(function, begin, end, thread);
+            }
+            for (auto &thread : threads) thread.join();
+        }
+
+        /**
+         * @brief Table reached by a capture and/or a promotion
+         *    - order[k] is the parent piece that becomes the child piece k
+         */
+        struct Child {
+            const std::vector<std::int16_t> *values = nullptr;
+            int nPieces = 0;
+            int order[MAX_PIECES] = {};
+        };
+
+        /**
+         * @brief Material of the table being generated with its move generation
+         */
+        class Context {
+          public:
+            int n;
+            int types[MAX_PIECES];
+            int colors[MAX_PIECES];
+            int kings[2];
+            // Indexed by captured piece + 1, promoted piece + 1 and promotion type
+            std::vector<Child> children;
+
+            explicit Context(const Material &material)
+                : n(material.nPieces())
+                , types()
+                , colors()
+                , kings()
+                , children((MAX_PIECES + 1) * (MAX_PIECES + 1) * 6) {
+                for (int i = 0; i < n; ++i) {
+                    this->types[i] = material.type(i).index();
+                    this->colors[i] = material.color(i);
+                    if (this->types[i] == KING) this->kings[this->colors[i]] = i;
+                }
+            }
+
+            Child &child(int captured, int promoted, int promotion) {
+                return this->children[((captured + 1) * (MAX_PIECES + 1) + promoted + 1) * 6 +
+                                      promotion];
+            }
+
+            int decode(std::uint64_t index, int *squares) const {
+                for (int i = this->n - 1; i >= 0; --i, index /= 64) {
+                    squares[i] = static_cast<int>(index % 64);
+                }
+                return static_cast<int>(index);
+            }
+
+            std::uint64_t encode(int side, const int *squares) const {
+                std::uint64_t index = side;
+                for (int i = 0; i < this->n; ++i) index = index * 64 + squares[i];
+                return index;
+            }
+
+            std::uint64_t occupancy(const int *squares, int captured = -1) const {
+                std::uint64_t occupied = 0;
+                for (int i = 0; i < this->n; ++i) {
+                    if (i != captured) occupied |= bit(squares[i]);
+                }
+                return occupied;
+            }
+
+            bool isAttacked(int square, int color, const int *squares, std::uint64_t occupied,
+                            int captured = -1) const {
+                for (int i = 0; i < this->n; ++i) {
+                    if (this->colors[i] != color || i == captured) continue;
+
+                    if (attacks(this->types[i], color, squares[i], occupied) & bit(square)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            bool isValid(int side, const int *squares) const {
+                std::uint64_t occupied = 0;
+                for (int i = 0; i < this->n; ++i) {
+                    if (occupied & bit(squares[i])) return false;
+
+                    int row = squares[i] / 8;
+                    if (this->types[i] == PAWN && (row == 0 || row == 7)) return false;
+
+                    occupied |= bit(squares[i]);
+                }
+                return !this->isAttacked(squares[this->kings[1 - side]], side, squares, occupied);
+            }
+
+            int pieceAt(int square, const int *squares) const {
+                for (int i = 0; i < this->n; ++i) {
+                    if (squares[i] == square) return i;
+                }
+                return -1;
+            }
+        };
+
+        bool isResolved(std::int16_t value) { return value != 0 && value != INVALID; }
+    } // namespace
+
+    Generator::Generator()
+        : Generator(Options()) {}
+
+    Generator::Generator(Options options)
+        : _options(options)
+        , _values() {
+        if (this->_options.nThreads == 0) {
+            this->_options.nThreads = std::max(1U, std::thread::hardware_concurrency());
+        }
+    }
+
+    Table Generator::generate(const Material &material) {
+        auto &values = this->values(material);
+        std::uint64_t size = material.size();
+        std::vector<char> data(size / 4 + size, 0);
+        for (std::uint64_t index = 0; index < size; ++index) {
+            std::int16_t value = values[index];
+            WDL wdl = (value == INVALID) ? WDL::INVALID
+                      : (value > 0)      ? WDL::WIN
+                      : (value < 0)      ? WDL::LOSS
+                                         : WDL::DRAW;
+            int dtm = (value > 0) ? value : (value < 0 && value != INVALID) ? -value - 1 : 0;
+            data[index / 4] = static_cast<char>(static_cast<std::uint8_t>(data[index / 4]) |
+                                                (static_cast<int>(wdl) << (2 * (index % 4))));
+            data[size / 4 + index] = static_cast<char>(std::min(dtm, MAX_PLY));
+        }
+        return Table(material, std::move(data));
+    }
+
+    const std::vector<std::int16_t> &Generator::values(const Material &material) {
+        auto name = material.name();
+        auto found = this->_values.find(name);
+        if (found != this->_values.end()) return found->second;
+
+        Context context(material);
+        int n = context.n;
+
+        // Tables reached by captures and promotions come first
+        for (int captured = -1; captured < n; ++captured) {
+            if (captured >= 0 && context.types[captured] == KING) continue;
+
+            for (int promoted = -1; promoted < n; ++promoted) {
+                if (promoted >= 0 && (context.types[promoted] != PAWN || promoted == captured ||
+                                      (captured >= 0 &&
+                                       context.colors[captured] == context.colors[promoted]))) {
+                    continue;
+                }
+                if (captured < 0 && promoted < 0) continue;
+
+                for (int promotion : PROMOTIONS) {
+                    if (promoted < 0 && promotion != QUEEN) continue;
+
+                    struct Piece {
+                        int color, type, parent;
+                    };
+                    std::vector<Piece> pieces;
+                    for (int i = 0; i < n; ++i) {
+                        if (i == captured) continue;
+
+                        pieces.push_back(
+                            {context.colors[i], (i == promoted) ? promotion : context.types[i], i});
+                    }
+                    std::stable_sort(pieces.begin(), pieces.end(),
+                                     [](const Piece &a, const Piece &b) {
+                                         return a.color != b.color ? a.color < b.color
+                                                                   : a.type < b.type;
+                                     });
+                    std::string childName;
+                    for (std::size_t k = 0; k < pieces.size(); ++k) {
+                        if (k > 0 && pieces[k].color != pieces[k - 1].color) childName += 'v';
+                        childName += "KQRBNP"[pieces[k].type];
+                    }
+                    auto &child = context.child(captured, promoted, (promoted < 0) ? 0 : promotion);
+                    child.values = &this->values(Material(childName));
+                    child.nPieces = static_cast<int>(pieces.size());
+                    for (std::size_t k = 0; k < pieces.size(); ++k) child.order[k] = pieces[k].parent;
+                }
+            }
+        }
+
+        std::uint64_t size = material.size();
+        std::vector<std::int16_t> values(size, 0);
+        std::vector<std::uint8_t> counters(size, NEVER);
+        std::vector<std::uint8_t> exitLosses(size, 0);
+        std::size_t nThreads = this->_options.nThreads;
+        std::vector<std::vector<std::vector<std::uint64_t>>> threadPending(
+            nThreads, std::vector<std::vector<std::uint64_t>>(2 * MAX_PLY + 2));
+        std::vector<std::vector<std::uint64_t>> threadMates(nThreads);
+
+        auto childValue = [](const Child &child, const int *squares, int side) {
+            std::uint64_t index = side;
+            for (int k = 0; k < child.nPieces; ++k) index = index * 64 + squares[child.order[k]];
+            return (*child.values)[index];
+        };
+
+        // Pass 1: terminal positions, exits to smaller tables and move counters
+        parallel(nThreads, size, [&](std::uint64_t begin, std::uint64_t end, std::size_t thread) {
+            int squares[MAX_PIECES], child[MAX_PIECES];
+            for (std::uint64_t index = begin; index < end; ++index) {
+                int side = context.decode(index, squares);
+                if (!context.isValid(side, squares)) {
+                    values[index] = INVALID;
+                    continue;
+                }
+                std::uint64_t occupied = context.occupancy(squares);
+                std::uint64_t own = 0;
+                for (int i = 0; i < n; ++i) {
+                    if (context.colors[i] == side) own |= bit(squares[i]);
+                }
+
+                int nSame = 0, exitWin = 0, exitLoss = 0;
+                bool hasMove = false, hasDraw = false;
+                for (int i = 0; i < n; ++i) {
+                    if (context.colors[i] != side) continue;
+
+                    int type = context.types[i], from = squares[i];
+                    std::uint64_t targets;
+                    if (type == PAWN) {
+                        int forward = (side == 0) ? 8 : -8;
+                        targets = PAWN_ATTACKS[side][from] & occupied & ~own;
+                        if (!(occupied & bit(from + forward))) {
+                            targets |= bit(from + forward);
+                            int startRow = (side == 0) ? 1 : 6;
+                            if (from / 8 == startRow && !(occupied & bit(from + 2 * forward))) {
+                                targets |= bit(from + 2 * forward);
+                            }
+                        }
+                    } else {
+                        targets = attacks(type, side, from, occupied) & ~own;
+                    }
+
+                    for (; targets != 0; targets &= targets - 1) {
+                        int to = __builtin_ctzll(targets);
+                        int captured = (occupied & bit(to)) ? context.pieceAt(to, squares) : -1;
+                        std::copy(squares, squares + n, child);
+                        child[i] = to;
+                        std::uint64_t childOccupied = (occupied & ~bit(from)) | bit(to);
+                        int king = (type == KING) ? to : child[context.kings[side]];
+                        if (context.isAttacked(king, 1 - side, child, childOccupied, captured)) {
+                            continue;
+                        }
+                        hasMove = true;
+
+                        bool promotes = type == PAWN && (to / 8 == 0 || to / 8 == 7);
+                        if (!promotes && captured < 0) {
+                            nSame++;
+                            continue;
+                        }
+                        for (int promotion : PROMOTIONS) {
+                            if (!promotes && promotion != QUEEN) continue;
+
+                            auto &exit = context.child(captured, promotes ? i : -1,
+                                                       promotes ? promotion : 0);
+                            std::int16_t value = childValue(exit, child, 1 - side);
+                            if (value < 0 && value != INVALID) {
+                                int ply = -value;
+                                exitWin = (exitWin == 0) ? ply : std::min(exitWin, ply);
+                            } else if (value > 0) {
+                                exitLoss = std::max(exitLoss, value + 1);
+                            } else {
+                                hasDraw = true;
+                            }
+                        }
+                    }
+                }
+
+                if (!hasMove) {
+                    if (context.isAttacked(squares[context.kings[side]], 1 - side, squares,
+                                           occupied)) {
+                        values[index] = -1;
+                        threadMates[thread].push_back(index);
+                    }
+                } else if (exitWin > 0) {
+                    threadPending[thread][exitWin].push_back(index);
+                } else if (!hasDraw) {
+                    // At most 5 pieces keep nSame below NEVER
+                    counters[index] = static_cast<std::uint8_t>(nSame);
+                    exitLosses[index] = static_cast<std::uint8_t>(std::min(exitLoss, MAX_PLY));
+                    if (nSame == 0) threadPending[thread][exitLoss].push_back(index);
+                }
+            }
+        });
+
+        std::vector<std::vector<std::uint64_t>> pending(2 * MAX_PLY + 2);
+        std::vector<std::uint64_t> frontier;
+        for (std::size_t thread = 0; thread < nThreads; ++thread) {
+            frontier.insert(frontier.end(), threadMates[thread].begin(), threadMates[thread].end());
+            for (std::size_t ply = 0; ply < pending.size(); ++ply) {
+                auto &list = threadPending[thread][ply];
+                pending[ply].insert(pending[ply].end(), list.begin(), list.end());
+            }
+        }
+
+        // Retrograde passes: every position resolved at ply - 1 resolves its predecessors
+        std::vector<std::vector<std::uint64_t>> events(nThreads);
+        for (int ply = 1; ply < static_cast<int>(pending.size()); ++ply) {
+            parallel(nThreads, frontier.size(),
+                     [&](std::uint64_t begin, std::uint64_t end, std::size_t thread) {
+                         auto &out = events[thread];
+                         out.clear();
+                         int squares[MAX_PIECES];
+                         for (std::uint64_t k = begin; k < end; ++k) {
+                             std::uint64_t index = frontier[k];
+                             std::uint64_t flag = (values[index] < 0) ? LOSS_EVENT : 0;
+                             int side = context.decode(index, squares);
+                             int previous = 1 - side;
+                             std::uint64_t occupied = context.occupancy(squares);
+                             for (int i = 0; i < n; ++i) {
+                                 if (context.colors[i] != previous) continue;
+
+                                 int to = squares[i];
+                                 std::uint64_t sources;
+                                 if (context.types[i] == PAWN) {
+                                     int forward = (previous == 0) ? 8 : -8;
+                                     int from = to - forward;
+                                     sources = 0;
+                                     if (from / 8 != 0 && from / 8 != 7 && !(occupied & bit(from))) {
+                                         sources |= bit(from);
+                                         int doubleRow = (previous == 0) ? 3 : 4;
+                                         if (to / 8 == doubleRow && !(occupied & bit(from - forward))) {
+                                             sources |= bit(from - forward);
+                                         }
+                                     }
+                                 } else {
+                                     sources = attacks(context.types[i], previous, to, occupied) &
+                                               ~occupied;
+                                 }
+                                 for (; sources != 0; sources &= sources - 1) {
+                                     squares[i] = __builtin_ctzll(sources);
+                                     std::uint64_t predecessor = context.encode(previous, squares);
+                                     if (values[predecessor] != INVALID) {
+                                         out.push_back(predecessor | flag);
+                                     }
+                                 }
+                                 squares[i] = to;
+                             }
+                         }
+                     });
+
+            std::vector<std::uint64_t> resolved;
+            for (auto &list : events) {
+                for (auto event : list) {
+                    std::uint64_t index = event & ~LOSS_EVENT;
+                    if (isResolved(values[index])) continue;
+
+                    if (event & LOSS_EVENT) {
+                        values[index] = static_cast<std::int16_t>(ply);
+                        resolved.push_back(index);
+                        continue;
+                    }
+                    if (counters[index] == NEVER || --counters[index] != 0) continue;
+
+                    int lossPly = std::max(ply, static_cast<int>(exitLosses[index]));
+                    if (lossPly == ply) {
+                        values[index] = static_cast<std::int16_t>(-ply - 1);
+                        resolved.push_back(index);
+                    } else {
+                        pending[lossPly].push_back(index);
+                    }
+                }
+                list.clear();
+            }
+            for (auto index : pending[ply]) {
+                if (isResolved(values[index])) continue;
+
+                values[index] = static_cast<std::int16_t>((ply % 2 == 1) ? ply : -ply - 1);
+                resolved.push_back(index);
+            }
+            pending[ply].clear();
+            frontier = std::move(resolved);
+
+            bool hasPending = std::any_of(pending.begin() + ply + 1, pending.end(),
+                                          [](auto &list) { return !list.empty(); });
+            if (frontier.empty() && !hasPending) break;
+        }
+
+        return this->_values.emplace(name, std::move(values)).first->second;
+    }
+} // namespace Tablebase
@@ -0,0 +1,186 @@
+#include "model/tablebase/kpk_bitbase.hpp"
+#include "model/tablebase/tablebase.hpp"
+
+namespace Tablebase {
+    namespace {
+        static_assert(sizeof(KPK_BITBASE) / sizeof(KPK_BITBASE[0]) == KPK::N_POSITIONS / 32,
+                      "The embedded KPK bitbase doesn't match KPK::N_POSITIONS");
+
+        // Results are bit flags so that the results of the children can be or-ed
+        enum : std::uint8_t { ILLEGAL = 0, UNKNOWN = 1, DRAWN = 2, WON = 4 };
+
+        constexpr int STRONG = 0;
+        constexpr int WEAK = 1;
+
+        int distance(int a, int b) {
+            int rows = a / 8 - b / 8, columns = a % 8 - b % 8;
+            rows = rows < 0 ? -rows : rows;
+            columns = columns < 0 ? -columns : columns;
+            return rows > columns ? rows : columns;
+        }
+
+        bool pawnAttacks(int pawn, int square) {
+            int columns = square % 8 - pawn % 8;
+            return square / 8 == pawn / 8 + 1 && (columns == 1 || columns == -1);
+        }
+
+        template <typename Visitor>
+        void forEachKingMove(int king, Visitor &&visitor) {
+            for (int rows = -1; rows <= 1; ++rows) {
+                for (int columns = -1; columns <= 1; ++columns) {
+                    int row = king / 8 + rows, column = king % 8 + columns;
+                    if ((rows == 0 && columns == 0) || row < 0 || row > 7 || column < 0 || column > 7) {
+                        continue;
+                    }
+                    visitor(row * 8 + column);
+                }
+            }
+        }
+
+        std::uint8_t classify(int side, int strongKing, int pawn, int weakKing) {
+            if (distance(strongKing, weakKing) <= 1 || strongKing == pawn || weakKing == pawn ||
+                (side == STRONG && pawnAttacks(pawn, weakKing))) {
+                return ILLEGAL;
+            }
+
+            // The Pawn promotes and the new Queen can't be taken
+            int promotion = pawn + 8;
+            if (side == STRONG && pawn / 8 == 6 && strongKing != promotion && weakKing != promotion &&
+                (distance(weakKing, promotion) > 1 || distance(strongKing, promotion) == 1)) {
+                return WON;
+            }
+
+            // The weak King is stalemated or takes the Pawn
+            if (side == WEAK) {
+                bool canMove = false;
+                forEachKingMove(weakKing, [&](int to) {
+                    canMove |= distance(to, strongKing) > 1 && !pawnAttacks(pawn, to);
+                });
+                if (!canMove) return DRAWN;
+
+                if (distance(weakKing, pawn) == 1 && distance(strongKing, pawn) > 1) return DRAWN;
+            }
+            return UNKNOWN;
+        }
+    } // namespace
+
+    int KPK::index(int side, int strongKing, int pawn, int weakKing) {
+        return ((side * 64 + strongKing) * 64 + weakKing) * 24 + (pawn / 8 - 1) * 4 + pawn % 8;
+    }
+
+    bool KPK::isWin(int side, int strongKing, int pawn, int weakKing) {
+        // Mirror the files so that the Pawn stands on files a-d
+        if (pawn % 8 > 3) {
+            strongKing ^= 7;
+            pawn ^= 7;
+            weakKing ^= 7;
+        }
+        int bit = index(side, strongKing, pawn, weakKing);
+        return (KPK_BITBASE[bit / 32] >> (bit % 32)) & 1;
+    }
+
+    bool KPK::probe(const Game::Board &board, WDL &wdl) {
+        if (board.boundaries() != std::make_pair(8, 8)) return false;
+
+        int kings[2] = {-1, -1}, pawn = -1, pawnColor = 0, nPieces = 0;
+        Position captured;
+        for (auto *piece : board.pieces()) {
+            Position position = piece->position();
+            if (position == captured) continue;
+
+            if (++nPieces > 3) return false;
+
+            int square = position.row() * 8 + position.column();
+            auto type = piece->type();
+            if (type == Pieces::Types::KING) {
+                kings[board.color(piece)] = square;
+            } else if (type == Pieces::Types::PAWN && pawn < 0) {
+                pawn = square;
+                pawnColor = board.color(piece);
+            } else {
+                return false;
+            }
+        }
+        if (nPieces != 3 || pawn < 0 || kings[0] < 0 || kings[1] < 0) return false;
+
+        int strongKing = kings[pawnColor], weakKing = kings[1 - pawnColor];
+        if (pawnColor == NNUE::Network::BLACK) {
+            // Mirror the rows so that the Pawn moves toward row 7
+            strongKing ^= 56;
+            pawn ^= 56;
+            weakKing ^= 56;
+        }
+        if (pawn / 8 < 1 || pawn / 8 > 6) return false;
+
+        int side = (board.color(board.turn()) == pawnColor) ? STRONG : WEAK;
+        if (!isWin(side, strongKing, pawn, weakKing)) {
+            wdl = WDL::DRAW;
+        } else {
+            wdl = (side == STRONG) ? WDL::WIN : WDL::LOSS;
+        }
+        return true;
+    }
+
+    std::vector<std::uint32_t> KPK::generate() {
+        std::vector<std::uint8_t> results(N_POSITIONS, ILLEGAL);
+        for (int side = 0; side < 2; ++side) {
+            for (int strongKing = 0; strongKing < 64; ++strongKing) {
+                for (int weakKing = 0; weakKing < 64; ++weakKing) {
+                    for (int pawn = 8; pawn < 56; ++pawn) {
+                        if (pawn % 8 > 3) continue;
+
+                        results[index(side, strongKing, pawn, weakKing)] =
+                            classify(side, strongKing, pawn, weakKing);
+                    }
+                }
+            }
+        }
+
+        // Resolve the unknown positions from their children until nothing changes
+        for (bool isChanged = true; isChanged;) {
+            isChanged = false;
+            for (int side = 0; side < 2; ++side) {
+                std::uint8_t good = (side == STRONG) ? WON : DRAWN;
+                std::uint8_t bad = (side == STRONG) ? DRAWN : WON;
+                for (int strongKing = 0; strongKing < 64; ++strongKing) {
+                    for (int weakKing = 0; weakKing < 64; ++weakKing) {
+                        for (int pawn = 8; pawn < 56; ++pawn) {
+                            if (pawn % 8 > 3) continue;
+
+                            auto &result = results[index(side, strongKing, pawn, weakKing)];
+                            if (result != UNKNOWN) continue;
+
+                            std::uint8_t children = 0;
+                            if (side == STRONG) {
+                                forEachKingMove(strongKing, [&](int to) {
+                                    children |= results[index(WEAK, to, pawn, weakKing)];
+                                });
+                                if (pawn / 8 < 6) children |= results[index(WEAK, strongKing, pawn + 8, weakKing)];
+                                if (pawn / 8 == 1 && pawn + 8 != strongKing && pawn + 8 != weakKing) {
+                                    children |= results[index(WEAK, strongKing, pawn + 16, weakKing)];
+                                }
+                            } else {
+                                forEachKingMove(weakKing, [&](int to) {
+                                    children |= results[index(STRONG, strongKing, pawn, to)];
+                                });
+                            }
+
+                            if (children & good) {
+                                result = good;
+                            } else if (!(children & UNKNOWN)) {
+                                result = bad;
+                            }
+                            isChanged |= result != UNKNOWN;
+                        }
+                    }
+                }
+            }
+        }
+
+        std::vector<std::uint32_t> bits(N_POSITIONS / 32, 0);
+        for (int bit = 0; bit < N_POSITIONS; ++bit) {
+            if (results[bit] == WON) bits[bit / 32] |= std::uint32_t(1) << (bit % 32);
+        }
+        return bits;
+    }
+} // namespace Tablebase
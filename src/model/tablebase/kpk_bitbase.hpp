@@ -0,0 +1,781 @@
+#ifndef KPK_BITBASE_HPP
+#define KPK_BITBASE_HPP
+
+#include <cstdint>
+
+// Generated by Tablebase::KPK::generate(), do not edit
+namespace Tablebase {
+    // clang-format off
+    constexpr std::uint32_t KPK_BITBASE[6144] = {
+        0x00000000, 0xffff0000, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0xfffb0000,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff, 0xffff22ff, 0xeeffff66,
+        0xffffffff, 0xffffffff, 0x00fff000, 0xf000fff0, 0xfff002ff, 0x6efff026, 0xf7fffff3, 0xffffffff,
+        0x00ff0000, 0x0000ff00, 0xff0002ff, 0x6eff1026, 0x77ffff33, 0xffffffff, 0x00f80000, 0x0000f000,
+        0xf10002f0, 0x6ef31026, 0x77fff733, 0xffffffff, 0x00c80000, 0x00008000, 0x31000210, 0x6e731026,
+        0x77fff733, 0xffffffff, 0x0ec8000e, 0x000e8000, 0x31000e10, 0x6e73102e, 0x77fff733, 0xffffffff,
+        0x00000000, 0x00000000, 0xffffff00, 0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+        0xfffff700, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff48, 0xff00ffff, 0xffff22ff, 0xeeffff66,
+        0xffffffff, 0xffffffff, 0x00fff008, 0xf000fff0, 0xfff002ff, 0x6efff026, 0xf7fffff3, 0xffffffff,
+        0x00ff0008, 0x0000ff00, 0xff0002ff, 0x6eff1026, 0x77ffff33, 0xffffffff, 0x00f80008, 0x0000f000,
+        0xf10002f0, 0x6ef31026, 0x77fff733, 0xffffffff, 0x00c80008, 0x00008000, 0x31000210, 0x6e731026,
+        0x77fff733, 0xffffffff, 0x0ec8000e, 0x000e8000, 0x31000e10, 0x6e73102e, 0x77fff733, 0xffffffff,
+        0x00ffffff, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0x00fffffe, 0x00000000,
+        0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0x80ffffcc, 0xff00ffff, 0xffff20ff, 0xeeffff66,
+        0xffffffff, 0xffffffff, 0x00fff08c, 0xf000fff0, 0xfff000ff, 0x6efff026, 0xf7fffff3, 0xffffffff,
+        0x00ff008c, 0x0000ff00, 0xff0000ff, 0x6eff1026, 0x77ffff33, 0xffffffff, 0x00f8008c, 0x0000f000,
+        0xf10000f0, 0x6ef31026, 0x77fff733, 0xffffffff, 0x00c8008c, 0x00008000, 0x31000010, 0x6e731026,
+        0x77fff733, 0xffffffff, 0x0ec8008e, 0x000e8000, 0x31000e10, 0x6e73102e, 0x77fff733, 0xffffffff,
+        0xffffffff, 0x0000ffff, 0x00000000, 0xff000000, 0xffffffff, 0xffffffff, 0xfdfffffe, 0x0000ffff,
+        0x00000000, 0xff000000, 0xffffffff, 0xffffffff, 0x88ffffcc, 0xff00ffff, 0xffff00ff, 0xeeffff42,
+        0xffffffff, 0xffffffff, 0x08fff08c, 0xf000fff0, 0xfff000ff, 0x6efff002, 0xf7fffff3, 0xffffffff,
+        0x08ff008c, 0x0000ff00, 0xff0000ff, 0x6eff1002, 0x77ffff33, 0xffffffff, 0x08f8008c, 0x0000f000,
+        0xf10000f0, 0x6ef31002, 0x77fff733, 0xffffffff, 0x08c8008c, 0x00008000, 0x31000010, 0x6e731002,
+        0x77fff733, 0xffffffff, 0x0ec8008e, 0x000e8000, 0x31000e10, 0x6e73100e, 0x77fff733, 0xffffffff,
+        0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xffff0000, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0x000000ff, 0x00000000, 0xffff0000, 0xffffffff, 0x88ffffcc, 0xff00ffff, 0xffff00ff, 0xa6ffff00,
+        0xffffffff, 0xffffffff, 0x08fff08c, 0xf000fff0, 0xfff000ff, 0x26fff000, 0xf7fffff1, 0xffffffff,
+        0x08ff008c, 0x0000ff00, 0xff0000ff, 0x26ff1000, 0x77ffff31, 0xffffffff, 0x08f8008c, 0x0000f000,
+        0xf10000f0, 0x26f31000, 0x77fff731, 0xffffffff, 0x08c8008c, 0x00008000, 0x31000010, 0x26731000,
+        0x77fff731, 0xffffffff, 0x0ec8008e, 0x000e8000, 0x31000e10, 0x2e73100e, 0x77fff731, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0xffffff00, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0x00000000, 0x00000000, 0xffffff00, 0x88ffffcc, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0xff7fffff, 0xffffffff, 0x08fff08c, 0xf000fff0, 0xfff000ff, 0x00fff000, 0xf37ffff1, 0xffffffff,
+        0x08ff008c, 0x0000ff00, 0xff0000ff, 0x00ff1000, 0x737fff31, 0xffffffff, 0x08f8008c, 0x0000f000,
+        0xf10000f0, 0x00f31000, 0x737ff731, 0xffffffff, 0x08c8008c, 0x00008000, 0x31000010, 0x00731000,
+        0x737ff731, 0xffffffff, 0x0ec8008e, 0x000e8000, 0x31000e10, 0x0e73100e, 0x737ff731, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0x00ffffff, 0x00000000, 0x00000000, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0x00ffffff, 0x00000000, 0x00000000, 0x88ffff88, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0xff11ffff, 0xffffffff, 0x08fff088, 0xf000fff0, 0xfff000ff, 0x00fff000, 0xf311fff1, 0xfff7ffff,
+        0x08ff0088, 0x0000ff00, 0xff0000ff, 0x00ff1000, 0x7311ff31, 0xfff7ffff, 0x08f80088, 0x0000f000,
+        0xf10000f0, 0x00f31000, 0x7311f731, 0xfff7ffff, 0x08c80088, 0x00008000, 0x31000010, 0x00731000,
+        0x7311f731, 0xfff7ffff, 0x0cc8008c, 0x000c8000, 0x31000c10, 0x0e73100c, 0x731ff731, 0xfff7ffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0000ffff, 0x00000000, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0x0000ffff, 0x00000000, 0x00ffff88, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0xff11ffff, 0xffff33ff, 0x00fff088, 0xf000fff0, 0xfff000ff, 0x00fff000, 0xf311fff1, 0xfff733ff,
+        0x00ff0088, 0x0000ff00, 0xff0000ff, 0x00ff1000, 0x7311ff31, 0xfff733ff, 0x00f80088, 0x0000f000,
+        0xf10000f0, 0x00f31000, 0x7311f731, 0xfff733ff, 0x00c80088, 0x00008000, 0x31000010, 0x00731000,
+        0x7311f731, 0xfff733ff, 0x08c80088, 0x00088000, 0x31000810, 0x08731008, 0x731ff731, 0xfff73fff,
+        0x00000000, 0xfffe0000, 0xfffffeff, 0xfefffffe, 0xfffeffff, 0xfffffeff, 0x00000000, 0xfffa0000,
+        0xfffff6ff, 0xfefffffe, 0xfffeffff, 0xfffffeff, 0x00000000, 0xff200000, 0xffff72ff, 0xfeffff76,
+        0xfffeffff, 0xfffffeff, 0x00fff000, 0xf002fff0, 0xfff226ff, 0xeefff666, 0xfffeffff, 0xfffffeff,
+        0x0eff000e, 0x0002ff00, 0xff0026ff, 0xeeff1266, 0x7ffeff37, 0xfffffeff, 0x00f80000, 0x0002f000,
+        0xf10026f0, 0xeef31266, 0x7ffef737, 0xfffffeff, 0x0ec8000e, 0x000e8000, 0x31002e10, 0xee73126e,
+        0x7ffef737, 0xfffffeff, 0x0ec8000e, 0x000e8000, 0x31002e10, 0xee73126e, 0x7ffef737, 0xfffffeff,
+        0x00000000, 0x00000000, 0xfffffd00, 0xfdfffffd, 0xfffdffff, 0xfffffdff, 0x00000000, 0x00000000,
+        0xfffff500, 0xfdfffffd, 0xfffdffff, 0xfffffdff, 0x00000000, 0x00000000, 0xffff7100, 0xfdfffff5,
+        0xfffdffff, 0xfffffdff, 0x00fff48c, 0xf000fff0, 0xfff224ff, 0xecfff66c, 0xfffdffff, 0xfffffdff,
+        0x0cff008c, 0x000cff00, 0xff0024ff, 0xecff126c, 0x7ffdff37, 0xfffffdff, 0x00f8008c, 0x0000f000,
+        0xf10024f0, 0xecf3126c, 0x7ffdf737, 0xfffffdff, 0x0cc8008c, 0x000c8000, 0x31002c10, 0xec73126c,
+        0x7ffdf737, 0xfffffdff, 0x0cc8008c, 0x000c8000, 0x31002c10, 0xec73126c, 0x7ffdf737, 0xfffffdff,
+        0x00fffffb, 0x00000000, 0x00000000, 0xfbfffffb, 0xfffbffff, 0xfffffbff, 0x00fffffa, 0x00000000,
+        0x00000000, 0xfbfffffb, 0xfffbffff, 0xfffffbff, 0x00ffffe8, 0x00000000, 0x00000000, 0xfbfffff3,
+        0xfffbffff, 0xfffffbff, 0x08fffcca, 0xf000fff8, 0xfff202ff, 0xeafff66a, 0xfffbffff, 0xfffffbff,
+        0x0aff08ca, 0x000aff00, 0xff000aff, 0xeaff126a, 0x7ffbff37, 0xfffffbff, 0x08f808ca, 0x0000f000,
+        0xf10002f0, 0xeaf3126a, 0x7ffbf737, 0xfffffbff, 0x0ac808ca, 0x000a8000, 0x31000a10, 0xea73126a,
+        0x7ffbf737, 0xfffffbff, 0x0ac808ca, 0x000a8000, 0x31000a10, 0xea73126a, 0x7ffbf737, 0xfffffbff,
+        0xf7fffff7, 0x0000ffff, 0x00000000, 0xf7000000, 0xfff7ffff, 0xfffff7ff, 0xf5fffff6, 0x0000ffff,
+        0x00000000, 0xf7000000, 0xfff7ffff, 0xfffff7ff, 0xc0ffffe4, 0x0000ffff, 0x00000000, 0xf7000000,
+        0xfff7ffff, 0xfffff7ff, 0x84fffcc6, 0xf000fff8, 0xfff000ff, 0xe6fff426, 0xfff7ffff, 0xfffff7ff,
+        0x84ff08c6, 0x0006ff00, 0xff0006ff, 0xe6ff1026, 0x7ff7ff37, 0xfffff7ff, 0x84f808c6, 0x0000f000,
+        0xf10000f0, 0xe6f31026, 0x7ff7f737, 0xfffff7ff, 0x86c808c6, 0x00068000, 0x31000610, 0xe6731026,
+        0x7ff7f737, 0xfffff7ff, 0x86c808c6, 0x00068000, 0x31000610, 0xe6731026, 0x7ff7f737, 0xfffff7ff,
+        0xffffffff, 0xffffffff, 0x000000ff, 0x00000000, 0xffff0000, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0x000000ff, 0x00000000, 0xffff0000, 0xffffffff, 0xc8ffffcc, 0xff80ffff, 0x000000ff, 0x00000000,
+        0xffff0000, 0xffffffff, 0x8cfffccc, 0xf008fff8, 0xfff000ff, 0x6efff000, 0xfffffffb, 0xffffffff,
+        0x8cff08cc, 0x0008ff00, 0xff000eff, 0x6eff100e, 0x7fffff33, 0xffffffff, 0x8cf808cc, 0x0008f000,
+        0xf10000f0, 0x6ef31000, 0x7ffff733, 0xffffffff, 0x8ec808ce, 0x000e8000, 0x31000e10, 0x6e73100e,
+        0x7ffff733, 0xffffffff, 0x8ec808ce, 0x000e8000, 0x31000e10, 0x6e73100e, 0x7ffff733, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0xffffff00, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0x00000000, 0x00000000, 0xffffff00, 0x88ffffcc, 0xff80ffff, 0xffff00ff, 0x00000000,
+        0x00000000, 0xffffff00, 0x88fffccc, 0xf008fff8, 0xfff000ff, 0x00fff000, 0xf7fffff1, 0xffffffff,
+        0x88ff08cc, 0x0008ff00, 0xff0000ff, 0x0eff100e, 0x77ffff31, 0xffffffff, 0x88f808cc, 0x0008f000,
+        0xf10000f0, 0x00f31000, 0x77fff731, 0xffffffff, 0x8cc808cc, 0x000c8000, 0x31000c10, 0x0e73100e,
+        0x77fff731, 0xffffffff, 0x8ec808ce, 0x000e8000, 0x31000e10, 0x0e73100e, 0x77fff731, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0x00ffffff, 0x00000000, 0x00000000, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0x00ffffff, 0x00000000, 0x00000000, 0x88ffff88, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0x00000000, 0x00000000, 0x88fff888, 0xf000fff8, 0xfff000ff, 0x00fff000, 0xf311fff1, 0xffffffff,
+        0x88ff0888, 0x0000ff00, 0xff0000ff, 0x0eff1000, 0x731fff31, 0xffffffff, 0x88f80888, 0x0000f000,
+        0xf10000f0, 0x00f31000, 0x7311f731, 0xffffffff, 0x88c80888, 0x00088000, 0x31000810, 0x0e731008,
+        0x731ff731, 0xffffffff, 0x8cc8088c, 0x000c8000, 0x31000c10, 0x0e73100c, 0x731ff731, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x0000ffff, 0x00000000, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0x0000ffff, 0x00000000, 0x00ffff88, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0x0000ffff, 0x00000000, 0x00fff888, 0xf000fff0, 0xfff000ff, 0x00fff000, 0xf311fff1, 0xfff733ff,
+        0x00ff0888, 0x0000ff00, 0xff0000ff, 0x00ff1000, 0x731fff31, 0xfff73fff, 0x00f80888, 0x0000f000,
+        0xf10000f0, 0x00f31000, 0x7311f731, 0xfff733ff, 0x00c80888, 0x00008000, 0x31000010, 0x00731000,
+        0x731ff731, 0xfff73fff, 0x08c80888, 0x00088000, 0x31000810, 0x08731008, 0x731ff731, 0xfff73fff,
+        0xefffffef, 0xffefffff, 0xffffefff, 0xefffffef, 0xffefffff, 0xffffefff, 0x00000000, 0xffeb0000,
+        0xffffe7ff, 0xefffffef, 0xffefffff, 0xffffefff, 0x00000000, 0xff200000, 0xffff63ff, 0xefffff67,
+        0xffefffff, 0xffffefff, 0x00000000, 0xf2020000, 0xfff727ff, 0xeffff767, 0xffefffff, 0xffffefff,
+        0x0eff0000, 0x0022ff00, 0xff2266ff, 0xeeff7666, 0xffefffff, 0xffffefff, 0xeef800ee, 0x0026f000,
+        0xf10266f0, 0xeef33666, 0xffeff77f, 0xffffefff, 0x0ec8000e, 0x002e8000, 0x31026e10, 0xee73366e,
+        0xffeff77f, 0xffffefff, 0xeec800ee, 0x00ee8000, 0x3102ee10, 0xee7336ee, 0xffeff77f, 0xffffefff,
+        0xdfffffdf, 0xffdfffff, 0xffffdfff, 0xdfffffdf, 0xffdfffff, 0xffffdfff, 0x00000000, 0x00000000,
+        0xffffd700, 0xdfffffdf, 0xffdfffff, 0xffffdfff, 0x00000000, 0x00000000, 0xffff5300, 0xdfffffd7,
+        0xffdfffff, 0xffffdfff, 0x00000000, 0x00000000, 0xfff71700, 0xdfffff5f, 0xffdfffff, 0xffffdfff,
+        0x00ff48ce, 0x000eff00, 0xff2246ff, 0xceff76ce, 0xffdfffff, 0xffffdfff, 0xcef808ce, 0x00cef000,
+        0xf1024ef0, 0xcef336ce, 0xffdff77f, 0xffffdfff, 0x0ec808ce, 0x000e8000, 0x31024e10, 0xce7336ce,
+        0xffdff77f, 0xffffdfff, 0xcec808ce, 0x00ce8000, 0x3102ce10, 0xce7336ce, 0xffdff77f, 0xffffdfff,
+        0xbfffffbf, 0xffbfffff, 0xffffbfff, 0xbfffffbf, 0xffbfffff, 0xffffbfff, 0x00ffffbe, 0x00000000,
+        0x00000000, 0xbfffffbf, 0xffbfffff, 0xffffbfff, 0x00ffffac, 0x00000000, 0x00000000, 0xbfffffb7,
+        0xffbfffff, 0xffffbfff, 0x00fffe8e, 0x00000000, 0x00000000, 0xbfffff3f, 0xffbfffff, 0xffffbfff,
+        0x8effccae, 0x0000ff80, 0xff202eff, 0xaeff76ae, 0xffbfffff, 0xffffbfff, 0xaef88cae, 0x00aef000,
+        0xf100aef0, 0xaef336ae, 0xffbff77f, 0xffffbfff, 0x8ec88cae, 0x000e8000, 0x31002e10, 0xae7336ae,
+        0xffbff77f, 0xffffbfff, 0xaec88cae, 0x00ae8000, 0x3100ae10, 0xae7336ae, 0xffbff77f, 0xffffbfff,
+        0x7fffff7f, 0xff7fffff, 0xffff7fff, 0x7fffff7f, 0xff7fffff, 0xffff7fff, 0x7dffff7e, 0x0000ffff,
+        0x00000000, 0x7f000000, 0xff7fffff, 0xffff7fff, 0x48ffff6c, 0x0000ffff, 0x00000000, 0x7f000000,
+        0xff7fffff, 0xffff7fff, 0x0cfffe4e, 0x0000fffc, 0x00000000, 0x7f000000, 0xff7fffff, 0xffff7fff,
+        0x4cffcc6e, 0x000eff88, 0xff0000ff, 0x6eff526e, 0xff7fffff, 0xffff7fff, 0x4ef88c6e, 0x006ef008,
+        0xf1006ef0, 0x6ef3126e, 0xff7ff77f, 0xffff7fff, 0x4ec88c6e, 0x000e8008, 0x31000e10, 0x6e73126e,
+        0xff7ff77f, 0xffff7fff, 0x6ec88c6e, 0x006e8008, 0x31006e10, 0x6e73126e, 0xff7ff77f, 0xffff7fff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0x000000ff, 0x00000000, 0xffff0000, 0xffffffff, 0xc8ffffcc, 0xff80ffff, 0x000000ff, 0x00000000,
+        0xffff0000, 0xffffffff, 0x8cfffccc, 0xf808fffc, 0x000000ff, 0x00000000, 0xffff0000, 0xffffffff,
+        0xccffcccc, 0x0088ff88, 0xff000eff, 0xeeff1000, 0xffffffb7, 0xffffffff, 0xccf88ccc, 0x008cf008,
+        0xf100eef0, 0xeef310ee, 0xfffff737, 0xffffffff, 0xcec88cce, 0x008e8008, 0x31000e10, 0xee73100e,
+        0xfffff737, 0xffffffff, 0xeec88cee, 0x00ee8008, 0x3100ee10, 0xee7310ee, 0xfffff737, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0x00000000, 0x00000000, 0xffffff00, 0x88ffffcc, 0xff80ffff, 0xffff00ff, 0x00000000,
+        0x00000000, 0xffffff00, 0x88fffccc, 0xf808fff8, 0xfff000ff, 0x00000000, 0x00000000, 0xffffff00,
+        0x88ffcccc, 0x0088ff88, 0xff0000ff, 0x00ff100e, 0x7fffff31, 0xffffffff, 0x88f88ccc, 0x0088f008,
+        0xf10008f0, 0xeef310ee, 0x7ffff731, 0xffffffff, 0x8cc88ccc, 0x008c8008, 0x31000c10, 0x0e73100e,
+        0x7ffff731, 0xffffffff, 0xcec88cce, 0x00ce8008, 0x3100ce10, 0xee7310ee, 0x7ffff731, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0x00ffffff, 0x00000000, 0x00000000, 0x88ffff88, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0x00000000, 0x00000000, 0x88fff888, 0xf000fff8, 0xfff000ff, 0x00fff000, 0x00000000, 0x00000000,
+        0x88ff8888, 0x0000ff88, 0xff0000ff, 0x0eff1000, 0x7311ff31, 0xffffffff, 0x88f88888, 0x0000f008,
+        0xf10000f0, 0xeef31000, 0x73fff731, 0xffffffff, 0x88c88888, 0x00088008, 0x31000810, 0x0e731008,
+        0x731ff731, 0xffffffff, 0x8cc8888c, 0x008c8008, 0x31008c10, 0xee73108c, 0x73fff731, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0x0000ffff, 0x00000000, 0x00ffff88, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0x0000ffff, 0x00000000, 0x00fff888, 0xf000fff0, 0xfff000ff, 0x00fff000, 0x0000fff1, 0x00000000,
+        0x00ff8888, 0x0000ff00, 0xff0000ff, 0x00ff1000, 0x731fff31, 0xfff733ff, 0x00f88888, 0x0000f000,
+        0xf10000f0, 0x00f31000, 0x73fff731, 0xfff7ffff, 0x00c88888, 0x00008000, 0x31000010, 0x00731000,
+        0x731ff731, 0xfff73fff, 0x08c88888, 0x00088000, 0x31000810, 0x08731008, 0x73fff731, 0xfff7ffff,
+        0xfffffeff, 0xfefffffe, 0xfffeffff, 0xfffffeff, 0xfefffffe, 0xfffeffff, 0xfdfffefe, 0xfefbfffe,
+        0xfffef7ff, 0xfffffeff, 0xfefffffe, 0xfffeffff, 0x00000000, 0xfe310000, 0xfffe73ff, 0xfffffe77,
+        0xfefffffe, 0xfffeffff, 0x00000000, 0xf2020000, 0xfff637ff, 0xfffff677, 0xfefffffe, 0xfffeffff,
+        0x00000000, 0x20220000, 0xff7277ff, 0xffff7677, 0xfefffffe, 0xfffeffff, 0xeef8000e, 0x0226f000,
+        0xf32666f0, 0xfff77666, 0xfefffffe, 0xfffeffff, 0xeecc8eee, 0x026e880e, 0x33266e10, 0xff77766e,
+        0xfefffffe, 0xfffeffff, 0xeecc80ee, 0x02ee8800, 0x3326ee10, 0xff7776ee, 0xfefffffe, 0xfffeffff,
+        0xfffffdff, 0xfdfffffd, 0xfffdffff, 0xfffffdff, 0xfdfffffd, 0xfffdffff, 0xfdfffdfe, 0xfdfbfffd,
+        0xfffdf7ff, 0xfffffdff, 0xfdfffffd, 0xfffdffff, 0x00000000, 0x00000000, 0xfffd7300, 0xfffffdf7,
+        0xfdfffffd, 0xfffdffff, 0x00000000, 0x00000000, 0xfff53700, 0xfffffd7f, 0xfdfffffd, 0xfffdffff,
+        0x00000000, 0x00000000, 0xff717700, 0xfffff5ff, 0xfdfffffd, 0xfffdffff, 0x0efc8cee, 0x00eef000,
+        0xf3246ef0, 0xfff77cee, 0xfdfffffd, 0xfffdffff, 0xeecc8cee, 0x0cee880c, 0x3324ee10, 0xff777cee,
+        0xfdfffffd, 0xfffdffff, 0xeecc8cee, 0x00ee8800, 0x3324ee10, 0xff777cee, 0xfdfffffd, 0xfffdffff,
+        0xfffffbff, 0xfbfffffb, 0xfffbffff, 0xfffffbff, 0xfbfffffb, 0xfffbffff, 0xfdfffbfe, 0xfbfbfffb,
+        0xfffbf7ff, 0xfffffbff, 0xfbfffffb, 0xfffbffff, 0x00fffbec, 0x00000000, 0x00000000, 0xfffffbf7,
+        0xfbfffffb, 0xfffbffff, 0x00ffface, 0x00000000, 0x00000000, 0xfffffb7f, 0xfbfffffb, 0xfffbffff,
+        0x00ffe8ee, 0x00000000, 0x00000000, 0xfffff3ff, 0xfbfffffb, 0xfffbffff, 0xeefccaee, 0x000ef808,
+        0xf302eef0, 0xfff77aee, 0xfbfffffb, 0xfffbffff, 0xeecccaee, 0x0aee880a, 0x330aee10, 0xff777aee,
+        0xfbfffffb, 0xfffbffff, 0xeecccaee, 0x00ee8808, 0x3302ee10, 0xff777aee, 0xfbfffffb, 0xfffbffff,
+        0xfffff7ff, 0xf7fffff7, 0xfff7ffff, 0xfffff7ff, 0xf7fffff7, 0xfff7ffff, 0xfdfff7fe, 0xf7fbfff7,
+        0xfff7f7ff, 0xfffff7ff, 0xf7fffff7, 0xfff7ffff, 0xc8fff7ec, 0x0000fff7, 0x00000000, 0xff000000,
+        0xf7fffff7, 0xfff7ffff, 0x8cfff6ce, 0x0000fff4, 0x00000000, 0xff000000, 0xf7fffff7, 0xfff7ffff,
+        0xccffe4ee, 0x0000ffc0, 0x00000000, 0xff000000, 0xf7fffff7, 0xfff7ffff, 0xcefcc6ee, 0x00eef884,
+        0xf1000ef0, 0xfff736ee, 0xf7fffff7, 0xfff7ffff, 0xeeccc6ee, 0x06ee8884, 0x3306ee10, 0xff7736ee,
+        0xf7fffff7, 0xfff7ffff, 0xeeccc6ee, 0x00ee8884, 0x3300ee10, 0xff7736ee, 0xf7fffff7, 0xfff7ffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0xc8ffffcc, 0xff80ffff, 0x000000ff, 0x00000000,
+        0xffff0000, 0xffffffff, 0x8cfffccc, 0xf808fffc, 0x000000ff, 0x00000000, 0xffff0000, 0xffffffff,
+        0xccffcccc, 0x8088ffc8, 0x000000ff, 0x00000000, 0xffff0000, 0xffffffff, 0xccfccccc, 0x088cf88c,
+        0xf100eef0, 0xfff3100e, 0xffffff7f, 0xffffffff, 0xceccccce, 0x08ce888c, 0x330eee10, 0xff773eee,
+        0xffffff7f, 0xffffffff, 0xeeccccee, 0x08ee888c, 0x3300ee10, 0xff7730ee, 0xffffff7f, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x88ffffcc, 0xff80ffff, 0xffff00ff, 0x00000000,
+        0x00000000, 0xffffff00, 0x88fffccc, 0xf808fff8, 0xfff000ff, 0x00000000, 0x00000000, 0xffffff00,
+        0x88ffcccc, 0x8088ff88, 0xff0000ff, 0x00000000, 0x00000000, 0xffffff00, 0x88fccccc, 0x0888f888,
+        0xf10008f0, 0x0ef310ee, 0xfffff731, 0xffffffff, 0x8ccccccc, 0x088c8888, 0x31008c10, 0xee771eee,
+        0xffffff7f, 0xffffffff, 0xceccccce, 0x08ce8888, 0x3100ce10, 0xee7710ee, 0xffffff71, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x88ffff88, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0x00000000, 0x00000000, 0x88fff888, 0xf000fff8, 0xfff000ff, 0x00fff000, 0x00000000, 0x00000000,
+        0x88ff8888, 0x0000ff88, 0xff0000ff, 0x00ff1000, 0x00000000, 0x00000000, 0x88f88888, 0x0000f888,
+        0xf10000f0, 0xeef31000, 0x731ff731, 0xffffffff, 0x88c88888, 0x00088888, 0x31000810, 0xee731008,
+        0xffffff3f, 0xffffffff, 0x8cc8888c, 0x008c8888, 0x31008c10, 0xee73108c, 0xf3ffff31, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff88, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0x0000ffff, 0x00000000, 0x00fff888, 0xf000fff0, 0xfff000ff, 0x00fff000, 0x0000fff1, 0x00000000,
+        0x00ff8888, 0x0000ff00, 0xff0000ff, 0x00ff1000, 0x0000ff31, 0x00000000, 0x00f88888, 0x0000f000,
+        0xf10000f0, 0x00f31000, 0x73fff731, 0xfff73fff, 0x00c88888, 0x00008000, 0x31000010, 0x00731000,
+        0x7ffff731, 0xffffffff, 0x08c88888, 0x00088000, 0x31000810, 0x08731008, 0x73fff731, 0xfff7ffff,
+        0xffffefff, 0xefffffef, 0xffefffff, 0xffffefff, 0xefffffef, 0xffefffff, 0xfdffeffe, 0xeffbffef,
+        0xffeff7ff, 0xffffefff, 0xefffffef, 0xffefffff, 0x18ffefec, 0xef31ffef, 0xffef73ff, 0xffffef77,
+        0xefffffef, 0xffefffff, 0x00000000, 0xe3020000, 0xffe737ff, 0xffffe777, 0xefffffef, 0xffefffff,
+        0x00000000, 0x20220000, 0xff6377ff, 0xffff6777, 0xefffffef, 0xffefffff, 0x00000000, 0x02260000,
+        0xf72777f2, 0xfff76777, 0xefffffef, 0xffefffff, 0xeeccc0ee, 0x226e880e, 0x33666e10, 0xff77677f,
+        0xefffffef, 0xffefffff, 0xeeceeeee, 0x66eeacee, 0x3766ee52, 0xff7767ff, 0xefffffef, 0xffefffff,
+        0xffffdfff, 0xdfffffdf, 0xffdfffff, 0xffffdfff, 0xdfffffdf, 0xffdfffff, 0xfdffdffe, 0xdffbffdf,
+        0xffdff7ff, 0xffffdfff, 0xdfffffdf, 0xffdfffff, 0xd8ffdfec, 0xdf31ffdf, 0xffdf73ff, 0xffffdff7,
+        0xdfffffdf, 0xffdfffff, 0x00000000, 0x00000000, 0xffd73700, 0xffffdf7f, 0xdfffffdf, 0xffdfffff,
+        0x00000000, 0x00000000, 0xff537700, 0xffffd7ff, 0xdfffffdf, 0xffdfffff, 0x00000000, 0x00000000,
+        0xf7177f00, 0xffff5fff, 0xdfffffdf, 0xffdfffff, 0xeeccceee, 0x0eee8880, 0x3346ee10, 0xff77dfff,
+        0xdfffffdf, 0xffdfffff, 0xeececeee, 0xceeeacce, 0xb7ceee5a, 0xff7fdfff, 0xdfffffdf, 0xffdfffff,
+        0xffffbfff, 0xbfffffbf, 0xffbfffff, 0xffffbfff, 0xbfffffbf, 0xffbfffff, 0xfdffbffe, 0xbffbffbf,
+        0xffbff7ff, 0xffffbfff, 0xbfffffbf, 0xffbfffff, 0xc8ffbfec, 0xbfb1ffbf, 0xffbf73ff, 0xffffbff7,
+        0xbfffffbf, 0xffbfffff, 0x00ffbece, 0x00000000, 0x00000000, 0xffffbf7f, 0xbfffffbf, 0xffbfffff,
+        0x00ffacee, 0x00000000, 0x00000000, 0xffffb7ff, 0xbfffffbf, 0xffbfffff, 0x00fe8eee, 0x00000000,
+        0x00000000, 0xffff3fff, 0xbfffffbf, 0xffbfffff, 0xeeccaeee, 0x00ee888e, 0x332eee10, 0xff77bfff,
+        0xbfffffbf, 0xffbfffff, 0xeeceaeee, 0xaeeeacae, 0xb7aeee5a, 0xff7fbfff, 0xbfffffbf, 0xffbfffff,
+        0xffff7fff, 0x7fffff7f, 0xff7fffff, 0xffff7fff, 0x7fffff7f, 0xff7fffff, 0xfdff7ffe, 0x7ffbff7f,
+        0xff7ff7ff, 0xffff7fff, 0x7fffff7f, 0xff7fffff, 0xc8ff7fec, 0x7f81ff7f, 0xff7f73ff, 0xffff7ff7,
+        0x7fffff7f, 0xff7fffff, 0x8cff7ece, 0x0000ff7c, 0x00000000, 0xff000000, 0x7fffff7f, 0xff7fffff,
+        0xccff6cee, 0x0000ff48, 0x00000000, 0xff000000, 0x7fffff7f, 0xff7fffff, 0xcefe4eee, 0x0000fc0c,
+        0x00000000, 0xff000000, 0x7fffff7f, 0xff7fffff, 0xeecc6eee, 0x0eee884c, 0x3320ee10, 0xff777fff,
+        0x7fffff7f, 0xff7fffff, 0xeece6eee, 0x6eeeac6e, 0xb76eee5a, 0xff7f7fff, 0x7fffff7f, 0xff7fffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0xc8ffffcc, 0xff80ffff, 0xffff03ff, 0xfffffff7,
+        0xffffffff, 0xffffffff, 0x8cfffccc, 0xf808fffc, 0x000000ff, 0x00000000, 0xffff0000, 0xffffffff,
+        0xccffcccc, 0x8088ffc8, 0x000000ff, 0x00000000, 0xffff0000, 0xffffffff, 0xccfccccc, 0x088cfc8c,
+        0x000000f8, 0x00000000, 0xffff0000, 0xffffffff, 0xceccccce, 0x88ce88cc, 0x330eee10, 0xff7770ee,
+        0xffffffff, 0xffffffff, 0xeeccccee, 0xccee8ccc, 0xb7eeee58, 0xff7ffeee, 0xffffffff, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x88ffffcc, 0xff80ffff, 0xffff00ff, 0xffffff07,
+        0xffffffff, 0xffffffff, 0x88fffccc, 0xf808fff8, 0xfff000ff, 0x00000000, 0x00000000, 0xffffff00,
+        0x88ffcccc, 0x8088ff88, 0xff0000ff, 0x00000000, 0x00000000, 0xffffff00, 0x88fccccc, 0x0888f888,
+        0xf10008f8, 0x00000000, 0x00000000, 0xffffff00, 0x8ccccccc, 0x888c8888, 0x31008c10, 0xee771eee,
+        0xfffffff1, 0xffffffff, 0xceccccce, 0x88ce8888, 0xb188ce18, 0xee7ffeee, 0xffffffff, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x88ffff88, 0xff00ffff, 0xffff00ff, 0x0fffff00,
+        0xffffffff, 0xffffffff, 0x88fff888, 0xf000fff8, 0xfff000ff, 0x00fff000, 0x00000000, 0x00000000,
+        0x88ff8888, 0x0000ff88, 0xff0000ff, 0x00ff1000, 0x00000000, 0x00000000, 0x88f88888, 0x0000f888,
+        0xf10000f0, 0x00f31000, 0x00000000, 0x00000000, 0x88c88888, 0x00088888, 0x31000810, 0xee731008,
+        0xf3ffff3f, 0xffffffff, 0x8cc8888c, 0x008c8888, 0x31008c10, 0xee73108c, 0xffffffff, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff88, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0xff1fffff, 0xffffffff, 0x00fff888, 0xf000fff0, 0xfff000ff, 0x00fff000, 0x0000fff1, 0x00000000,
+        0x00ff8888, 0x0000ff00, 0xff0000ff, 0x00ff1000, 0x0000ff31, 0x00000000, 0x00f88888, 0x0000f000,
+        0xf10000f0, 0x00f31000, 0x0000f731, 0x00000000, 0x00c88888, 0x00008000, 0x31000010, 0x00731000,
+        0x7ffff731, 0xfff7ffff, 0x08c88888, 0x00088000, 0x31000810, 0x08731008, 0xfffff731, 0xffffffff,
+        0xfffeffff, 0xfffffeff, 0xfefffffe, 0xfffeffff, 0xfffffeff, 0xfefffffe, 0xfdfefffe, 0xfffbfeff,
+        0xfefff7fe, 0xfffeffff, 0xfffffeff, 0xfefffffe, 0x08feffcc, 0xff11feff, 0xfeff33fe, 0xfffeff77,
+        0xfffffeff, 0xfefffffe, 0x00fefe00, 0xf300fef1, 0xfef733fe, 0xfffef777, 0xfffffeff, 0xfefffffe,
+        0x00000000, 0x30220000, 0xfe7377fe, 0xfffe7777, 0xfffffeff, 0xfefffffe, 0x00000000, 0x02220000,
+        0xf63777f2, 0xfff67777, 0xfffffeff, 0xfefffffe, 0x00000000, 0x226e0000, 0x72777f30, 0xff76777f,
+        0xfffffeff, 0xfefffffe, 0xeecceeee, 0x66ee8eee, 0x3677ff52, 0xff7677ff, 0xfffffeff, 0xfefffffe,
+        0xfffdffff, 0xfffffdff, 0xfdfffffd, 0xfffdffff, 0xfffffdff, 0xfdfffffd, 0xfdfdfffe, 0xfffbfdff,
+        0xfdfff7fd, 0xfffdffff, 0xfffffdff, 0xfdfffffd, 0x88fdffcc, 0xff11fdff, 0xfdff33fd, 0xfffdff77,
+        0xfffffdff, 0xfdfffffd, 0x00fdfecc, 0xf311fdfd, 0xfdf733fd, 0xfffdff77, 0xfffffdff, 0xfdfffffd,
+        0x00000000, 0x00000000, 0xfd737700, 0xfffdf7ff, 0xfffffdff, 0xfdfffffd, 0x00000000, 0x00000000,
+        0xf5377700, 0xfffd7fff, 0xfffffdff, 0xfdfffffd, 0x00000000, 0x00000000, 0x7177ff00, 0xfff5ffff,
+        0xfffffdff, 0xfdfffffd, 0xeecceeee, 0xeeeea8ee, 0xb5ffff1d, 0xff7dffff, 0xfffffdff, 0xfdfffffd,
+        0xfffbffff, 0xfffffbff, 0xfbfffffb, 0xfffbffff, 0xfffffbff, 0xfbfffffb, 0xfdfbfffe, 0xfffbfbff,
+        0xfbfff7fb, 0xfffbffff, 0xfffffbff, 0xfbfffffb, 0x88fbffcc, 0xff11fbff, 0xfbff33fb, 0xfffbff77,
+        0xfffffbff, 0xfbfffffb, 0x88fbfecc, 0xfb00fbfc, 0xfbf733fb, 0xfffbff77, 0xfffffbff, 0xfbfffffb,
+        0x00fbecee, 0x00000000, 0x00000000, 0xfffbf7ff, 0xfffffbff, 0xfbfffffb, 0x00faceee, 0x00000000,
+        0x00000000, 0xfffb7fff, 0xfffffbff, 0xfbfffffb, 0x00e8eeee, 0x00000000, 0x00000000, 0xfff3ffff,
+        0xfffffbff, 0xfbfffffb, 0xeec8eeee, 0xeeee8aee, 0x3bffff51, 0xff7bffff, 0xfffffbff, 0xfbfffffb,
+        0xfff7ffff, 0xfffff7ff, 0xf7fffff7, 0xfff7ffff, 0xfffff7ff, 0xf7fffff7, 0xfdf7fffe, 0xfffbf7ff,
+        0xf7fff7f7, 0xfff7ffff, 0xfffff7ff, 0xf7fffff7, 0x88f7ffcc, 0xff01f7ff, 0xf7ff33f7, 0xfff7ff77,
+        0xfffff7ff, 0xf7fffff7, 0x88f7fecc, 0xf800f7fc, 0xf7f700f7, 0xfff7ff77, 0xfffff7ff, 0xf7fffff7,
+        0xccf7ecee, 0x0000f7c8, 0x00000000, 0xff000000, 0xfffff7ff, 0xf7fffff7, 0xccf6ceee, 0x0000f48c,
+        0x00000000, 0xff000000, 0xfffff7ff, 0xf7fffff7, 0xeee4eeee, 0x0000c0cc, 0x00000000, 0xff000000,
+        0xfffff7ff, 0xf7fffff7, 0xeec6eeee, 0xeeeea4ee, 0xb3eeee16, 0xff77ffff, 0xfffff7ff, 0xf7fffff7,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x88ffffcc, 0xff00ffff, 0xffff03ff, 0xffffff77,
+        0xffffffff, 0xffffffff, 0x88fffccc, 0xf800fffc, 0xfff000ff, 0xffffff00, 0xffffffff, 0xffffffff,
+        0xccffcccc, 0x8088ffc8, 0x000000ff, 0x00000000, 0xffff0000, 0xffffffff, 0xccfccccc, 0x0888fc8c,
+        0x000000f8, 0x00000000, 0xffff0000, 0xffffffff, 0xceccccce, 0x88cec8cc, 0x00000090, 0x00000000,
+        0xffff0000, 0xffffffff, 0xeeccccee, 0xccee8ccc, 0x3feeee58, 0xff77feee, 0xffffffff, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x88ffffcc, 0xff00ffff, 0xffff00ff, 0xffffff07,
+        0xffffffff, 0xffffffff, 0x88fffccc, 0xf800fff8, 0xfff000ff, 0x00fff000, 0xffffffff, 0xffffffff,
+        0x88ffcccc, 0x8088ff88, 0xff0000ff, 0x00000000, 0x00000000, 0xffffff00, 0x88fccccc, 0x0888f888,
+        0xf10000f8, 0x00000000, 0x00000000, 0xffffff00, 0x8ccccccc, 0x888c8888, 0x31008c90, 0x00000000,
+        0x00000000, 0xffffff00, 0xceccccce, 0x88ce8888, 0xb188ce18, 0xee7ffeee, 0xffffffff, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x88ffff88, 0xff00ffff, 0xffff00ff, 0x0fffff00,
+        0xffffffff, 0xffffffff, 0x88fff888, 0xf000fff8, 0xfff000ff, 0x00fff000, 0xff11fff1, 0xffffffff,
+        0x88ff8888, 0x0000ff88, 0xff0000ff, 0x00ff1000, 0x00000000, 0x00000000, 0x88f88888, 0x0000f888,
+        0xf10000f0, 0x00f31000, 0x00000000, 0x00000000, 0x88c88888, 0x00088888, 0x31000810, 0x00731008,
+        0x00000000, 0x00000000, 0x8cc8888c, 0x008c8888, 0x31008c10, 0xee73108c, 0xffffffff, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff88, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0xff1fffff, 0xffffffff, 0x00fff888, 0xf000fff0, 0xfff000ff, 0x00fff000, 0xf311fff1, 0xffff33ff,
+        0x00ff8888, 0x0000ff00, 0xff0000ff, 0x00ff1000, 0x0000ff31, 0x00000000, 0x00f88888, 0x0000f000,
+        0xf10000f0, 0x00f31000, 0x0000f731, 0x00000000, 0x00c88888, 0x00008000, 0x31000010, 0x00731000,
+        0x0000f731, 0x00000000, 0x08c88888, 0x00088000, 0x31000810, 0x08731008, 0xfffff731, 0xffffffff,
+        0xffefffff, 0xffffefff, 0xefffffef, 0xffefffff, 0xffffefff, 0xefffffef, 0xfdeffffe, 0xfffbefff,
+        0xeffff7ef, 0xffefffff, 0xffffefff, 0xefffffef, 0x00efff00, 0xff00efff, 0xefff11ef, 0x77efff33,
+        0xffffefff, 0xefffffef, 0x00effc00, 0xf100eff0, 0xeff311ef, 0x77eff733, 0xffffefff, 0xefffffef,
+        0x00efe000, 0x3000ef10, 0xef7331ef, 0xf7ef7773, 0xffffefff, 0xefffffef, 0x00000000, 0x02220000,
+        0xe73777e3, 0xffe77777, 0xffffefff, 0xefffffef, 0x00000000, 0x22220000, 0x63777720, 0xff677777,
+        0xffffefff, 0xefffffef, 0x00000000, 0x66ee0000, 0x2777ff42, 0xff6777ff, 0xffffefff, 0xefffffef,
+        0xffdfffff, 0xffffdfff, 0xdfffffdf, 0xffdfffff, 0xffffdfff, 0xdfffffdf, 0xfddffffe, 0xfffbdfff,
+        0xdffff7df, 0xffdfffff, 0xffffdfff, 0xdfffffdf, 0x00dfff88, 0xff00dfff, 0xdfff11df, 0x77dfff33,
+        0xffffdfff, 0xdfffffdf, 0x00dffc88, 0xf100dff8, 0xdff311df, 0x77dff733, 0xffffdfff, 0xdfffffdf,
+        0x00dfecc8, 0x3100dfd0, 0xdf7331df, 0xf7dff773, 0xffffdfff, 0xdfffffdf, 0x00000000, 0x00000000,
+        0xd7377700, 0xffdf7fff, 0xffffdfff, 0xdfffffdf, 0x00000000, 0x00000000, 0x53777700, 0xffd7ffff,
+        0xffffdfff, 0xdfffffdf, 0x00000000, 0x00000000, 0x97ffff00, 0xff5fffff, 0xffffdfff, 0xdfffffdf,
+        0xffbfffff, 0xffffbfff, 0xbfffffbf, 0xffbfffff, 0xffffbfff, 0xbfffffbf, 0xfdbffffe, 0xfffbbfff,
+        0xbffff7bf, 0xffbfffff, 0xffffbfff, 0xbfffffbf, 0x00bfff88, 0xff00bfff, 0xbfff11bf, 0x77bfff33,
+        0xffffbfff, 0xbfffffbf, 0x00bffc88, 0xf100bff8, 0xbff311bf, 0x77bff733, 0xffffbfff, 0xbfffffbf,
+        0x80bfecc8, 0xb000bfc8, 0xbf7331bf, 0xf7bff773, 0xffffbfff, 0xbfffffbf, 0x00beceee, 0x00000000,
+        0x00000000, 0xffbf7fff, 0xffffbfff, 0xbfffffbf, 0x00aceeee, 0x00000000, 0x00000000, 0xffb7ffff,
+        0xffffbfff, 0xbfffffbf, 0x008eeeee, 0x00000000, 0x00000000, 0xff3fffff, 0xffffbfff, 0xbfffffbf,
+        0xff7fffff, 0xffff7fff, 0x7fffff7f, 0xff7fffff, 0xffff7fff, 0x7fffff7f, 0xfd7ffffe, 0xfffb7fff,
+        0x7ffff77f, 0xff7fffff, 0xffff7fff, 0x7fffff7f, 0x007fff88, 0xff007fff, 0x7fff007f, 0x777fff33,
+        0xffff7fff, 0x7fffff7f, 0x007ffc88, 0xf0007ff8, 0x7ff3007f, 0x777ff733, 0xffff7fff, 0x7fffff7f,
+        0x807fecc8, 0x80007fc8, 0x7f70007f, 0xf77ff773, 0xffff7fff, 0x7fffff7f, 0xcc7eceee, 0x00007c8c,
+        0x00000000, 0xff000000, 0xffff7fff, 0x7fffff7f, 0xcc6ceeee, 0x000048cc, 0x00000000, 0xff000000,
+        0xffff7fff, 0x7fffff7f, 0xee4eeeee, 0x00002cee, 0x00000000, 0xff000000, 0xffff7fff, 0x7fffff7f,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff88, 0xff00ffff, 0xffff00ff, 0x77ffff00,
+        0xffffffff, 0xffffffff, 0x00fffc88, 0xf000fff8, 0xfff000ff, 0x77fff700, 0xffffffff, 0xffffffff,
+        0x80ffccc8, 0x8000ffc8, 0xff0000ff, 0xf7fff000, 0xffffffff, 0xffffffff, 0xccfccccc, 0x0888fc8c,
+        0x000000f8, 0x00000000, 0xffff0000, 0xffffffff, 0xcccccccc, 0x8888c8cc, 0x00000090, 0x00000000,
+        0xffff0000, 0xffffffff, 0xeeccccee, 0xccee8ccc, 0x00000058, 0x00000000, 0xffff0000, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff88, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0xffffffff, 0xffffffff, 0x00fffc88, 0xf000fff8, 0xfff000ff, 0x00fff000, 0xffffffff, 0xffffffff,
+        0x80ffccc8, 0x8000ff88, 0xff0000ff, 0x00ff1000, 0xfffffff1, 0xffffffff, 0x88fccccc, 0x0888f888,
+        0xf10000f8, 0x00000000, 0x00000000, 0xffffff00, 0x88cccccc, 0x88888888, 0x31000090, 0x00000000,
+        0x00000000, 0xffffff00, 0xceccccce, 0x88ce8888, 0xb188ce18, 0x00000000, 0x00000000, 0xffffff00,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff88, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0xff11ffff, 0xffffffff, 0x00fff888, 0xf000fff8, 0xfff000ff, 0x00fff000, 0xff11fff1, 0xffffffff,
+        0x80ff8888, 0x0000ff88, 0xff0000ff, 0x00ff1000, 0xf311ff31, 0xffffffff, 0x88f88888, 0x0000f888,
+        0xf10000f0, 0x00f31000, 0x00000000, 0x00000000, 0x88c88888, 0x00008888, 0x31000010, 0x00731000,
+        0x00000000, 0x00000000, 0x8cc8888c, 0x008c8888, 0x31008c10, 0x0073108c, 0x00000000, 0x00000000,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff88, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0xff11ffff, 0xffff33ff, 0x00fff888, 0xf000fff0, 0xfff000ff, 0x00fff000, 0xf311fff1, 0xffff33ff,
+        0x00ff8888, 0x0000ff00, 0xff0000ff, 0x00ff1000, 0x7311ff31, 0xfff733ff, 0x00f88888, 0x0000f000,
+        0xf10000f0, 0x00f31000, 0x0000f731, 0x00000000, 0x00c88888, 0x00008000, 0x31000010, 0x00731000,
+        0x0000f731, 0x00000000, 0x08c88888, 0x00088000, 0x31000810, 0x08731008, 0x0000f731, 0x00000000,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff, 0xffff00ff, 0x33ffff11,
+        0xff77ffff, 0xffffffff, 0x00fff000, 0xf000fff0, 0xfff100ff, 0x33fff311, 0xff77fff7, 0xffffffff,
+        0x00ffc000, 0x1000ff00, 0xff3100ff, 0x33ff7311, 0xff77fff7, 0xffffffff, 0x00fe0000, 0x0000f000,
+        0xf73300f3, 0x73f77731, 0xfff7ffff, 0xffffffff, 0x00000000, 0x22220000, 0x73777720, 0xff777777,
+        0xffffffff, 0xffffffff, 0x00000000, 0x22220000, 0x37777702, 0xff777777, 0xffffffff, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff, 0xffff00ff, 0x33ffff11,
+        0xff77ffff, 0xffffffff, 0x00fff800, 0xf000fff0, 0xfff100ff, 0x33fff311, 0xff77fff7, 0xffffffff,
+        0x00ffc800, 0x1000ff80, 0xff3100ff, 0x33ff7311, 0xff77fff7, 0xffffffff, 0x00fecc80, 0x1000fd00,
+        0xf73300f3, 0x73ff7731, 0xfff7ffff, 0xffffffff, 0x00000000, 0x00000000, 0x73777700, 0xfff7ffff,
+        0xffffffff, 0xffffffff, 0x00000000, 0x00000000, 0x37777700, 0xff7fffff, 0xffffffff, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff, 0xffff00ff, 0x33ffff11,
+        0xff77ffff, 0xffffffff, 0x00fff800, 0xf000fff0, 0xfff100ff, 0x33fff311, 0xff77fff7, 0xffffffff,
+        0x00ffc800, 0x1000ff80, 0xff3100ff, 0x33ff7311, 0xff77fff7, 0xffffffff, 0x00fecc80, 0x0000fc88,
+        0xf73300fb, 0x73ff7731, 0xfff7ffff, 0xffffffff, 0x00eceeee, 0x00000000, 0x00000000, 0xfff7ffff,
+        0xffffffff, 0xffffffff, 0x00ceeeee, 0x00000000, 0x00000000, 0xff7fffff, 0xffffffff, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff, 0xffff00ff, 0x33ffff11,
+        0xff77ffff, 0xffffffff, 0x00fff800, 0xf000fff0, 0xfff000ff, 0x33fff311, 0xff77fff7, 0xffffffff,
+        0x00ffc800, 0x0000ff80, 0xff3000ff, 0x33ff7311, 0xff77fff7, 0xffffffff, 0x00fecc80, 0x0000fc88,
+        0xf70000f8, 0x73ff7731, 0xfff7ffff, 0xffffffff, 0xcceceeee, 0x0000c8cc, 0x00000000, 0xff000000,
+        0xffffffff, 0xffffffff, 0xcccceeee, 0x00008ccc, 0x00000000, 0xff000000, 0xffffffff, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff, 0xffff00ff, 0x33ffff00,
+        0xff77ffff, 0xffffffff, 0x00fff800, 0xf000fff0, 0xfff000ff, 0x33fff000, 0xff77fff7, 0xffffffff,
+        0x00ffc800, 0x0000ff80, 0xff0000ff, 0x33ff7000, 0xff77fff7, 0xffffffff, 0x00fccc80, 0x0000fc88,
+        0xf10000f8, 0x73ff1000, 0xfff7ffff, 0xffffffff, 0xcccccccc, 0x8888c8cc, 0x00000090, 0x00000000,
+        0xffff0000, 0xffffffff, 0xcccccccc, 0x88888ccc, 0x00000018, 0x00000000, 0xffff0000, 0xffffffff,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0xff77ffff, 0xffffffff, 0x00fff800, 0xf000fff0, 0xfff000ff, 0x00fff000, 0xff77fff1, 0xffffffff,
+        0x00ffc800, 0x0000ff80, 0xff0000ff, 0x00ff1000, 0xff77fff1, 0xffffffff, 0x00fccc80, 0x0000f888,
+        0xf10000f8, 0x00f31000, 0xfff7ff31, 0xffffffff, 0x88cccccc, 0x88888888, 0x31000090, 0x00000000,
+        0x00000000, 0xffffff00, 0x88cccccc, 0x88888888, 0x31000018, 0x00000000, 0x00000000, 0xffffff00,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0xff11ffff, 0xffffffff, 0x00fff800, 0xf000fff0, 0xfff000ff, 0x00fff000, 0xf311fff1, 0xffffffff,
+        0x00ff8800, 0x0000ff80, 0xff0000ff, 0x00ff1000, 0xf311ff31, 0xffffffff, 0x00f88880, 0x0000f888,
+        0xf10000f0, 0x00f31000, 0x7311f731, 0xffffffff, 0x88c88888, 0x00008888, 0x31000010, 0x00731000,
+        0x00000000, 0x00000000, 0x88c88888, 0x00008888, 0x31000010, 0x00731000, 0x00000000, 0x00000000,
+        0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfdfffffe, 0xfffbffff,
+        0xfffff7ff, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff, 0xffff00ff, 0x00ffff00,
+        0xff11ffff, 0xffff33ff, 0x00fff800, 0xf000fff0, 0xfff000ff, 0x00fff000, 0xf311fff1, 0xfff733ff,
+        0x00ff8800, 0x0000ff00, 0xff0000ff, 0x00ff1000, 0x7311ff31, 0xfff733ff, 0x00f88880, 0x0000f000,
+        0xf10000f0, 0x00f31000, 0x7311f731, 0xfff733ff, 0x00c88888, 0x00008000, 0x31000010, 0x00731000,
+        0x0000f731, 0x00000000, 0x00c88888, 0x00008000, 0x31000010, 0x00731000, 0x0000f731, 0x00000000,
+        0x00000000, 0xfff30000, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00000000, 0xff000000,
+        0xffff02ff, 0x6effff26, 0xffeeffff, 0xffffffff, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x26fff002,
+        0xf36efff0, 0xfff7ffff, 0x00ff0000, 0x0000ff00, 0xff0000ff, 0x26ff0002, 0x336eff10, 0xff77ffff,
+        0x00f00000, 0x0000f000, 0xf00000f0, 0x26f10002, 0x336ef310, 0xff77fff7, 0x00800000, 0x00000000,
+        0x10000000, 0x26310002, 0x336e7310, 0xff77fff7, 0x00800000, 0x00000000, 0x10000000, 0x26310002,
+        0x336e7310, 0xff77fff7, 0x00800000, 0x00000000, 0x10000000, 0x26310002, 0x336e7310, 0xff77fff7,
+        0x00000000, 0x00000000, 0xfffff700, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00000000, 0x00000000,
+        0xffff0200, 0x6effff26, 0xffeeffff, 0xffffffff, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x26fff002,
+        0xf36efff0, 0xfff7ffff, 0x00ff0000, 0x0000ff00, 0xff0000ff, 0x26ff0002, 0x336eff10, 0xff77ffff,
+        0x00f00000, 0x0000f000, 0xf00000f0, 0x26f10002, 0x336ef310, 0xff77fff7, 0x00800000, 0x00000000,
+        0x10000000, 0x26310002, 0x336e7310, 0xff77fff7, 0x00800000, 0x00000000, 0x10000000, 0x26310002,
+        0x336e7310, 0xff77fff7, 0x00800000, 0x00000000, 0x10000000, 0x26310002, 0x336e7310, 0xff77fff7,
+        0x00fffffe, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff, 0x00ffff84, 0x00000000,
+        0x00000000, 0x6effff24, 0xffeeffff, 0xffffffff, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x26fff000,
+        0xf36efff0, 0xfff7ffff, 0x00ff0000, 0x0000ff00, 0xff0000ff, 0x26ff0000, 0x336eff10, 0xff77ffff,
+        0x00f00000, 0x0000f000, 0xf00000f0, 0x26f10000, 0x336ef310, 0xff77fff7, 0x00800000, 0x00000000,
+        0x10000000, 0x26310000, 0x336e7310, 0xff77fff7, 0x00800000, 0x00000000, 0x10000000, 0x26310000,
+        0x336e7310, 0xff77fff7, 0x00800000, 0x00000000, 0x10000000, 0x26310000, 0x336e7310, 0xff77fff7,
+        0xfcfffffc, 0x0000ffff, 0x00000000, 0xff000000, 0xffffffff, 0xffffffff, 0x08ffff8c, 0x0000ffff,
+        0x00000000, 0x4a000000, 0xffeeffff, 0xffffffff, 0x00fff008, 0xf000fff0, 0xfff000ff, 0x02fff000,
+        0xf36efff0, 0xfff7ffff, 0x00ff0008, 0x0000ff00, 0xff0000ff, 0x02ff0000, 0x336eff10, 0xff77ffff,
+        0x00f00008, 0x0000f000, 0xf00000f0, 0x02f10000, 0x336ef310, 0xff77fff7, 0x00800008, 0x00000000,
+        0x10000000, 0x02310000, 0x336e7310, 0xff77fff7, 0x00800008, 0x00000000, 0x10000000, 0x02310000,
+        0x336e7310, 0xff77fff7, 0x00800008, 0x00000000, 0x10000000, 0x02310000, 0x336e7310, 0xff77fff7,
+        0xf8fffffc, 0xfff9ffff, 0x000000ff, 0x00000000, 0xffff0000, 0xffffffff, 0x08ffff8c, 0xff00ffff,
+        0x000000ff, 0x00000000, 0xffa60000, 0xffffffff, 0x00fff008, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0xf126fff0, 0xfff7ffff, 0x00ff0008, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x3126ff10, 0xff77ffff,
+        0x00f00008, 0x0000f000, 0xf00000f0, 0x00f10000, 0x3126f310, 0xff77fff7, 0x00800008, 0x00000000,
+        0x10000000, 0x00310000, 0x31267310, 0xff77fff7, 0x00800008, 0x00000000, 0x10000000, 0x00310000,
+        0x31267310, 0xff77fff7, 0x00800008, 0x00000000, 0x10000000, 0x00310000, 0x31267310, 0xff77fff7,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0x00000000, 0x00000000, 0xffffff00, 0x08ffff8c, 0xff00ffff,
+        0xffff00ff, 0x00000000, 0x00000000, 0xffff7f00, 0x00fff008, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0xf100fff0, 0xfff37fff, 0x00ff0008, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x3100ff10, 0xff737fff,
+        0x00f00008, 0x0000f000, 0xf00000f0, 0x00f10000, 0x3100f310, 0xff737ff7, 0x00800008, 0x00000000,
+        0x10000000, 0x00310000, 0x31007310, 0xff737ff7, 0x00800008, 0x00000000, 0x10000000, 0x00310000,
+        0x31007310, 0xff737ff7, 0x00800008, 0x00000000, 0x10000000, 0x00310000, 0x31007310, 0xff737ff7,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0x00fffff7, 0x00000000, 0x00000000, 0x08ffff88, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0x00000000, 0x00000000, 0x00fff008, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0xf100fff0, 0xfff311ff, 0x00ff0008, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x3100ff10, 0xff7311ff,
+        0x00f00008, 0x0000f000, 0xf00000f0, 0x00f10000, 0x3100f310, 0xff7311f7, 0x00800008, 0x00000000,
+        0x10000000, 0x00310000, 0x31007310, 0xff7311f7, 0x00800008, 0x00000000, 0x10000000, 0x00310000,
+        0x31007310, 0xff7311f7, 0x00800008, 0x00000000, 0x10000000, 0x00310000, 0x31007310, 0xff7311f7,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0x0000ffff, 0x00000000, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0x0000ffff, 0x00000000, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0xf100fff0, 0xfff311ff, 0x00ff0000, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x3100ff10, 0xff7311ff,
+        0x00f00000, 0x0000f000, 0xf00000f0, 0x00f10000, 0x3100f310, 0xff7311f7, 0x00800000, 0x00000000,
+        0x10000000, 0x00310000, 0x31007310, 0xff7311f7, 0x00800000, 0x00000000, 0x10000000, 0x00310000,
+        0x31007310, 0xff7311f7, 0x00800000, 0x00000000, 0x10000000, 0x00310000, 0x31007310, 0xff7311f7,
+        0x00000000, 0xfff20000, 0xfffff2ff, 0xfefffff6, 0xfffeffff, 0xfffffeff, 0x00000000, 0xff220000,
+        0xffff22ff, 0x7effff76, 0xfffeffff, 0xfffffeff, 0x00000000, 0xf0000000, 0xfff022ff, 0x66fff266,
+        0xffeefff6, 0xfffffeff, 0x00ff0000, 0x0000ff00, 0xff0002ff, 0x66ff0026, 0x37eeff12, 0xff7ffeff,
+        0x00f00000, 0x0000f000, 0xf00002f0, 0x66f10026, 0x37eef312, 0xff7ffef7, 0x00800000, 0x00000000,
+        0x10000200, 0x66310026, 0x37ee7312, 0xff7ffef7, 0x00800000, 0x00000000, 0x10000200, 0x66310026,
+        0x37ee7312, 0xff7ffef7, 0x0e80000e, 0x000e0000, 0x10000e00, 0x6e31002e, 0x37ee7312, 0xff7ffef7,
+        0x00000000, 0x00000000, 0xfffff500, 0xfdfffff5, 0xfffdffff, 0xfffffdff, 0x00000000, 0x00000000,
+        0xffff7500, 0xfdffff75, 0xfffdffff, 0xfffffdff, 0x00000000, 0x00000000, 0xfff02000, 0xecfff264,
+        0xffecfff6, 0xfffffdff, 0x00ff0000, 0x0000ff00, 0xff0000ff, 0x6cff0024, 0x37ecff12, 0xff7ffdff,
+        0x00f00000, 0x0000f000, 0xf00000f0, 0x6cf10024, 0x37ecf312, 0xff7ffdf7, 0x00800000, 0x00000000,
+        0x10000000, 0x6c310024, 0x37ec7312, 0xff7ffdf7, 0x00800000, 0x00000000, 0x10000000, 0x6c310024,
+        0x37ec7312, 0xff7ffdf7, 0x0c80000c, 0x000c0000, 0x10000c00, 0x6c31002c, 0x37ec7312, 0xff7ffdf7,
+        0x00fffffa, 0x00000000, 0x00000000, 0xfbfffffb, 0xfffbffff, 0xfffffbff, 0x00ffffea, 0x00000000,
+        0x00000000, 0xfbfffffb, 0xfffbffff, 0xfffffbff, 0x00fff848, 0x00000000, 0x00000000, 0xeafff242,
+        0xffeafff6, 0xfffffbff, 0x00ff0008, 0x0000ff00, 0xff0000ff, 0x6aff0002, 0x37eaff12, 0xff7ffbff,
+        0x00f00008, 0x0000f000, 0xf00000f0, 0x6af10002, 0x37eaf312, 0xff7ffbf7, 0x00800008, 0x00000000,
+        0x10000000, 0x6a310002, 0x37ea7312, 0xff7ffbf7, 0x00800008, 0x00000000, 0x10000000, 0x6a310002,
+        0x37ea7312, 0xff7ffbf7, 0x0a80000a, 0x000a0000, 0x10000a00, 0x6a31000a, 0x37ea7312, 0xff7ffbf7,
+        0xf4fffff4, 0x0000ffff, 0x00000000, 0xf7000000, 0xfff7ffff, 0xfffff7ff, 0xc4ffffc4, 0x0000ffff,
+        0x00000000, 0xf7000000, 0xfff7ffff, 0xfffff7ff, 0x80fff8c4, 0x0000fff0, 0x00000000, 0xa6000000,
+        0xffe6fff4, 0xfffff7ff, 0x00ff0084, 0x0000ff00, 0xff0000ff, 0x26ff0000, 0x37e6ff10, 0xff7ff7ff,
+        0x00f00084, 0x0000f000, 0xf00000f0, 0x26f10000, 0x37e6f310, 0xff7ff7f7, 0x00800084, 0x00000000,
+        0x10000000, 0x26310000, 0x37e67310, 0xff7ff7f7, 0x00800084, 0x00000000, 0x10000000, 0x26310000,
+        0x37e67310, 0xff7ff7f7, 0x06800086, 0x00060000, 0x10000600, 0x26310006, 0x37e67310, 0xff7ff7f7,
+        0xf8fffffc, 0xfff9ffff, 0x000000ff, 0x00000000, 0xffff0000, 0xffffffff, 0x88ffffcc, 0xff88ffff,
+        0x000000ff, 0x00000000, 0xffff0000, 0xffffffff, 0x88fff8cc, 0xf000fff0, 0x000000ff, 0x00000000,
+        0xfb6e0000, 0xffffffff, 0x08ff008c, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x336eff10, 0xff7fffff,
+        0x08f0008c, 0x0000f000, 0xf00000f0, 0x00f10000, 0x336ef310, 0xff7ffff7, 0x0880008c, 0x00000000,
+        0x10000000, 0x00310000, 0x336e7310, 0xff7ffff7, 0x0880008c, 0x00000000, 0x10000000, 0x00310000,
+        0x336e7310, 0xff7ffff7, 0x0e80008e, 0x000e0000, 0x10000e00, 0x0e31000e, 0x336e7310, 0xff7ffff7,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0x00000000, 0x00000000, 0xffffff00, 0x88ffff8c, 0xff00ffff,
+        0xffff00ff, 0x00000000, 0x00000000, 0xffffff00, 0x88fff888, 0xf000fff0, 0xfff000ff, 0x00000000,
+        0x00000000, 0xfff7ff00, 0x08ff0088, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x3100ff10, 0xff77ffff,
+        0x08f00088, 0x0000f000, 0xf00000f0, 0x00f10000, 0x3100f310, 0xff77fff7, 0x08800088, 0x00000000,
+        0x10000000, 0x00310000, 0x31007310, 0xff77fff7, 0x08800088, 0x00000000, 0x10000000, 0x00310000,
+        0x31007310, 0xff77fff7, 0x0c80008c, 0x000c0000, 0x10000c00, 0x0e31000c, 0x310e7310, 0xff77fff7,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0x00fffff7, 0x00000000, 0x00000000, 0x08ffff88, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0x00000000, 0x00000000, 0x00fff888, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0x00000000, 0x00000000, 0x00ff0088, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x3100ff10, 0xff7311ff,
+        0x00f00088, 0x0000f000, 0xf00000f0, 0x00f10000, 0x3100f310, 0xff7311f7, 0x00800088, 0x00000000,
+        0x10000000, 0x00310000, 0x31007310, 0xff7311f7, 0x00800088, 0x00000000, 0x10000000, 0x00310000,
+        0x31007310, 0xff7311f7, 0x08800088, 0x00080000, 0x10000800, 0x08310008, 0x310e7310, 0xff731ff7,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0x0000ffff, 0x00000000, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0x0000ffff, 0x00000000, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0x0000fff0, 0x00000000, 0x00ff0000, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x3100ff10, 0xff7311ff,
+        0x00f00000, 0x0000f000, 0xf00000f0, 0x00f10000, 0x3100f310, 0xff7311f7, 0x00800000, 0x00000000,
+        0x10000000, 0x00310000, 0x31007310, 0xff7311f7, 0x00800000, 0x00000000, 0x10000000, 0x00310000,
+        0x31007310, 0xff7311f7, 0x00800000, 0x00000000, 0x10000000, 0x00310000, 0x31007310, 0xff731ff7,
+        0xebffffef, 0xffe3ffff, 0xffffe3ff, 0xefffffe7, 0xffefffff, 0xffffefff, 0x00000000, 0xff220000,
+        0xffff22ff, 0x6fffff67, 0xffefffff, 0xffffefff, 0x00000000, 0xf2220000, 0xfff222ff, 0x67fff767,
+        0xffeffff7, 0xffffefff, 0x00000000, 0x00020000, 0xff0222ff, 0x66ff2666, 0xffeeff76, 0xffffefff,
+        0x00f0000e, 0x0002f000, 0xf00022f0, 0x66f10266, 0x7feef336, 0xffffeff7, 0x00800000, 0x00020000,
+        0x10002200, 0x66310266, 0x7fee7336, 0xffffeff7, 0x0680000e, 0x00060000, 0x10002600, 0x66310266,
+        0x7fee7336, 0xffffeff7, 0x0e80000e, 0x000e0000, 0x10002e00, 0x6e31026e, 0x7fee7336, 0xffffeff7,
+        0xdfffffdf, 0xffd7ffff, 0xffffd7ff, 0xdfffffd7, 0xffdfffff, 0xffffdfff, 0x00000000, 0x00000000,
+        0xffff5700, 0xdfffff57, 0xffdfffff, 0xffffdfff, 0x00000000, 0x00000000, 0xfff75700, 0xdffff757,
+        0xffdfffff, 0xffffdfff, 0x00000000, 0x00000000, 0xff020600, 0xceff2646, 0xffceff7e, 0xffffdfff,
+        0x0ef00000, 0x0000f000, 0xf00006f0, 0xcef10246, 0x7fcef336, 0xffffdff7, 0x00800000, 0x00000000,
+        0x10000600, 0xce310246, 0x7fce7336, 0xffffdff7, 0x0e80000e, 0x000e0000, 0x10000e00, 0xce31024e,
+        0x7fce7336, 0xffffdff7, 0x0e80000e, 0x000e0000, 0x10000e00, 0xce31024e, 0x7fce7336, 0xffffdff7,
+        0xbeffffbe, 0xffbfffff, 0xffffbfff, 0xbfffffbf, 0xffbfffff, 0xffffbfff, 0x00ffffae, 0x00000000,
+        0x00000000, 0xbfffffbf, 0xffbfffff, 0xffffbfff, 0x00fffeae, 0x00000000, 0x00000000, 0xbfffffbf,
+        0xffbfffff, 0xffffbfff, 0x00ff848e, 0x00000000, 0x00000000, 0xaeff242e, 0xffaeff7e, 0xffffbfff,
+        0x00f0008e, 0x000ef000, 0xf00000f0, 0xaef1002e, 0x7faef336, 0xffffbff7, 0x0080008e, 0x00000000,
+        0x10000000, 0xae31002e, 0x7fae7336, 0xffffbff7, 0x0e80008e, 0x000e0000, 0x10000e00, 0xae31002e,
+        0x7fae7336, 0xffffbff7, 0x0e80008e, 0x000e0000, 0x10000e00, 0xae31002e, 0x7fae7336, 0xffffbff7,
+        0x7cffff7c, 0xff7dffff, 0xffff7fff, 0x7fffff7f, 0xff7fffff, 0xffff7fff, 0x4cffff4c, 0x0000ffff,
+        0x00000000, 0x7f000000, 0xff7fffff, 0xffff7fff, 0x4cfffc4c, 0x0000fffc, 0x00000000, 0x7f000000,
+        0xff7fffff, 0xffff7fff, 0x0cff8c4c, 0x0000ff08, 0x00000000, 0x6e000000, 0xff6eff5a, 0xffff7fff,
+        0x0cf0084c, 0x0000f000, 0xf0000ef0, 0x6ef10000, 0x7f6ef312, 0xffff7ff7, 0x0c80084c, 0x00000000,
+        0x10000000, 0x6e310000, 0x7f6e7312, 0xffff7ff7, 0x0e80084e, 0x000e0000, 0x10000e00, 0x6e31000e,
+        0x7f6e7312, 0xffff7ff7, 0x0e80084e, 0x000e0000, 0x10000e00, 0x6e31000e, 0x7f6e7312, 0xffff7ff7,
+        0xf8fffffc, 0xfff9ffff, 0xfffffbff, 0xffffffff, 0xffffffff, 0xffffffff, 0x88ffffcc, 0xff88ffff,
+        0x000000ff, 0x00000000, 0xffff0000, 0xffffffff, 0x88fffccc, 0xf888fff8, 0x000000ff, 0x00000000,
+        0xffff0000, 0xffffffff, 0x88ff8ccc, 0x0008ff08, 0x000000ff, 0x00000000, 0xb7ee0000, 0xffffffff,
+        0x88f008cc, 0x0008f000, 0xf00000f0, 0x00f1000e, 0x37eef310, 0xfffffff7, 0x888008cc, 0x00080000,
+        0x10000000, 0x00310000, 0x37ee7310, 0xfffffff7, 0x8c8008cc, 0x000c0000, 0x10000c00, 0x0e31000e,
+        0x37ee7310, 0xfffffff7, 0x8e8008ce, 0x000e0000, 0x10000e00, 0x0e31000e, 0x37ee7310, 0xfffffff7,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x88ffff8c, 0xff00ffff,
+        0xffff00ff, 0x00000000, 0x00000000, 0xffffff00, 0x88fff888, 0xf000fff8, 0xfff000ff, 0x00000000,
+        0x00000000, 0xffffff00, 0x88ff8888, 0x0000ff08, 0xff0000ff, 0x00000000, 0x00000000, 0xff7fff00,
+        0x88f00888, 0x0000f000, 0xf00000f0, 0x0ef10000, 0x3100f310, 0xff7ffff7, 0x88800888, 0x00000000,
+        0x10000000, 0x00310000, 0x31007310, 0xff7ffff7, 0x88800888, 0x00080000, 0x10000800, 0x0e310008,
+        0x310e7310, 0xff7ffff7, 0x8c80088c, 0x000c0000, 0x10000c00, 0x0e31000c, 0x310e7310, 0xff7ffff7,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x08ffff88, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0x00000000, 0x00000000, 0x00fff888, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0x00000000, 0x00000000, 0x00ff8888, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x00000000, 0x00000000,
+        0x00f00888, 0x0000f000, 0xf00000f0, 0x00f10000, 0x310ef310, 0xff7311f7, 0x00800888, 0x00000000,
+        0x10000000, 0x00310000, 0x31007310, 0xff7311f7, 0x00800888, 0x00000000, 0x10000000, 0x00310000,
+        0x310e7310, 0xff731ff7, 0x08800888, 0x00080000, 0x10000800, 0x08310008, 0x310e7310, 0xff731ff7,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0x0000ffff, 0x00000000, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0x0000fff0, 0x00000000, 0x00ff0000, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x0000ff10, 0x00000000,
+        0x00f00000, 0x0000f000, 0xf00000f0, 0x00f10000, 0x3100f310, 0xff731ff7, 0x00800000, 0x00000000,
+        0x10000000, 0x00310000, 0x31007310, 0xff7313f7, 0x00800000, 0x00000000, 0x10000000, 0x00310000,
+        0x31007310, 0xff731ff7, 0x00800000, 0x00000000, 0x10000000, 0x00310000, 0x31007310, 0xff731ff7,
+        0xf8fffefc, 0xfef1fffe, 0xfffef3ff, 0xfffffef7, 0xfefffffe, 0xfffeffff, 0x38fffefc, 0xfe31fffe,
+        0xfffe33ff, 0x7ffffe77, 0xfefffffe, 0xfffeffff, 0x00000000, 0xf2200000, 0xfff222ff, 0x77fff677,
+        0xfefffff6, 0xfffeffff, 0x00000000, 0x22220000, 0xff2222ff, 0x77ff7677, 0xfeffff76, 0xfffeffff,
+        0x00000000, 0x00220000, 0xf02222f0, 0x66f36666, 0xfefff776, 0xfffeffff, 0x028000ee, 0x00220000,
+        0x10022200, 0x66332666, 0xfeff7776, 0xfffeffff, 0x0680000e, 0x00260000, 0x10022600, 0x66332666,
+        0xfeff7776, 0xfffeffff, 0x6e8800ee, 0x006e0000, 0x10026e00, 0x6e33266e, 0xfeff7776, 0xfffeffff,
+        0xf8fffdfc, 0xfdf1fffd, 0xfffdf3ff, 0xfffffdf7, 0xfdfffffd, 0xfffdffff, 0xf8fffdfc, 0xfd71fffd,
+        0xfffd73ff, 0xfffffd77, 0xfdfffffd, 0xfffdffff, 0x00000000, 0x00000000, 0xfff57300, 0xfffff577,
+        0xfdfffffd, 0xfffdffff, 0x00000000, 0x00000000, 0xff757700, 0xffff7577, 0xfdfffffd, 0xfffdffff,
+        0x00000000, 0x00000000, 0xf0206600, 0xeef36466, 0xfdfff7fc, 0xfffdffff, 0xee80000e, 0x00060000,
+        0x10006600, 0xee332466, 0xfdff777c, 0xfffdffff, 0x0e80000e, 0x000e0000, 0x10006e00, 0xee33246e,
+        0xfdff777c, 0xfffdffff, 0xee8800ee, 0x00ee0000, 0x1000ee00, 0xee3324ee, 0xfdff777c, 0xfffdffff,
+        0xf8fffbfc, 0xfbf1fffb, 0xfffbf3ff, 0xfffffbf7, 0xfbfffffb, 0xfffbffff, 0xe8fffbec, 0xfbf1fffb,
+        0xfffbf3ff, 0xfffffbf7, 0xfbfffffb, 0xfffbffff, 0x00fffaec, 0x00000000, 0x00000000, 0xfffffbf7,
+        0xfbfffffb, 0xfffbffff, 0x00ffeaee, 0x00000000, 0x00000000, 0xfffffbff, 0xfbfffffb, 0xfffbffff,
+        0x00f848ee, 0x00000000, 0x00000000, 0xeef342ee, 0xfbfff7fa, 0xfffbffff, 0x0e8808ee, 0x00ee0000,
+        0x10000e00, 0xee3302ee, 0xfbff777a, 0xfffbffff, 0x0e8808ee, 0x000e0000, 0x10000e00, 0xee3302ee,
+        0xfbff777a, 0xfffbffff, 0xee8808ee, 0x00ee0000, 0x1000ee00, 0xee3302ee, 0xfbff777a, 0xfffbffff,
+        0xf8fff7fc, 0xf7f1fff7, 0xfff7f3ff, 0xfffff7f7, 0xf7fffff7, 0xfff7ffff, 0xc8fff7cc, 0xf7c1fff7,
+        0xfff7f3ff, 0xfffff7f7, 0xf7fffff7, 0xfff7ffff, 0xc8fff4cc, 0x0000fff4, 0x00000000, 0xff000000,
+        0xf7fffff7, 0xfff7ffff, 0xccffc4cc, 0x0000ffc4, 0x00000000, 0xff000000, 0xf7fffff7, 0xfff7ffff,
+        0xccf8c4cc, 0x0000f080, 0x00000000, 0xee000000, 0xf7fff7b6, 0xfff7ffff, 0xcc8884cc, 0x000c0000,
+        0x1000ee00, 0xee31000e, 0xf7ff7736, 0xfff7ffff, 0xce8884ce, 0x000e0000, 0x10000e00, 0xee31000e,
+        0xf7ff7736, 0xfff7ffff, 0xee8884ee, 0x00ee0000, 0x1000ee00, 0xee3300ee, 0xf7ff7736, 0xfff7ffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x88ffffcc, 0xff80ffff,
+        0xffff82ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x88fffccc, 0xf880fff8, 0x000000ff, 0x00000000,
+        0xffff0000, 0xffffffff, 0x88ffcccc, 0x8888ff88, 0x000000ff, 0x00000000, 0xffff0000, 0xffffffff,
+        0x88f8cccc, 0x0088f088, 0x000000f0, 0x00000000, 0x7fff0000, 0xffffffff, 0x88888ccc, 0x00880008,
+        0x10000800, 0x0e3100ee, 0x7fff7310, 0xffffffff, 0x8c888ccc, 0x008c0008, 0x10000c00, 0x0e31000e,
+        0x7fff7310, 0xffffffff, 0xce888cce, 0x00ce0008, 0x1000ce00, 0xee3300ee, 0x7fff7730, 0xffffffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x88ffff8c, 0xff00ffff,
+        0xffff00ff, 0xffffff04, 0xffffffff, 0xffffffff, 0x88fff888, 0xf000fff8, 0xfff000ff, 0x00000000,
+        0x00000000, 0xffffff00, 0x88ff8888, 0x0000ff88, 0xff0000ff, 0x00000000, 0x00000000, 0xffffff00,
+        0x88f88888, 0x0000f088, 0xf00000f0, 0x00000000, 0x00000000, 0xffffff00, 0x88888888, 0x00000008,
+        0x10000000, 0xee310000, 0x310e7310, 0xfffffff7, 0x88888888, 0x00080008, 0x10000800, 0x0e310008,
+        0x310e7310, 0xfffffff7, 0x8c88888c, 0x008c0008, 0x10008c00, 0xee31008c, 0x71ee7710, 0xffffffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x08ffff88, 0xff00ffff,
+        0xffff00ff, 0x08ffff00, 0xffffffff, 0xffffffff, 0x00fff888, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0x00000000, 0x00000000, 0x00ff8888, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x00000000, 0x00000000,
+        0x00f88888, 0x0000f000, 0xf00000f0, 0x00f10000, 0x00000000, 0x00000000, 0x00888888, 0x00000000,
+        0x10000000, 0x00310000, 0x31ee7310, 0xff731ff7, 0x00888888, 0x00000000, 0x10000000, 0x00310000,
+        0x310e7310, 0xff731ff7, 0x08888888, 0x00080000, 0x10000800, 0x08310008, 0x31ee7310, 0xfff3ffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0xff00ffff, 0xffffffff, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0x0000fff0, 0x00000000, 0x00ff0000, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x0000ff10, 0x00000000,
+        0x00f00000, 0x0000f000, 0xf00000f0, 0x00f10000, 0x0000f310, 0x00000000, 0x00800000, 0x00000000,
+        0x10000000, 0x00310000, 0x31007310, 0xff73fff7, 0x00800000, 0x00000000, 0x10000000, 0x00310000,
+        0x31007310, 0xff733ff7, 0x00800000, 0x00000000, 0x10000000, 0x00310000, 0x31007310, 0xff73fff7,
+        0xf8ffeffc, 0xeff1ffef, 0xffeff3ff, 0xffffeff7, 0xefffffef, 0xffefffff, 0x08ffef0c, 0xef11ffef,
+        0xffef33ff, 0x7fffef77, 0xefffffef, 0xffefffff, 0x00ffef0c, 0xe300ffe3, 0xffe322ff, 0x77ffe777,
+        0xefffffe7, 0xffefffff, 0x00000000, 0x22000000, 0xff2222ff, 0x77ff6777, 0xefffff67, 0xffefffff,
+        0x00000000, 0x22220000, 0xf22222f2, 0x77f76777, 0xeffff767, 0xffefffff, 0x00000000, 0x02220000,
+        0x12222200, 0x77376666, 0xefff7767, 0xffefffff, 0x268c0eee, 0x02260000, 0x12222600, 0x77376666,
+        0xefff7767, 0xffefffff, 0x6e8c00ee, 0x026e0000, 0x12226e00, 0x7f37666e, 0xefff7767, 0xffefffff,
+        0xf8ffdffc, 0xdff1ffdf, 0xffdff3ff, 0xffffdff7, 0xdfffffdf, 0xffdfffff, 0x08ffdfcc, 0xdf11ffdf,
+        0xffdf33ff, 0xffffdf77, 0xdfffffdf, 0xffdfffff, 0x08ffdfcc, 0xd711ffdf, 0xffd733ff, 0xffffd777,
+        0xdfffffdf, 0xffdfffff, 0x00000000, 0x00000000, 0xff573300, 0xffff5777, 0xdfffffdf, 0xffdfffff,
+        0x00000000, 0x00000000, 0xf7577700, 0xfff75777, 0xdfffffdf, 0xffdfffff, 0x00000000, 0x00000000,
+        0x12066600, 0xff374666, 0xdfff7fdf, 0xffdfffff, 0xee8c80ee, 0x006e080e, 0x12066e00, 0xff37466e,
+        0xdfff7fdf, 0xffdfffff, 0xee8c80ee, 0x00ee0800, 0x1206ee00, 0xff3746ee, 0xdfff7fdf, 0xffdfffff,
+        0xf8ffbffc, 0xbff1ffbf, 0xffbff3ff, 0xffffbff7, 0xbfffffbf, 0xffbfffff, 0x88ffbfcc, 0xbf01ffbf,
+        0xffbf33ff, 0xffffbf77, 0xbfffffbf, 0xffbfffff, 0x88ffbecc, 0xbf01ffbe, 0xffbf33ff, 0xffffbf77,
+        0xbfffffbf, 0xffbfffff, 0x00ffaecc, 0x00000000, 0x00000000, 0xffffbf77, 0xbfffffbf, 0xffbfffff,
+        0x00feaeee, 0x00000000, 0x00000000, 0xffffbfff, 0xbfffffbf, 0xffbfffff, 0x008c8eee, 0x00000000,
+        0x00000000, 0xff372eee, 0xbfff7fbf, 0xffbfffff, 0xee8c8eee, 0x0eee0800, 0x1200ee00, 0xff372eee,
+        0xbfff7fbf, 0xffbfffff, 0xee8c8eee, 0x00ee0800, 0x1200ee00, 0xff372eee, 0xbfff7fbf, 0xffbfffff,
+        0xf8ff7ffc, 0x7ff1ff7f, 0xff7ff3ff, 0xffff7ff7, 0x7fffff7f, 0xff7fffff, 0x88ff7fcc, 0x7f01ff7f,
+        0xff7f03ff, 0xffff7f77, 0x7fffff7f, 0xff7fffff, 0x88ff7ccc, 0x7c00ff7c, 0xff7f03ff, 0xffff7f77,
+        0x7fffff7f, 0xff7fffff, 0x88ff4ccc, 0x0000ff4c, 0x00000000, 0xff000000, 0x7fffff7f, 0xff7fffff,
+        0xccfc4ccc, 0x0000fc4c, 0x00000000, 0xff000000, 0x7fffff7f, 0xff7fffff, 0xcc8c4ccc, 0x0000080c,
+        0x00000000, 0xff000000, 0x7fff7f7f, 0xff7fffff, 0xce8c4cce, 0x00ce080c, 0x120eee00, 0xff3720ee,
+        0x7fff7f7f, 0xff7fffff, 0xee8c4cee, 0x00ee080c, 0x1200ee00, 0xff3720ee, 0x7fff7f7f, 0xff7fffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x88ffffcc, 0xff00ffff,
+        0xffff02ff, 0xffffff07, 0xffffffff, 0xffffffff, 0x88fffccc, 0xf800fff8, 0xfff800ff, 0xffffff07,
+        0xffffffff, 0xffffffff, 0x88ffcccc, 0x8800ff88, 0x000000ff, 0x00000000, 0xffff0000, 0xffffffff,
+        0x88fccccc, 0x8888f888, 0x000000f8, 0x00000000, 0xffff0000, 0xffffffff, 0x888ccccc, 0x08880888,
+        0x00000000, 0x00000000, 0xffff0000, 0xffffffff, 0x8c8ccccc, 0x088c0888, 0x10008c00, 0xee370eee,
+        0xffff7f70, 0xffffffff, 0xce8cccce, 0x08ce0888, 0x1000ce00, 0xee3700ee, 0xffff7f70, 0xffffffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x88ffff8c, 0xff00ffff,
+        0xffff00ff, 0x0fffff04, 0xffffffff, 0xffffffff, 0x88fff888, 0xf000fff8, 0xfff000ff, 0x0ffff000,
+        0xffffffff, 0xffffffff, 0x88ff8888, 0x0000ff88, 0xff0000ff, 0x00000000, 0x00000000, 0xffffff00,
+        0x88f88888, 0x0000f888, 0xf00000f0, 0x00000000, 0x00000000, 0xffffff00, 0x88888888, 0x00000888,
+        0x10000000, 0x00000000, 0x00000000, 0xffffff00, 0x88888888, 0x00080888, 0x10000800, 0xee310008,
+        0xf1ee7f1e, 0xffffffff, 0x8c88888c, 0x008c0888, 0x10008c00, 0xee31008c, 0xf1ee7f10, 0xffffffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x08ffff88, 0xff00ffff,
+        0xffff00ff, 0x08ffff00, 0xff0fffff, 0xffffffff, 0x00fff888, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0xff0ffff0, 0xffffffff, 0x00ff8888, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x00000000, 0x00000000,
+        0x00f88888, 0x0000f000, 0xf00000f0, 0x00f10000, 0x00000000, 0x00000000, 0x00888888, 0x00000000,
+        0x10000000, 0x00310000, 0x00000000, 0x00000000, 0x00888888, 0x00000000, 0x10000000, 0x00310000,
+        0x3fee7310, 0xfff3ffff, 0x08888888, 0x00080000, 0x10000800, 0x08310008, 0x33ee7310, 0xfff3ffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0xff00ffff, 0xffff1fff, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0xf100fff0, 0xffff1fff, 0x00ff0000, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x0000ff10, 0x00000000,
+        0x00f00000, 0x0000f000, 0xf00000f0, 0x00f10000, 0x0000f310, 0x00000000, 0x00800000, 0x00000000,
+        0x10000000, 0x00310000, 0x00007310, 0x00000000, 0x00800000, 0x00000000, 0x10000000, 0x00310000,
+        0x31007310, 0xff7ffff7, 0x00800000, 0x00000000, 0x10000000, 0x00310000, 0x31007310, 0xff77fff7,
+        0xf8fefffc, 0xfff1feff, 0xfefff3fe, 0xfffefff7, 0xfffffeff, 0xfefffffe, 0x08feff0c, 0xff01feff,
+        0xfeff13fe, 0x7ffeff37, 0xfffffeff, 0xfefffffe, 0x00fef000, 0xf100fef0, 0xfef300fe, 0x77fef733,
+        0xfffffef7, 0xfefffffe, 0x00fef000, 0x3000fe30, 0xfe3200fe, 0x77fe7733, 0xfffffe77, 0xfefffffe,
+        0x00000000, 0x20000000, 0xf22220f2, 0x77f67773, 0xfffff677, 0xfefffffe, 0x00000000, 0x22220000,
+        0x32222232, 0x77767777, 0xffff7677, 0xfefffffe, 0x00000000, 0x22220000, 0x32222212, 0x77767777,
+        0xffff7677, 0xfefffffe, 0x6e8eeeee, 0x226e2022, 0x32226e12, 0x7f76777f, 0xffff7677, 0xfefffffe,
+        0xf8fdfffc, 0xfff1fdff, 0xfdfff3fd, 0xfffdfff7, 0xfffffdff, 0xfdfffffd, 0x08fdff8c, 0xff01fdff,
+        0xfdff13fd, 0x7ffdff37, 0xfffffdff, 0xfdfffffd, 0x00fdfc00, 0xf100fdf0, 0xfdf311fd, 0x77fdf733,
+        0xfffffdff, 0xfdfffffd, 0x00fdfc00, 0x7100fdf0, 0xfd7311fd, 0x77fd7733, 0xfffffdff, 0xfdfffffd,
+        0x00000000, 0x00000000, 0xf5733100, 0xf7f57773, 0xfffffdff, 0xfdfffffd, 0x00000000, 0x00000000,
+        0x75777700, 0xff757777, 0xfffffdff, 0xfdfffffd, 0x00000000, 0x00000000, 0x35666600, 0xff757777,
+        0xfffffdff, 0xfdfffffd, 0xeea8eeee, 0x66ee8cee, 0x3566ee70, 0xff7577ff, 0xfffffdff, 0xfdfffffd,
+        0xf8fbfffc, 0xfff1fbff, 0xfbfff3fb, 0xfffbfff7, 0xfffffbff, 0xfbfffffb, 0x08fbff8c, 0xff01fbff,
+        0xfbff13fb, 0x7ffbff37, 0xfffffbff, 0xfbfffffb, 0x00fbfc88, 0xf000fbf8, 0xfbf300fb, 0x77fbf733,
+        0xfffffbff, 0xfbfffffb, 0x00fbec88, 0xf000fbe8, 0xfbf300fb, 0x77fbf733, 0xfffffbff, 0xfbfffffb,
+        0x00faecc8, 0x00000000, 0x00000000, 0xf7fbf773, 0xfffffbff, 0xfbfffffb, 0x00eaeeee, 0x00000000,
+        0x00000000, 0xfffbffff, 0xfffffbff, 0xfbfffffb, 0x00c8eeee, 0x00000000, 0x00000000, 0xff7bffff,
+        0xfffffbff, 0xfbfffffb, 0xeecaeeee, 0xeeeee0ee, 0xf1eeee1a, 0xff7bffff, 0xfffffbff, 0xfbfffffb,
+        0xf8f7fffc, 0xfff1f7ff, 0xf7fff3f7, 0xfff7fff7, 0xfffff7ff, 0xf7fffff7, 0x08f7ff8c, 0xff01f7ff,
+        0xf7ff03f7, 0x7ff7ff37, 0xfffff7ff, 0xf7fffff7, 0x00f7fc88, 0xf000f7f8, 0xf7f000f7, 0x77f7f700,
+        0xfffff7ff, 0xf7fffff7, 0x00f7cc88, 0xc000f7c8, 0xf7f000f7, 0x77f7f700, 0xfffff7ff, 0xf7fffff7,
+        0x80f4ccc8, 0x0000f4c8, 0x00000000, 0xf7000000, 0xfffff7ff, 0xf7fffff7, 0xccc4cccc, 0x0000c4cc,
+        0x00000000, 0xff000000, 0xfffff7ff, 0xf7fffff7, 0xccc4cccc, 0x000084cc, 0x00000000, 0xff000000,
+        0xfffff7ff, 0xf7fffff7, 0xeec4ccee, 0xccee84cc, 0x36eeeec0, 0xfff3eeee, 0xfffff7ff, 0xf7fffff7,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x08ffff8c, 0xff00ffff,
+        0xffff02ff, 0x7fffff07, 0xffffffff, 0xffffffff, 0x00fffc88, 0xf000fff8, 0xfff000ff, 0x00fff000,
+        0xffffffff, 0xffffffff, 0x00ffcc88, 0x8000ff88, 0xff8000ff, 0x00fff000, 0xffffffff, 0xffffffff,
+        0x80fcccc8, 0x8000f888, 0x000000f8, 0x00000000, 0xffff0000, 0xffffffff, 0x88cccccc, 0x88888888,
+        0x00000088, 0x00000000, 0xffff0000, 0xffffffff, 0x88cccccc, 0x88888888, 0x00000008, 0x00000000,
+        0xffff0000, 0xffffffff, 0xceccccce, 0x88ce8888, 0x9088ce08, 0xee7feeee, 0xfffff7fe, 0xffffffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x08ffff8c, 0xff00ffff,
+        0xffff00ff, 0x0fffff04, 0xffffffff, 0xffffffff, 0x00fff888, 0xf000fff8, 0xfff000ff, 0x00fff000,
+        0xff00fff0, 0xffffffff, 0x00ff8888, 0x0000ff88, 0xff0000ff, 0x00ff0000, 0xff00fff0, 0xffffffff,
+        0x80f88888, 0x0000f888, 0xf00000f0, 0x00000000, 0x00000000, 0xffffff00, 0x88888888, 0x00008888,
+        0x10000000, 0x00000000, 0x00000000, 0xffffff00, 0x88888888, 0x00008888, 0x10000000, 0x00000000,
+        0x00000000, 0xffffff00, 0x8c88888c, 0x008c8888, 0x10008c00, 0xee31008c, 0xffeefffe, 0xffffffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x08ffff88, 0xff00ffff,
+        0xffff00ff, 0x08ffff00, 0xff0fffff, 0xffffffff, 0x00fff888, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0xf100fff0, 0xffff11ff, 0x00ff8888, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0xf100ff10, 0xffff11ff,
+        0x00f88888, 0x0000f000, 0xf00000f0, 0x00f10000, 0x00000000, 0x00000000, 0x00888888, 0x00000000,
+        0x10000000, 0x00310000, 0x00000000, 0x00000000, 0x00888888, 0x00000000, 0x10000000, 0x00310000,
+        0x00000000, 0x00000000, 0x08888888, 0x00080000, 0x10000800, 0x08310008, 0xffee7310, 0xffffffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0xff00ffff, 0xffff1fff, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0xf100fff0, 0xfff311ff, 0x00ff0000, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x3100ff10, 0xfff311ff,
+        0x00f00000, 0x0000f000, 0xf00000f0, 0x00f10000, 0x0000f310, 0x00000000, 0x00800000, 0x00000000,
+        0x10000000, 0x00310000, 0x00007310, 0x00000000, 0x00800000, 0x00000000, 0x10000000, 0x00310000,
+        0x00007310, 0x00000000, 0x00800000, 0x00000000, 0x10000000, 0x00310000, 0x31007310, 0xfffffff7,
+        0xf8effffc, 0xfff1efff, 0xeffff3ef, 0xffeffff7, 0xffffefff, 0xefffffef, 0x00efff00, 0xff00efff,
+        0xefff00ef, 0x33efff11, 0xff77efff, 0xefffffef, 0x00eff000, 0xf000eff0, 0xeff100ef, 0x33eff311,
+        0xff77eff7, 0xefffffef, 0x00ef0000, 0x1000ef00, 0xef3000ef, 0x33ef7311, 0xff77ef77, 0xefffffef,
+        0x00ef0000, 0x0000e300, 0xe32000e3, 0x33e77311, 0xff77e777, 0xefffffef, 0x00000000, 0x00000000,
+        0x22220022, 0x73677731, 0xfff76777, 0xefffffef, 0x00000000, 0x22220000, 0x22222222, 0x77677777,
+        0xffff6777, 0xefffffef, 0x00000000, 0x22220000, 0x22222222, 0x77677777, 0xffff6777, 0xefffffef,
+        0xf8dffffc, 0xfff1dfff, 0xdffff3df, 0xffdffff7, 0xffffdfff, 0xdfffffdf, 0x00dfff00, 0xff00dfff,
+        0xdfff00df, 0x33dfff11, 0xff77dfff, 0xdfffffdf, 0x00dff800, 0xf000dff0, 0xdff100df, 0x33dff311,
+        0xff77dff7, 0xdfffffdf, 0x00dfc000, 0x1000df00, 0xdf3100df, 0x33df7311, 0xff77dff7, 0xdfffffdf,
+        0x00dfc000, 0x1000df00, 0xd73100d7, 0x33d77311, 0xff77dff7, 0xdfffffdf, 0x00000000, 0x00000000,
+        0x57330000, 0x73577731, 0xfff7dfff, 0xdfffffdf, 0x00000000, 0x00000000, 0x57777700, 0xff577777,
+        0xffffdfff, 0xdfffffdf, 0x00000000, 0x00000000, 0x57777700, 0xff577777, 0xffffdfff, 0xdfffffdf,
+        0xf8bffffc, 0xfff1bfff, 0xbffff3bf, 0xffbffff7, 0xffffbfff, 0xbfffffbf, 0x00bfff00, 0xff00bfff,
+        0xbfff00bf, 0x33bfff11, 0xff77bfff, 0xbfffffbf, 0x00bff800, 0xf000bff0, 0xbff100bf, 0x33bff311,
+        0xff77bff7, 0xbfffffbf, 0x00bfc800, 0x0000bf80, 0xbf3000bf, 0x33bf7311, 0xff77bff7, 0xbfffffbf,
+        0x00bec800, 0x0000be80, 0xbf3000bf, 0x33bf7311, 0xff77bff7, 0xbfffffbf, 0x00aecc80, 0x00000000,
+        0x00000000, 0x73bf7731, 0xfff7bfff, 0xbfffffbf, 0x00aeeeee, 0x00000000, 0x00000000, 0xffbfffff,
+        0xffffbfff, 0xbfffffbf, 0x00aceeee, 0x00000000, 0x00000000, 0xffbfffff, 0xffffbfff, 0xbfffffbf,
+        0xf87ffffc, 0xfff17fff, 0x7ffff37f, 0xff7ffff7, 0xffff7fff, 0x7fffff7f, 0x007fff00, 0xff007fff,
+        0x7fff007f, 0x337fff00, 0xff777fff, 0x7fffff7f, 0x007ff800, 0xf0007ff0, 0x7ff0007f, 0x337ff300,
+        0xff777ff7, 0x7fffff7f, 0x007fc800, 0x00007f80, 0x7f00007f, 0x337f7000, 0xff777ff7, 0x7fffff7f,
+        0x007cc800, 0x00007c80, 0x7f00007c, 0x337f7000, 0xff777ff7, 0x7fffff7f, 0x004ccc80, 0x00004c88,
+        0x00000000, 0x73000000, 0xfff77fff, 0x7fffff7f, 0xcc4ccccc, 0x00004ccc, 0x00000000, 0xff000000,
+        0xffff7fff, 0x7fffff7f, 0xcc4ccccc, 0x00004ccc, 0x00000000, 0xff000000, 0xffff7fff, 0x7fffff7f,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0xff77ffff, 0xffffffff, 0x00fff800, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0xff77fff7, 0xffffffff, 0x00ffc800, 0x0000ff80, 0xff0000ff, 0x00ff0000, 0xff77fff0, 0xffffffff,
+        0x00fcc800, 0x0000f880, 0xf80000f8, 0x00ff0000, 0xff77fff0, 0xffffffff, 0x00cccc80, 0x00008888,
+        0x00000088, 0x00000000, 0xfff70000, 0xffffffff, 0x88cccccc, 0x88888888, 0x00000088, 0x00000000,
+        0xffff0000, 0xffffffff, 0x88cccccc, 0x88888888, 0x00000088, 0x00000000, 0xffff0000, 0xffffffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0xff00ffff, 0xffffffff, 0x00fff800, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0xff00fff0, 0xffffffff, 0x00ff8800, 0x0000ff80, 0xff0000ff, 0x00ff0000, 0xf100ff10, 0xffffffff,
+        0x00f88800, 0x0000f880, 0xf00000f0, 0x00f10000, 0xf100ff10, 0xffffffff, 0x00888880, 0x00008888,
+        0x10000000, 0x00000000, 0x00000000, 0xffffff00, 0x88888888, 0x00008888, 0x10000000, 0x00000000,
+        0x00000000, 0xffffff00, 0x88888888, 0x00008888, 0x10000000, 0x00000000, 0x00000000, 0xffffff00,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0xff00ffff, 0xffff11ff, 0x00fff800, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0xf100fff0, 0xffff11ff, 0x00ff8800, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x3100ff10, 0xfff311ff,
+        0x00f88800, 0x0000f000, 0xf00000f0, 0x00f10000, 0x3100f310, 0xfff311ff, 0x00888880, 0x00000000,
+        0x10000000, 0x00310000, 0x00000000, 0x00000000, 0x00888888, 0x00000000, 0x10000000, 0x00310000,
+        0x00000000, 0x00000000, 0x00888888, 0x00000000, 0x10000000, 0x00310000, 0x00000000, 0x00000000,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0xff00ffff, 0xffff11ff, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0xf100fff0, 0xfff311ff, 0x00ff0000, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x3100ff10, 0xff7311ff,
+        0x00f00000, 0x0000f000, 0xf00000f0, 0x00f10000, 0x3100f310, 0xff7311f7, 0x00800000, 0x00000000,
+        0x10000000, 0x00310000, 0x00007310, 0x00000000, 0x00800000, 0x00000000, 0x10000000, 0x00310000,
+        0x00007310, 0x00000000, 0x00800000, 0x00000000, 0x10000000, 0x00310000, 0x00007310, 0x00000000,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x11ffff00, 0xff33ffff, 0xffff77ff, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x11fff100,
+        0xf733fff3, 0xffff77ff, 0x00ff0000, 0x0000ff00, 0xff1000ff, 0x11ff3100, 0xf733ff73, 0xffff77ff,
+        0x00f00000, 0x0000f000, 0xf30000f0, 0x11f73100, 0xf733f773, 0xffff77ff, 0x00f00000, 0x00002000,
+        0x22000020, 0x11773100, 0xf7337773, 0xffff77ff, 0x00000000, 0x00000000, 0x22200020, 0x31777300,
+        0xff737777, 0xfffff7ff, 0x00000000, 0x22220000, 0x22222222, 0x77777777, 0xffff7777, 0xffffffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x11ffff00, 0xff33ffff, 0xffff77ff, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x11fff100,
+        0xf733fff3, 0xffff77ff, 0x00ff8000, 0x0000ff00, 0xff1000ff, 0x11ff3100, 0xf733ff73, 0xffff77ff,
+        0x00fc0000, 0x0000f000, 0xf31000f1, 0x11f73100, 0xf733ff73, 0xffff77ff, 0x00fc0000, 0x0000f000,
+        0x73100071, 0x11773100, 0xf733ff73, 0xffff77ff, 0x00000000, 0x00000000, 0x73300000, 0x31777300,
+        0xff73fff7, 0xfffff7ff, 0x00000000, 0x00000000, 0x77777700, 0xff777777, 0xffffffff, 0xffffffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x11ffff00, 0xff33ffff, 0xffff77ff, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x11fff100,
+        0xf733fff3, 0xffff77ff, 0x00ff8000, 0x0000ff00, 0xff1000ff, 0x11ff3100, 0xf733ff73, 0xffff77ff,
+        0x00fc8000, 0x0000f800, 0xf30000f0, 0x11f73100, 0xf733ff73, 0xffff77ff, 0x00ec8000, 0x0000e800,
+        0xf30000f0, 0x11f73100, 0xf733ff73, 0xffff77ff, 0x00ecc800, 0x00000000, 0x00000000, 0x31f77300,
+        0xff73fff7, 0xfffff7ff, 0x00eceeee, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffffffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x11ffff00, 0xff33ffff, 0xffff77ff, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x11fff000,
+        0xf733fff3, 0xffff77ff, 0x00ff8000, 0x0000ff00, 0xff0000ff, 0x11ff3000, 0xf733ff73, 0xffff77ff,
+        0x00fc8000, 0x0000f800, 0xf00000f0, 0x11f70000, 0xf733ff73, 0xffff77ff, 0x00cc8000, 0x0000c800,
+        0xf00000c0, 0x11f70000, 0xf733ff73, 0xffff77ff, 0x00ccc800, 0x0000c880, 0x00000000, 0x31000000,
+        0xff73fff7, 0xfffff7ff, 0xcccccccc, 0x0000cccc, 0x00000000, 0xff000000, 0xffffffff, 0xffffffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0xff33ffff, 0xffff77ff, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0xf733fff0, 0xffff77ff, 0x00ff8000, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0xf733ff70, 0xffff77ff,
+        0x00fc8000, 0x0000f800, 0xf00000f0, 0x00f10000, 0xf733ff10, 0xffff77ff, 0x00cc8000, 0x00008800,
+        0x90000080, 0x00f10000, 0xf733ff10, 0xffff77ff, 0x00ccc800, 0x00008880, 0x00000080, 0x00000000,
+        0xff730000, 0xfffff7ff, 0x88cccccc, 0x88888888, 0x00000088, 0x00000000, 0xffff0000, 0xffffffff,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0xff00ffff, 0xffff77ff, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0xf100fff0, 0xffff77ff, 0x00ff8000, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0xf100ff10, 0xffff77ff,
+        0x00f88000, 0x0000f800, 0xf00000f0, 0x00f10000, 0x3100f310, 0xffff77ff, 0x00888000, 0x00008800,
+        0x10000000, 0x00310000, 0x3100f310, 0xffff77ff, 0x00888800, 0x00008880, 0x10000000, 0x00000000,
+        0x00000000, 0xfffff700, 0x88888888, 0x00008888, 0x10000000, 0x00000000, 0x00000000, 0xffffff00,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0xff00ffff, 0xffff11ff, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0xf100fff0, 0xfff311ff, 0x00ff8000, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x3100ff10, 0xfff311ff,
+        0x00f88000, 0x0000f000, 0xf00000f0, 0x00f10000, 0x3100f310, 0xff7311f7, 0x00888000, 0x00000000,
+        0x10000000, 0x00310000, 0x31007310, 0xff7311f7, 0x00888800, 0x00000000, 0x10000000, 0x00310000,
+        0x00000000, 0x00000000, 0x00888888, 0x00000000, 0x10000000, 0x00310000, 0x00000000, 0x00000000,
+        0xf8fffffc, 0xfff1ffff, 0xfffff3ff, 0xfffffff7, 0xffffffff, 0xffffffff, 0x00ffff00, 0xff00ffff,
+        0xffff00ff, 0x00ffff00, 0xff00ffff, 0xffff11ff, 0x00fff000, 0xf000fff0, 0xfff000ff, 0x00fff000,
+        0xf100fff0, 0xfff311ff, 0x00ff0000, 0x0000ff00, 0xff0000ff, 0x00ff0000, 0x3100ff10, 0xff7311ff,
+        0x00f00000, 0x0000f000, 0xf00000f0, 0x00f10000, 0x3100f310, 0xff7311f7, 0x00800000, 0x00000000,
+        0x10000000, 0x00310000, 0x31007310, 0xff7311f7, 0x00800000, 0x00000000, 0x10000000, 0x00310000,
+        0x00007310, 0x00000000, 0x00800000, 0x00000000, 0x10000000, 0x00310000, 0x00007310, 0x00000000};
+    // clang-format on
+} // namespace Tablebase
+
+#endif // KPK_BITBASE_HPP
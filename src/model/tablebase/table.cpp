@@ -0,0 +1,275 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+#include "model/tablebase/tablebase.hpp"
+
+namespace Tablebase {
+    namespace {
+        constexpr std::string_view LETTERS = "KQRBNP";
+        constexpr std::size_t NAME_SIZE = 16;
+        constexpr std::size_t HEADER_SIZE = 4 + 4 + NAME_SIZE;
+
+        Pieces::Types pieceType(char letter) {
+            switch (letter) {
+            case 'K':
+                return Pieces::Types::KING;
+            case 'Q':
+                return Pieces::Types::QUEEN;
+            case 'R':
+                return Pieces::Types::ROOK;
+            case 'B':
+                return Pieces::Types::BISHOP;
+            case 'N':
+                return Pieces::Types::KNIGHT;
+            case 'P':
+                return Pieces::Types::PAWN;
+            default:
+                return Pieces::Types::UNDEFINED;
+            }
+        }
+
+        struct Placed {
+            int color;
+            int type;
+            int square;
+        };
+
+        /**
+         * @brief Material name and pieces in material order of a board
+         */
+        std::string describe(const Game::Board &board, std::vector<Placed> &placed) {
+            Position captured;
+            placed.clear();
+            for (auto *piece : board.pieces()) {
+                Position position = piece->position();
+                if (position == captured) continue;
+
+                placed.push_back({board.color(piece), piece->type().index(),
+                                  position.row() * 8 + position.column()});
+            }
+            std::stable_sort(placed.begin(), placed.end(), [](const Placed &a, const Placed &b) {
+                return a.color != b.color ? a.color < b.color : a.type < b.type;
+            });
+            std::string name;
+            for (std::size_t i = 0; i < placed.size(); ++i) {
+                if (i > 0 && placed[i].color != placed[i - 1].color) name += 'v';
+                name += LETTERS[placed[i].type];
+            }
+            return name;
+        }
+    } // namespace
+
+    Material::Material(std::string_view name)
+        : _types()
+        , _colors() {
+        auto invalid = [&name](const std::string &reason) {
+            return std::runtime_error("Invalid material " + reason + ": material='" +
+                                      std::string(name) + "'");
+        };
+        auto separator = name.find('v');
+        if (separator == std::string_view::npos) throw invalid("separator");
+
+        std::string_view sides[] = {name.substr(0, separator), name.substr(separator + 1)};
+        for (int color = 0; color < 2; ++color) {
+            if (sides[color].empty() || sides[color][0] != 'K') throw invalid("king");
+
+            int previous = 0;
+            for (std::size_t i = 0; i < sides[color].size(); ++i) {
+                auto type = pieceType(sides[color][i]);
+                if (type == Pieces::Types::UNDEFINED || (i > 0 && type == Pieces::Types::KING) ||
+                    type.index() < previous) {
+                    throw invalid("pieces");
+                }
+                previous = type.index();
+                this->_types.push_back(type);
+                this->_colors.push_back(color);
+            }
+        }
+        if (this->nPieces() > MAX_PIECES) throw invalid("size");
+    }
+
+    std::string Material::name() const {
+        std::string name;
+        for (int i = 0; i < this->nPieces(); ++i) {
+            if (i > 0 && this->_colors[i] != this->_colors[i - 1]) name += 'v';
+            name += LETTERS[this->_types[i].index()];
+        }
+        return name;
+    }
+
+    int Material::nPieces() const { return static_cast<int>(this->_types.size()); }
+
+    Pieces::Types Material::type(int piece) const { return this->_types[piece]; }
+
+    int Material::color(int piece) const { return this->_colors[piece]; }
+
+    std::uint64_t Material::size() const { return std::uint64_t(2) << (6 * this->nPieces()); }
+
+    Table::Table()
+        : _material("KvK")
+        , _file()
+        , _data() {}
+
+    Table::Table(const std::string &path)
+        : Table() {
+        this->open(path);
+    }
+
+    Table::Table(const Material &material, std::vector<char> data)
+        : _material(material)
+        , _file()
+        , _data(std::move(data)) {}
+
+    void Table::open(const std::string &path) {
+        this->_file.open(path);
+        this->_data.clear();
+        auto invalid = [&path](const std::string &reason) {
+            return std::runtime_error("Invalid tablebase " + reason + ": path='" + path + "'");
+        };
+        const char *data = this->_file.data();
+        std::size_t size = this->_file.size();
+        if (size < HEADER_SIZE || std::string_view(data, 4) != MAGIC) throw invalid("magic");
+
+        std::uint32_t version = 0;
+        std::copy_n(data + 4, sizeof(version), reinterpret_cast<char *>(&version));
+        if (version != VERSION) throw invalid("version");
+
+        std::string_view name(data + 8, NAME_SIZE);
+        this->_material = Material(name.substr(0, name.find('\0')));
+        std::uint64_t positions = this->_material.size();
+        if (size != HEADER_SIZE + positions / 4 + positions) throw invalid("size");
+    }
+
+    void Table::write(const std::string &path) const {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        std::string name = this->_material.name();
+        name.resize(NAME_SIZE, '\0');
+        file.write(MAGIC.data(), static_cast<std::streamsize>(MAGIC.size()));
+        file.write(reinterpret_cast<const char *>(&VERSION), sizeof(VERSION));
+        file.write(name.data(), static_cast<std::streamsize>(name.size()));
+        std::uint64_t positions = this->_material.size();
+        file.write(this->data(), static_cast<std::streamsize>(positions / 4 + positions));
+        if (!file) throw std::runtime_error("Cannot write tablebase: path='" + path + "'");
+    }
+
+    const Material &Table::material() const { return this->_material; }
+
+    Result Table::probe(std::uint64_t index) const {
+        std::uint64_t positions = this->_material.size();
+        if (index >= positions) return {WDL::INVALID, 0};
+
+        const char *data = this->data();
+        auto wdl = static_cast<WDL>((static_cast<std::uint8_t>(data[index / 4]) >> (2 * (index % 4))) & 3);
+        int dtm = static_cast<std::uint8_t>(data[positions / 4 + index]);
+        return {wdl, dtm};
+    }
+
+    const char *Table::data() const {
+        return this->_file.isOpen() ? this->_file.data() + HEADER_SIZE : this->_data.data();
+    }
+
+    Tablebases::Tablebases()
+        : _tables()
+        , _maxPieces(0) {}
+
+    void Tablebases::add(Table table) {
+        this->_maxPieces = std::max(this->_maxPieces, table.material().nPieces());
+        auto name = table.material().name();
+        this->_tables.insert_or_assign(name, std::move(table));
+    }
+
+    void Tablebases::load(const std::string &directory) {
+        for (auto &entry : std::filesystem::directory_iterator(directory)) {
+            if (entry.path().extension() == ".tb") this->add(Table(entry.path().string()));
+        }
+    }
+
+    bool Tablebases::probe(const Game::Board &board, Result &result) const {
+        if (this->_tables.empty()) return false;
+
+        int nPieces = 0;
+        Position captured;
+        for (auto *piece : board.pieces()) nPieces += piece->position() != captured;
+        if (nPieces > this->_maxPieces) return false;
+
+        std::vector<Placed> placed;
+        auto name = describe(board, placed);
+        int side = board.color(board.turn());
+        auto table = this->_tables.find(name);
+        if (table == this->_tables.end()) {
+            // Swap the colors and mirror the rows
+            for (auto &piece : placed) {
+                piece.color = 1 - piece.color;
+                piece.square ^= 56;
+            }
+            std::stable_sort(placed.begin(), placed.end(), [](const Placed &a, const Placed &b) {
+                return a.color != b.color ? a.color < b.color : a.type < b.type;
+            });
+            auto separator = name.find('v', 1);
+            name = name.substr(separator + 1) + 'v' + name.substr(0, separator);
+            side = 1 - side;
+            table = this->_tables.find(name);
+            if (table == this->_tables.end()) return false;
+        }
+
+        std::uint64_t index = side;
+        for (auto &piece : placed) index = index * 64 + piece.square;
+        result = table->second.probe(index);
+        return result.wdl != WDL::INVALID;
+    }
+
+    std::size_t Tablebases::size() const { return this->_tables.size(); }
+
+    std::size_t verify(const Table &table, const Tablebases &tablebases, std::size_t step) {
+        auto &material = table.material();
+        Pieces::Player first("White"), second("Black");
+        Game::Board board(8, 8);
+        std::size_t nErrors = 0;
+        int nPieces = material.nPieces();
+        for (std::uint64_t index = 0; index < material.size(); index += std::max<std::size_t>(step, 1)) {
+            auto expected = table.probe(index);
+            if (expected.wdl == WDL::INVALID) continue;
+
+            char squares[64];
+            std::fill(std::begin(squares), std::end(squares), '1');
+            std::uint64_t rest = index;
+            for (int piece = nPieces - 1; piece >= 0; --piece, rest /= 64) {
+                char letter = LETTERS[material.type(piece).index()];
+                squares[rest % 64] = material.color(piece) == 0 ? letter : static_cast<char>(letter - 'A' + 'a');
+            }
+            std::string fen;
+            for (int row = 7; row >= 0; --row) {
+                fen.append(squares + row * 8, 8);
+                if (row > 0) fen += '/';
+            }
+            fen += (rest == 0) ? " w - - 0 1" : " b - - 0 1";
+            board.initialize(first, second, fen);
+
+            // Negamax over the children, a mate in n plies is better than in n + 2
+            int best = -1000;
+            auto moves = board.legalMoves();
+            for (auto &move : moves) {
+                board.move(move);
+                Result child;
+                int score = 0;
+                if (!tablebases.probe(board, child)) {
+                    score = -2000;
+                } else if (child.wdl == WDL::WIN) {
+                    score = -(500 - child.dtm - 1);
+                } else if (child.wdl == WDL::LOSS) {
+                    score = 500 - child.dtm - 1;
+                }
+                board.unMove();
+                best = std::max(best, score);
+            }
+            if (moves.empty()) best = board.isInCheck() ? -500 : 0;
+
+            int score = (expected.wdl == WDL::WIN)    ? 500 - expected.dtm
+                        : (expected.wdl == WDL::LOSS) ? -(500 - expected.dtm)
+                                                      : 0;
+            nErrors += score != best;
+        }
+        return nErrors;
+    }
+} // namespace Tablebase
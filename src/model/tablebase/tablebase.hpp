@@ -0,0 +1,182 @@
+#ifndef TABLEBASE_HPP
+#define TABLEBASE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "model/game/game.hpp"
+#include "model/utils/mapped_file.hpp"
+
+/**
+ * @brief Endgame tablebases built by retrograde analysis
+ *    - A material is named like "KQvK" or "KRPvKR": the first player's
+ *      pieces, then the second player's, each starting with its King
+ *    - A position is indexed by side to move then the square (row * 8 + column)
+ *      of every piece in material order: ((side * 64 + s0) * 64 + s1) ...
+ *    - Castling and en passant are ignored
+ */
+namespace Tablebase {
+    constexpr int MAX_PIECES = 5;
+    constexpr std::string_view MAGIC = "CHTB";
+    constexpr std::uint32_t VERSION = 1;
+
+    /**
+     * @brief Result for the player to move
+     */
+    enum class WDL : std::uint8_t { INVALID, LOSS, DRAW, WIN };
+
+    struct Result {
+        WDL wdl;
+        /**
+         * @brief Plies to mate for a WIN or a LOSS, 0 when mated
+         */
+        int dtm;
+    };
+
+    class Material {
+      public:
+        /**
+         * @throw std::runtime_error if the name is malformed or has too many pieces
+         */
+        explicit Material(std::string_view name);
+
+        std::string name() const;
+        int nPieces() const;
+        Pieces::Types type(int piece) const;
+        /**
+         * @return 0 for the first player, 1 for the second one
+         */
+        int color(int piece) const;
+        std::uint64_t size() const;
+
+      private:
+        std::vector<Pieces::Types> _types;
+        std::vector<int> _colors;
+    };
+
+    /**
+     * @brief WDL then DTM of every index of one material
+     *    - The file is MAGIC, VERSION, the material name on 16 bytes, then
+     *      WDL on 2 bits per position and DTM in plies on 1 byte per position
+     */
+    class Table {
+      public:
+        Table();
+        explicit Table(const std::string &path);
+        Table(const Material &material, std::vector<char> data);
+
+        /**
+         * @throw std::runtime_error if the file is not a valid table
+         */
+        void open(const std::string &path);
+        void write(const std::string &path) const;
+
+        const Material &material() const;
+        Result probe(std::uint64_t index) const;
+
+      private:
+        Material _material;
+        Utils::MappedFile _file;
+        std::vector<char> _data;
+
+        const char *data() const;
+    };
+
+    /**
+     * @brief Set of tables probed by Board position
+     *    - A position whose colors are swapped against a table is mirrored
+     */
+    class Tablebases {
+      public:
+        Tablebases();
+
+        void add(Table table);
+        /**
+         * @brief Open every "*.tb" file of a directory
+         */
+        void load(const std::string &directory);
+
+        /**
+         * @return false if there is no table for the material of the board
+         */
+        bool probe(const Game::Board &board, Result &result) const;
+
+        std::size_t size() const;
+
+      private:
+        std::map<std::string, Table> _tables;
+        int _maxPieces;
+    };
+
+    /**
+     * @brief Retrograde generator
+     *    - Tables of lower materials reached by captures and promotions are
+     *      generated first and kept in memory
+     *    - Positions are resolved ply by ply from the checkmates backwards
+     *      with un-move generation, the work is split among the threads
+     */
+    class Generator {
+      public:
+        struct Options {
+            std::size_t nThreads = 0;
+        };
+
+        Generator();
+        explicit Generator(Options options);
+
+        Table generate(const Material &material);
+
+      private:
+        Options _options;
+        std::map<std::string, std::vector<std::int16_t>> _values;
+
+        const std::vector<std::int16_t> &values(const Material &material);
+    };
+
+    /**
+     * @brief King and Pawn against King bitbase embedded in the binary
+     *    - One bit per position, set when the side of the Pawn wins: 24 KB,
+     *      nothing is read at startup
+     *    - Squares are row * 8 + column, positions are mirrored so that the
+     *      Pawn stands on files a-d and moves toward row 7
+     *    - The embedded data (kpk_bitbase.hpp) is the output of generate()
+     */
+    class KPK {
+      public:
+        static constexpr int N_POSITIONS = 2 * 64 * 64 * 24;
+
+        /**
+         * @param side 0 when the side of the Pawn is to move, 1 otherwise
+         */
+        static bool isWin(int side, int strongKing, int pawn, int weakKing);
+
+        /**
+         * @brief Result for the player to move
+         * @return false if the board is not King and Pawn against King
+         */
+        static bool probe(const Game::Board &board, WDL &wdl);
+
+        /**
+         * @brief Build the bitbase by resolving positions from their
+         *        children until nothing changes
+         */
+        static std::vector<std::uint32_t> generate();
+
+      private:
+        static int index(int side, int strongKing, int pawn, int weakKing);
+    };
+
+    /**
+     * @brief Check every step-th valid position of the table against a
+     *        one-ply forward search with Board::legalMoves()
+     * @return the number of positions whose result disagrees with the
+     *         results of their children
+     */
+    std::size_t verify(const Table &table, const Tablebases &tablebases, std::size_t step);
+} // namespace Tablebase
+
+#endif // TABLEBASE_HPP
@@ -0,0 +1,248 @@
+#include "model/tournament/tournament.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+#include "model/notation/notation.hpp"
+
+#ifndef _WIN32
+    #include <csignal>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
+namespace Tournament {
+    LocalEngine::LocalEngine()
+        : LocalEngine(Search::Searcher::Options()) {}
+
+    LocalEngine::LocalEngine(Search::Searcher::Options options)
+        : _board(8, 8)
+        , _first("White")
+        , _second("Black")
+        , _searcher(options)
+        , _fen()
+        , _moves() {}
+
+    void LocalEngine::newGame() {
+        this->_searcher.heuristics().clear();
+        this->_fen.clear();
+        this->_moves.clear();
+    }
+
+    std::string LocalEngine::go(std::string_view fen, const std::vector<std::string> &moves,
+                                const TimeControl &control,
+                                const std::array<std::chrono::milliseconds, 2> &clocks) {
+        // Only the moves played since the last call are parsed again
+        bool isContinued = this->_fen == fen && this->_moves.size() <= moves.size() &&
+                           std::equal(this->_moves.begin(), this->_moves.end(), moves.begin());
+        if (!isContinued) {
+            this->_board.initialize(this->_first, this->_second, fen);
+            this->_fen = fen;
+            this->_moves.clear();
+        }
+        for (std::size_t i = this->_moves.size(); i < moves.size(); ++i) {
+            this->_board.move(Notation::LAN::parse(this->_board, moves[i]));
+            this->_moves.push_back(moves[i]);
+        }
+
+        Search::Searcher::Limits limits;
+        if (control.depth > 0) limits.depth = std::min(control.depth, Search::MAX_PLY - 1);
+        limits.nodes = control.nodes;
+        if (control.time.count() > 0) {
+            int side = this->_board.color(this->_board.turn());
+            limits.time = std::max(Search::Searcher::allocate(clocks[side], control.increment),
+                                   std::chrono::milliseconds(1));
+        }
+        auto result = this->_searcher.search(this->_board, limits);
+        if (Search::Heuristics::key(result.move) == Search::Heuristics::NO_MOVE) {
+            throw std::runtime_error("Engine has no move to play: fen='" + this->_board.fen() + "'");
+        }
+        return Notation::LAN::format(result.move);
+    }
+
+#ifndef _WIN32
+    UCIEngine::UCIEngine(std::vector<std::string> command, std::chrono::milliseconds timeout)
+        : _command(std::move(command))
+        , _timeout(timeout)
+        , _pid(-1)
+        , _socket(-1)
+        , _buffer() {
+        if (this->_command.empty()) throw std::runtime_error("Engine command is empty");
+
+        // Engines forked by other threads must not inherit these ends, dup2()
+        // clears the flag on the child's stdin and stdout
+        int sockets[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sockets) != 0) {
+            throw std::runtime_error("Cannot create engine socket: command='" + this->_command[0] +
+                                     "'");
+        }
+        std::vector<char *> arguments;
+        for (auto &argument : this->_command) arguments.push_back(argument.data());
+        arguments.push_back(nullptr);
+
+        this->_pid = fork();
+        if (this->_pid < 0) {
+            close(sockets[0]);
+            close(sockets[1]);
+            throw std::runtime_error("Cannot start engine: command='" + this->_command[0] + "'");
+        }
+        if (this->_pid == 0) {
+            close(sockets[0]);
+            dup2(sockets[1], STDIN_FILENO);
+            dup2(sockets[1], STDOUT_FILENO);
+            close(sockets[1]);
+            execvp(arguments[0], arguments.data());
+            _exit(127);
+        }
+        close(sockets[1]);
+        this->_socket = sockets[0];
+
+        try {
+            this->send("uci");
+            this->waitFor("uciok", this->_timeout);
+            this->send("isready");
+            this->waitFor("readyok", this->_timeout);
+        } catch (const std::runtime_error &) {
+            this->terminate();
+            throw;
+        }
+    }
+
+    UCIEngine::~UCIEngine() { this->terminate(); }
+
+    void UCIEngine::terminate() {
+        if (this->_socket >= 0) {
+            ::send(this->_socket, "quit\n", 5, MSG_NOSIGNAL);
+            close(this->_socket);
+            this->_socket = -1;
+        }
+        if (this->_pid <= 0) return;
+
+        // Leave the engine a moment to quit before killing it
+        for (int i = 0; i < 100; ++i) {
+            if (waitpid(this->_pid, nullptr, WNOHANG) != 0) {
+                this->_pid = -1;
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        kill(this->_pid, SIGKILL);
+        waitpid(this->_pid, nullptr, 0);
+        this->_pid = -1;
+    }
+
+    void UCIEngine::send(const std::string &line) {
+        std::string out = line + '\n';
+        std::size_t sent = 0;
+        while (sent < out.size()) {
+            auto n = ::send(this->_socket, out.data() + sent, out.size() - sent, MSG_NOSIGNAL);
+            if (n <= 0) {
+                throw std::runtime_error("Cannot write to engine: command='" + this->_command[0] +
+                                         "'");
+            }
+            sent += static_cast<std::size_t>(n);
+        }
+    }
+
+    std::string UCIEngine::readLine(std::chrono::steady_clock::time_point deadline) {
+        while (true) {
+            auto end = this->_buffer.find('\n');
+            if (end != std::string::npos) {
+                std::string line = this->_buffer.substr(0, end);
+                this->_buffer.erase(0, end + 1);
+                if (!line.empty() && line.back() == '\r') line.pop_back();
+                return line;
+            }
+
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now());
+            pollfd descriptor{this->_socket, POLLIN, 0};
+            if (left.count() <= 0 || poll(&descriptor, 1, static_cast<int>(left.count())) == 0) {
+                throw std::runtime_error("Engine timed out: command='" + this->_command[0] + "'");
+            }
+            char chunk[4096];
+            auto n = read(this->_socket, chunk, sizeof(chunk));
+            if (n <= 0) {
+                throw std::runtime_error("Engine exited: command='" + this->_command[0] + "'");
+            }
+            this->_buffer.append(chunk, static_cast<std::size_t>(n));
+        }
+    }
+
+    std::string UCIEngine::waitFor(std::string_view prefix, std::chrono::milliseconds timeout) {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (true) {
+            auto line = this->readLine(deadline);
+            if (line.compare(0, prefix.size(), prefix) == 0) return line;
+        }
+    }
+#else
+    UCIEngine::UCIEngine(std::vector<std::string> command, std::chrono::milliseconds timeout)
+        : _command(std::move(command))
+        , _timeout(timeout)
+        , _pid(-1)
+        , _socket(-1)
+        , _buffer() {
+        throw std::runtime_error("UCI engines are not supported on this system");
+    }
+
+    UCIEngine::~UCIEngine() {}
+
+    void UCIEngine::terminate() {}
+
+    void UCIEngine::send(const std::string &line) {}
+
+    std::string UCIEngine::readLine(std::chrono::steady_clock::time_point deadline) { return ""; }
+
+    std::string UCIEngine::waitFor(std::string_view prefix, std::chrono::milliseconds timeout) {
+        return "";
+    }
+#endif
+
+    void UCIEngine::option(std::string_view name, std::string_view value) {
+        this->send("setoption name " + std::string(name) + " value " + std::string(value));
+        this->send("isready");
+        this->waitFor("readyok", this->_timeout);
+    }
+
+    void UCIEngine::newGame() {
+        this->send("ucinewgame");
+        this->send("isready");
+        this->waitFor("readyok", this->_timeout);
+    }
+
+    std::string UCIEngine::go(std::string_view fen, const std::vector<std::string> &moves,
+                              const TimeControl &control,
+                              const std::array<std::chrono::milliseconds, 2> &clocks) {
+        std::string position = "position fen " + std::string(fen);
+        if (!moves.empty()) position += " moves";
+        for (auto &move : moves) position += " " + move;
+        this->send(position);
+
+        std::string go = "go";
+        if (control.depth > 0) go += " depth " + std::to_string(control.depth);
+        if (control.nodes > 0) go += " nodes " + std::to_string(control.nodes);
+        auto timeout = this->_timeout;
+        if (control.time.count() > 0) {
+            int white = NNUE::Network::WHITE, black = NNUE::Network::BLACK;
+            go += " wtime " + std::to_string(clocks[white].count()) + " btime " +
+                  std::to_string(clocks[black].count()) + " winc " +
+                  std::to_string(control.increment.count()) + " binc " +
+                  std::to_string(control.increment.count());
+            // The match measures the clock of the side to move, this only
+            // bounds the wait on a hung process
+            timeout = std::max(clocks[white], clocks[black]) + control.margin;
+        }
+        this->send(go);
+
+        auto line = this->waitFor("bestmove", timeout);
+        auto start = line.find_first_not_of(' ', 8);
+        if (start == std::string::npos) {
+            throw std::runtime_error("Engine sent no move: line='" + line + "'");
+        }
+        return line.substr(start, line.find(' ', start) - start);
+    }
+} // namespace Tournament
@@ -0,0 +1,182 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <thread>
+
+#include "model/notation/notation.hpp"
+#include "model/tournament/tournament.hpp"
+
+namespace Tournament {
+    namespace {
+        std::string lossOf(int color) { return (color == NNUE::Network::WHITE) ? "0-1" : "1-0"; }
+    } // namespace
+
+    Match::Match(Factory first, Factory second, Options options)
+        : _first(std::move(first))
+        , _second(std::move(second))
+        , _options(std::move(options)) {
+        auto &control = this->_options.timeControl;
+        if (control.nodes == 0 && control.depth <= 0 && control.time.count() <= 0) {
+            throw std::runtime_error("Time control sets no limit");
+        }
+        if (this->_options.openings.empty()) throw std::runtime_error("Match has no opening");
+
+        if (this->_options.isSprt) {
+            SPRT(this->_options.elo0, this->_options.elo1, this->_options.alpha,
+                 this->_options.beta);
+        }
+    }
+
+    Outcome Match::play(std::size_t index, Engine &first, Engine &second) const {
+        auto &options = this->_options;
+        auto &control = options.timeControl;
+        std::size_t opening = index / 2;
+        Outcome outcome;
+        outcome.index = index;
+        outcome.white = static_cast<int>(index % 2);
+        outcome.fen = options.openings[opening % options.openings.size()];
+
+        Game::Board board(8, 8);
+        Pieces::Player white("White"), black("Black");
+        board.initialize(white, black, outcome.fen);
+        // Both games of a pair get the same random plies
+        std::mt19937_64 generator(options.seed ^ (0x9E3779B97F4A7C15ULL * (opening + 1)));
+        for (int i = 0; i < options.randomPlies && board.status() == Game::Status::IN_PROGRESS;
+             ++i) {
+            auto moves = board.legalMoves();
+            auto &move = moves[generator() % moves.size()];
+            outcome.moves.push_back(Notation::LAN::format(move));
+            board.move(move);
+        }
+
+        Engine *engines[2] = {&first, &second};
+        if (outcome.white == 1) std::swap(engines[0], engines[1]);
+        for (int color : {NNUE::Network::WHITE, NNUE::Network::BLACK}) {
+            try {
+                engines[color]->newGame();
+            } catch (const std::runtime_error &) {
+                outcome.result = lossOf(color);
+                outcome.reason = "error";
+                return outcome;
+            }
+        }
+
+        std::array<std::chrono::milliseconds, 2> clocks = {control.time, control.time};
+        int ply = static_cast<int>(outcome.moves.size());
+        while (true) {
+            auto status = board.status();
+            if (status == Game::Status::ENDED_CHECKMATE) {
+                outcome.result = lossOf(board.color(board.turn()));
+                outcome.reason = "checkmate";
+                break;
+            }
+            if (status == Game::Status::ENDED_STALEMATE || status.isDraw()) {
+                outcome.result = "1/2-1/2";
+                outcome.reason = (status == Game::Status::ENDED_STALEMATE) ? "stalemate" : "draw";
+                break;
+            }
+            if (ply >= options.maxPlies) {
+                outcome.result = "1/2-1/2";
+                outcome.reason = "adjudication";
+                break;
+            }
+
+            int side = board.color(board.turn());
+            std::string lan;
+            auto start = std::chrono::steady_clock::now();
+            try {
+                lan = engines[side]->go(outcome.fen, outcome.moves, control, clocks);
+            } catch (const std::runtime_error &) {
+                outcome.result = lossOf(side);
+                outcome.reason = "error";
+                break;
+            }
+            if (control.time.count() > 0) {
+                clocks[side] -= std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start);
+                if (clocks[side] < -control.margin) {
+                    outcome.result = lossOf(side);
+                    outcome.reason = "time";
+                    break;
+                }
+                clocks[side] = std::max(clocks[side], std::chrono::milliseconds(0)) +
+                               control.increment;
+            }
+
+            try {
+                board.move(Notation::LAN::parse(board, lan));
+            } catch (const std::runtime_error &) {
+                outcome.result = lossOf(side);
+                outcome.reason = "illegal move";
+                break;
+            }
+            outcome.moves.push_back(std::move(lan));
+            ++ply;
+        }
+        return outcome;
+    }
+
+    Match::Result Match::run(const Listener &listener) {
+        auto &options = this->_options;
+        std::size_t nThreads = options.concurrency;
+        if (nThreads == 0) nThreads = std::max(1U, std::thread::hardware_concurrency());
+        nThreads = std::max<std::size_t>(std::min(nThreads, options.maxGames), 1);
+
+        std::optional<SPRT> sprt;
+        if (options.isSprt) sprt.emplace(options.elo0, options.elo1, options.alpha, options.beta);
+
+        std::atomic<std::size_t> next{0};
+        std::mutex mutex;
+        Result result;
+        std::exception_ptr failure;
+        auto worker = [&]() {
+            try {
+                auto first = this->_first(), second = this->_second();
+                std::size_t index;
+                while ((index = next.fetch_add(1)) < options.maxGames) {
+                    auto outcome = this->play(index, *first, *second);
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        auto &score = result.score;
+                        if (outcome.result == "1/2-1/2") {
+                            score.draws++;
+                        } else if ((outcome.result == "1-0") == (outcome.white == 0)) {
+                            score.wins++;
+                        } else {
+                            score.losses++;
+                        }
+                        if (listener) listener(outcome, score);
+                        if (sprt && result.decision == SPRT::Decision::CONTINUE) {
+                            result.llr = sprt->llr(score);
+                            result.decision = sprt->decide(score);
+                            if (result.decision != SPRT::Decision::CONTINUE) {
+                                next = options.maxGames;
+                            }
+                        }
+                    }
+                    // A failing engine may be left in any state
+                    if (outcome.reason == "error") {
+                        first = this->_first();
+                        second = this->_second();
+                    }
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!failure) failure = std::current_exception();
+                next = options.maxGames;
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(nThreads);
+        for (std::size_t i = 0; i < nThreads; ++i) threads.emplace_back(worker);
+        for (auto &thread : threads) thread.join();
+
+        if (failure) std::rethrow_exception(failure);
+
+        return result;
+    }
+} // namespace Tournament
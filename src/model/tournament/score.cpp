@@ -0,0 +1,94 @@
+#include <cmath>
+#include <limits>
+
+#include "model/tournament/tournament.hpp"
+
+namespace Tournament {
+    namespace {
+        // Two-sided 95% quantile of the normal distribution
+        constexpr double Z_95 = 1.959963984540054;
+
+        double eloOf(double ratio) {
+            if (ratio <= 0) return -std::numeric_limits<double>::infinity();
+            if (ratio >= 1) return std::numeric_limits<double>::infinity();
+
+            return -400 * std::log10(1 / ratio - 1);
+        }
+
+        double ratioOf(double elo) { return 1 / (1 + std::pow(10.0, -elo / 400)); }
+    } // namespace
+
+    std::size_t Score::games() const { return this->wins + this->draws + this->losses; }
+
+    double Score::ratio() const {
+        if (this->games() == 0) return 0.5;
+
+        return (this->wins + 0.5 * this->draws) / this->games();
+    }
+
+    double Score::variance() const {
+        if (this->games() == 0) return 0;
+
+        double mean = this->ratio();
+        return (this->wins * (1 - mean) * (1 - mean) + this->draws * (0.5 - mean) * (0.5 - mean) +
+                this->losses * mean * mean) /
+               this->games();
+    }
+
+    double Score::elo() const { return eloOf(this->ratio()); }
+
+    double Score::eloError() const {
+        if (this->games() == 0) return std::numeric_limits<double>::infinity();
+
+        double deviation = std::sqrt(this->variance() / this->games());
+        double ratio = this->ratio();
+        return (eloOf(ratio + Z_95 * deviation) - eloOf(ratio - Z_95 * deviation)) / 2;
+    }
+
+    double Score::los() const {
+        double decisive = static_cast<double>(this->wins + this->losses);
+        if (decisive == 0) return 0.5;
+
+        double difference = static_cast<double>(this->wins) - static_cast<double>(this->losses);
+        return 0.5 * (1 + std::erf(difference / std::sqrt(2 * decisive)));
+    }
+
+    SPRT::SPRT(double elo0, double elo1, double alpha, double beta)
+        : _elo0(elo0)
+        , _elo1(elo1)
+        , _lowerBound(std::log(beta / (1 - alpha)))
+        , _upperBound(std::log((1 - beta) / alpha)) {
+        if (!(elo0 < elo1) || alpha <= 0 || alpha >= 1 || beta <= 0 || beta >= 1) {
+            throw std::runtime_error("Invalid SPRT bounds: elo0='" + std::to_string(elo0) +
+                                     "', elo1='" + std::to_string(elo1) + "'");
+        }
+    }
+
+    double SPRT::llr(const Score &score) const {
+        if (score.games() == 0) return 0;
+
+        // Half a game of each outcome keeps the variance positive after a
+        // few games of the same outcome
+        double wins = score.wins + 0.5, draws = score.draws + 0.5, losses = score.losses + 0.5;
+        double n = wins + draws + losses;
+        double mean = (wins + 0.5 * draws) / n;
+        double variance = (wins * (1 - mean) * (1 - mean) + draws * (0.5 - mean) * (0.5 - mean) +
+                           losses * mean * mean) /
+                          n;
+
+        double ratio0 = ratioOf(this->_elo0), ratio1 = ratioOf(this->_elo1);
+        return score.games() * (ratio1 - ratio0) * (2 * mean - ratio0 - ratio1) / (2 * variance);
+    }
+
+    double SPRT::lowerBound() const { return this->_lowerBound; }
+
+    double SPRT::upperBound() const { return this->_upperBound; }
+
+    SPRT::Decision SPRT::decide(const Score &score) const {
+        double llr = this->llr(score);
+        if (llr >= this->_upperBound) return Decision::ACCEPT_H1;
+        if (llr <= this->_lowerBound) return Decision::ACCEPT_H0;
+
+        return Decision::CONTINUE;
+    }
+} // namespace Tournament
@@ -0,0 +1,258 @@
+#ifndef TOURNAMENT_HPP
+#define TOURNAMENT_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "model/game/game.hpp"
+#include "model/pgn/pgn.hpp"
+#include "model/search/search.hpp"
+
+/**
+ * @brief Matches between two engines, run locally
+ *    - Engines are Searcher configurations in the process or child
+ *      processes speaking UCI on their standard input and output
+ *    - Openings are played twice with the colors swapped
+ *    - The match stops after a number of games or on an SPRT decision
+ */
+namespace Tournament {
+    /**
+     * @brief Limits of a move, at least one of them must be set
+     */
+    struct TimeControl {
+        std::uint64_t nodes = 0;
+        int depth = 0;
+        // Clock of each side for the whole game, 0 for no clock
+        std::chrono::milliseconds time{0};
+        std::chrono::milliseconds increment{0};
+        // Delay past the clock tolerated before the game is lost on time
+        std::chrono::milliseconds margin{50};
+    };
+
+    class Engine {
+      public:
+        virtual ~Engine() = default;
+
+        virtual void newGame() = 0;
+
+        /**
+         * @param moves Moves played from fen, in LAN
+         * @param clocks Time left to each side, indexed by color
+         * @return The move to play, in LAN
+         * @throw std::runtime_error if the engine fails, it loses the game
+         */
+        virtual std::string go(std::string_view fen, const std::vector<std::string> &moves,
+                               const TimeControl &control,
+                               const std::array<std::chrono::milliseconds, 2> &clocks) = 0;
+    };
+
+    using Factory = std::function<std::unique_ptr<Engine>()>;
+
+    /**
+     * @brief A Searcher with its own Board, moves already played are kept
+     *        from one call to the next
+     */
+    class LocalEngine : public Engine {
+      public:
+        LocalEngine();
+        explicit LocalEngine(Search::Searcher::Options options);
+
+        void newGame() override;
+        std::string go(std::string_view fen, const std::vector<std::string> &moves,
+                       const TimeControl &control,
+                       const std::array<std::chrono::milliseconds, 2> &clocks) override;
+
+      private:
+        Game::Board _board;
+        Pieces::Player _first;
+        Pieces::Player _second;
+        Search::Searcher _searcher;
+        std::string _fen;
+        std::vector<std::string> _moves;
+    };
+
+    /**
+     * @brief A child process speaking UCI
+     *    - The command is run without a shell, its standard input and
+     *      output are connected to a socket pair
+     *    - Every answer is awaited with a deadline: the clock plus the
+     *      margin, or the timeout when the game has no clock
+     * @warning Only available on POSIX systems
+     */
+    class UCIEngine : public Engine {
+      public:
+        static constexpr std::chrono::milliseconds TIMEOUT{10000};
+
+        /**
+         * @throw std::runtime_error if the process cannot be started or
+         *        does not answer "uciok" in time
+         */
+        explicit UCIEngine(std::vector<std::string> command,
+                           std::chrono::milliseconds timeout = TIMEOUT);
+        ~UCIEngine();
+
+        UCIEngine(const UCIEngine &other) = delete;
+        UCIEngine &operator=(const UCIEngine &other) = delete;
+
+        /**
+         * @brief Send "setoption name <name> value <value>"
+         */
+        void option(std::string_view name, std::string_view value);
+
+        void newGame() override;
+        std::string go(std::string_view fen, const std::vector<std::string> &moves,
+                       const TimeControl &control,
+                       const std::array<std::chrono::milliseconds, 2> &clocks) override;
+
+      private:
+        std::vector<std::string> _command;
+        std::chrono::milliseconds _timeout;
+        int _pid;
+        int _socket;
+        std::string _buffer;
+
+        /**
+         * @brief Ask the process to quit, kill it if it does not
+         */
+        void terminate();
+        void send(const std::string &line);
+        std::string readLine(std::chrono::steady_clock::time_point deadline);
+        /**
+         * @return The first line starting with prefix, earlier lines are skipped
+         */
+        std::string waitFor(std::string_view prefix, std::chrono::milliseconds timeout);
+    };
+
+    /**
+     * @brief Games won, drawn and lost by the first engine
+     */
+    struct Score {
+        std::size_t wins = 0;
+        std::size_t draws = 0;
+        std::size_t losses = 0;
+
+        std::size_t games() const;
+        /**
+         * @brief Points per game, 0.5 without any game
+         */
+        double ratio() const;
+        /**
+         * @brief Variance of the points of one game
+         */
+        double variance() const;
+        /**
+         * @brief Logistic Elo difference
+         */
+        double elo() const;
+        /**
+         * @brief Half-width of the 95% confidence interval of elo()
+         */
+        double eloError() const;
+        /**
+         * @brief Likelihood of superiority: probability that the first
+         *        engine is the stronger, draws aside
+         */
+        double los() const;
+    };
+
+    /**
+     * @brief Sequential probability ratio test between H0: elo = elo0 and
+     *        H1: elo = elo1, on the logistic Elo scale
+     *    - The log-likelihood ratio uses the normal approximation of the
+     *      game scores with their observed variance
+     */
+    class SPRT {
+      public:
+        enum class Decision { CONTINUE, ACCEPT_H0, ACCEPT_H1 };
+
+        SPRT(double elo0, double elo1, double alpha = 0.05, double beta = 0.05);
+
+        double llr(const Score &score) const;
+        double lowerBound() const;
+        double upperBound() const;
+        Decision decide(const Score &score) const;
+
+      private:
+        double _elo0;
+        double _elo1;
+        double _lowerBound;
+        double _upperBound;
+    };
+
+    /**
+     * @brief One finished game, the engines being numbered 0 and 1
+     */
+    struct Outcome {
+        std::size_t index = 0;
+        int white = 0;
+        std::string fen;
+        std::vector<std::string> moves;
+        std::string result = "*";
+        // "checkmate", "stalemate", "draw", "adjudication", "time", "illegal move" or "error"
+        std::string reason;
+    };
+
+    class Match {
+      public:
+        struct Options {
+            std::size_t concurrency = 0;
+            std::size_t maxGames = 1000;
+            TimeControl timeControl = {0, 4};
+            // Openings played in turn, then randomPlies random moves
+            std::vector<std::string> openings = {std::string(PGN::STANDARD_FEN)};
+            int randomPlies = 0;
+            std::uint64_t seed = 0;
+            // Adjudicated as a draw when reached
+            int maxPlies = 400;
+            bool isSprt = true;
+            double elo0 = 0;
+            double elo1 = 5;
+            double alpha = 0.05;
+            double beta = 0.05;
+        };
+
+        struct Result {
+            Score score;
+            SPRT::Decision decision = SPRT::Decision::CONTINUE;
+            double llr = 0;
+        };
+
+        /**
+         * @brief Called in completion order with each game and the score so far
+         */
+        using Listener = std::function<void(const Outcome &, const Score &)>;
+
+        /**
+         * @throw std::runtime_error if the time control sets no limit
+         */
+        Match(Factory first, Factory second, Options options);
+
+        /**
+         * @brief Play games on concurrency threads, each one with its own pair
+         *        of engines, until maxGames or an SPRT decision
+         *    - Games already started when the test decides are played out
+         *    - Engines are created again after one of them failed
+         */
+        Result run(const Listener &listener = {});
+
+        /**
+         * @brief Play game index: opening index / 2, the first engine being
+         *        white on even indexes
+         */
+        Outcome play(std::size_t index, Engine &first, Engine &second) const;
+
+      private:
+        Factory _first;
+        Factory _second;
+        Options _options;
+    };
+} // namespace Tournament
+
+#endif // TOURNAMENT_HPP
@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+
+#include "model/tuning/tuning.hpp"
+
+namespace Tuning {
+    namespace {
+        /**
+         * @brief Result written as "1-0", "0-1", "1/2-1/2" or a number in [0, 1],
+         *        possibly surrounded by brackets, quotes or a semicolon
+         */
+        bool parseResult(std::string_view token, float &result) {
+            auto start = token.find_first_not_of("[\"';");
+            auto end = token.find_last_not_of("[]\"';");
+            if (start == std::string_view::npos) return false;
+
+            token = token.substr(start, end - start + 1);
+            if (token == "1-0" || token == "0-1" || token == "1/2-1/2") {
+                result = (token == "1-0") ? 1 : (token == "0-1") ? 0 : 0.5F;
+                return true;
+            }
+            if (token.find_first_not_of("0123456789.") != std::string_view::npos) return false;
+
+            std::string number(token);
+            char *last = nullptr;
+            double value = std::strtod(number.c_str(), &last);
+            if (last != number.c_str() + number.size() || value < 0 || value > 1) return false;
+
+            result = static_cast<float>(value);
+            return true;
+        }
+
+        bool isNumber(std::string_view token) {
+            return !token.empty() &&
+                   token.find_first_not_of("0123456789") == std::string_view::npos;
+        }
+    } // namespace
+
+    int materialIndex(int type) { return type; }
+
+    int tableIndex(int type, int square) {
+        return Search::Parameters::N_TYPES + type * Search::Parameters::N_SQUARES + square;
+    }
+
+    std::vector<float> flatten(const Search::Parameters &parameters) {
+        std::vector<float> values(N_PARAMETERS);
+        for (int type = 0; type < Search::Parameters::N_TYPES; ++type) {
+            values[materialIndex(type)] = static_cast<float>(parameters.material[type]);
+            for (int square = 0; square < Search::Parameters::N_SQUARES; ++square) {
+                values[tableIndex(type, square)] =
+                    static_cast<float>(parameters.tables[type][square]);
+            }
+        }
+        return values;
+    }
+
+    Search::Parameters unflatten(const std::vector<float> &values) {
+        if (values.size() != N_PARAMETERS) {
+            throw std::runtime_error("Invalid number of parameters: size='" +
+                                     std::to_string(values.size()) + "'");
+        }
+        Search::Parameters parameters;
+        for (int type = 0; type < Search::Parameters::N_TYPES; ++type) {
+            parameters.material[type] = static_cast<int>(std::lround(values[materialIndex(type)]));
+            for (int square = 0; square < Search::Parameters::N_SQUARES; ++square) {
+                parameters.tables[type][square] =
+                    static_cast<int>(std::lround(values[tableIndex(type, square)]));
+            }
+        }
+        return parameters;
+    }
+
+    Dataset::Dataset()
+        : _size(0)
+        , _features()
+        , _offsets()
+        , _nSlots()
+        , _results()
+        , _pending(LANES)
+        , _pendingResults(LANES) {}
+
+    void Dataset::add(const Game::Board &board, float result) {
+        // A partial last block is dropped and written again with the new lane
+        if (this->_size % LANES != 0) {
+            this->_features.resize(this->_offsets.back());
+            this->_offsets.pop_back();
+            this->_nSlots.pop_back();
+            this->_results.resize(this->_results.size() - LANES);
+        }
+
+        auto &lane = this->_pending[this->_size % LANES];
+        lane.clear();
+        auto boundaries = board.boundaries();
+        bool hasTables = (boundaries.first == 8) && (boundaries.second == 8);
+        Position captured;
+        for (auto *piece : board.pieces()) {
+            auto position = piece->position();
+            if (position == captured) continue;
+
+            int color = board.color(piece);
+            int type = piece->type().index();
+            int sign = (color == NNUE::Network::WHITE) ? 0 : N_PARAMETERS;
+            // The Kings' material cancels out
+            if (piece->type() != Pieces::Types::KING) {
+                lane.push_back(static_cast<std::uint16_t>(materialIndex(type) + sign));
+            }
+            if (hasTables) {
+                int row = (color == NNUE::Network::BLACK) ? 7 - position.row() : position.row();
+                int square = row * 8 + position.column();
+                lane.push_back(static_cast<std::uint16_t>(tableIndex(type, square) + sign));
+            }
+        }
+        this->_pendingResults[this->_size % LANES] = result;
+        this->_size++;
+        this->flush();
+    }
+
+    void Dataset::flush() {
+        int count = static_cast<int>((this->_size - 1) % LANES) + 1;
+        std::size_t nSlots = 0;
+        for (int lane = 0; lane < count; ++lane) {
+            nSlots = std::max(nSlots, this->_pending[lane].size());
+        }
+
+        this->_offsets.push_back(this->_features.size());
+        this->_nSlots.push_back(static_cast<std::uint8_t>(nSlots));
+        for (std::size_t slot = 0; slot < nSlots; ++slot) {
+            for (int lane = 0; lane < LANES; ++lane) {
+                auto &features = this->_pending[lane];
+                this->_features.push_back((lane < count && slot < features.size()) ? features[slot]
+                                                                                  : PADDING);
+            }
+        }
+        for (int lane = 0; lane < LANES; ++lane) {
+            this->_results.push_back((lane < count) ? this->_pendingResults[lane] : 0);
+        }
+    }
+
+    std::size_t Dataset::load(std::istream &in) {
+        Game::Board board(8, 8);
+        Pieces::Player first("White"), second("Black");
+        std::size_t nAdded = 0;
+        std::string line;
+        while (std::getline(in, line)) {
+            std::string_view text(line);
+            std::vector<std::string_view> tokens;
+            for (std::size_t i = 0; i < text.size();) {
+                if (text[i] == ' ' || text[i] == '\t' || text[i] == '\r') {
+                    ++i;
+                    continue;
+                }
+                std::size_t start = i;
+                while (i < text.size() && text[i] != ' ' && text[i] != '\t' && text[i] != '\r') ++i;
+                tokens.push_back(text.substr(start, i - start));
+            }
+            if (tokens.empty() || tokens[0].front() == '#') continue;
+
+            if (tokens.size() < 5) {
+                throw std::runtime_error("Invalid labelled position: line='" + line + "'");
+            }
+            std::size_t nFields = 4;
+            while (nFields < 6 && nFields + 1 < tokens.size() && isNumber(tokens[nFields])) {
+                nFields++;
+            }
+            auto fen = text.substr(0, tokens[nFields - 1].data() + tokens[nFields - 1].size() -
+                                          text.data());
+            float result;
+            bool hasResult = false;
+            for (std::size_t i = nFields; i < tokens.size() && !hasResult; ++i) {
+                hasResult = parseResult(tokens[i], result);
+            }
+            if (!hasResult) {
+                throw std::runtime_error("Invalid result of labelled position: line='" + line +
+                                         "'");
+            }
+
+            board.initialize(first, second, fen);
+            if (board.isInCheck()) continue;
+
+            this->add(board, result);
+            nAdded++;
+        }
+        return nAdded;
+    }
+
+    std::size_t Dataset::load(const std::string &path) {
+        std::ifstream file(path);
+        if (!file) throw std::runtime_error("Cannot open positions: path='" + path + "'");
+
+        return this->load(file);
+    }
+
+    std::size_t Dataset::load(const Archive::Reader &archive, int skipPlies) {
+        Game::Board board(8, 8);
+        Pieces::Player first("White"), second("Black");
+        std::size_t nAdded = 0;
+        for (std::size_t game = 0; game < archive.size(); ++game) {
+            auto record = archive.record(game);
+            float result;
+            if (record.result == "*" || !parseResult(record.result, result)) continue;
+
+            board.initialize(first, second, record.fen());
+            bool isQuiet = true;
+            for (std::size_t ply = 0;; ++ply) {
+                if (isQuiet && ply >= static_cast<std::size_t>(skipPlies) && !board.isInCheck()) {
+                    this->add(board, result);
+                    nAdded++;
+                }
+                if (ply == record.moves.size()) break;
+
+                auto move = Archive::decodeMove(board, record.moves[ply]);
+                isQuiet = move.captured() == nullptr && move.promoted() == nullptr;
+                board.move(move);
+            }
+        }
+        return nAdded;
+    }
+
+    std::size_t Dataset::size() const { return this->_size; }
+
+    std::size_t Dataset::nBlocks() const { return this->_offsets.size(); }
+
+    const std::uint16_t *Dataset::features(std::size_t block) const {
+        return this->_features.data() + this->_offsets[block];
+    }
+
+    int Dataset::nSlots(std::size_t block) const { return this->_nSlots[block]; }
+
+    const float *Dataset::results(std::size_t block) const {
+        return this->_results.data() + block * LANES;
+    }
+} // namespace Tuning
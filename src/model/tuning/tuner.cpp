@@ -0,0 +1,197 @@
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#include "model/tuning/tuning.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define TUNING_X86
+    #include <immintrin.h>
+#endif
+
+namespace Tuning {
+    namespace {
+        using Kernel = void (*)(const float *weights, const std::uint16_t *features, int nSlots,
+                                float *evaluations);
+
+        void evaluateScalar(const float *weights, const std::uint16_t *features, int nSlots,
+                            float *evaluations) {
+            for (int lane = 0; lane < Dataset::LANES; ++lane) evaluations[lane] = 0;
+            for (int slot = 0; slot < nSlots; ++slot) {
+                for (int lane = 0; lane < Dataset::LANES; ++lane) {
+                    evaluations[lane] += weights[features[slot * Dataset::LANES + lane]];
+                }
+            }
+        }
+
+#ifdef TUNING_X86
+        // Sums in the same order as evaluateScalar(), the results are identical
+        __attribute__((target("avx2"))) void evaluateAvx2(const float *weights,
+                                                          const std::uint16_t *features,
+                                                          int nSlots, float *evaluations) {
+            __m256 sum = _mm256_setzero_ps();
+            for (int slot = 0; slot < nSlots; ++slot) {
+                __m128i packed = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i *>(features + slot * Dataset::LANES));
+                __m256i indexes = _mm256_cvtepu16_epi32(packed);
+                sum = _mm256_add_ps(sum, _mm256_i32gather_ps(weights, indexes, 4));
+            }
+            _mm256_storeu_ps(evaluations, sum);
+        }
+#endif
+
+        Kernel kernel(bool isSimd) {
+#ifdef TUNING_X86
+            if (isSimd && __builtin_cpu_supports("avx2")) return evaluateAvx2;
+#endif
+            return evaluateScalar;
+        }
+
+        // Keeps log() finite on a position evaluated with certainty
+        constexpr double PROBABILITY_MIN = 1e-12;
+
+        struct Partial {
+            double loss = 0;
+            std::vector<double> gradient;
+        };
+    } // namespace
+
+    Tuner::Tuner(const Dataset &dataset)
+        : Tuner(dataset, Options()) {}
+
+    Tuner::Tuner(const Dataset &dataset, Options options)
+        : _dataset(dataset)
+        , _options(options)
+        , _scale(options.scale) {}
+
+    double Tuner::loss(const std::vector<float> &parameters, double scale,
+                       std::vector<double> *gradient) const {
+        auto &dataset = this->_dataset;
+        if (dataset.size() == 0) throw std::runtime_error("Cannot tune on an empty dataset");
+
+        // [parameters, -parameters, 0] so that a feature index carries its sign
+        std::vector<float> weights(Dataset::PADDING + 1, 0);
+        for (int i = 0; i < N_PARAMETERS; ++i) {
+            weights[i] = parameters[i];
+            weights[N_PARAMETERS + i] = -parameters[i];
+        }
+
+        std::size_t nThreads = this->_options.nThreads;
+        if (nThreads == 0) nThreads = std::max(1U, std::thread::hardware_concurrency());
+        nThreads = std::max<std::size_t>(std::min(nThreads, dataset.nBlocks()), 1);
+        auto evaluate = kernel(this->_options.isSimd);
+        bool hasGradient = gradient != nullptr;
+
+        std::vector<Partial> partials(nThreads);
+        auto work = [&](std::size_t id) {
+            auto &partial = partials[id];
+            if (hasGradient) partial.gradient.assign(weights.size(), 0);
+            std::size_t begin = dataset.nBlocks() * id / nThreads;
+            std::size_t end = dataset.nBlocks() * (id + 1) / nThreads;
+            alignas(32) float evaluations[Dataset::LANES];
+            double errors[Dataset::LANES];
+            for (std::size_t block = begin; block < end; ++block) {
+                auto *features = dataset.features(block);
+                int nSlots = dataset.nSlots(block);
+                auto *results = dataset.results(block);
+                int count = static_cast<int>(
+                    std::min<std::size_t>(Dataset::LANES, dataset.size() - block * Dataset::LANES));
+                evaluate(weights.data(), features, nSlots, evaluations);
+                for (int lane = 0; lane < count; ++lane) {
+                    double probability = 1 / (1 + std::exp(-scale * evaluations[lane]));
+                    probability = std::clamp(probability, PROBABILITY_MIN, 1 - PROBABILITY_MIN);
+                    double result = results[lane];
+                    partial.loss -= result * std::log(probability) +
+                                    (1 - result) * std::log(1 - probability);
+                    errors[lane] = (probability - result) * scale;
+                }
+                if (!hasGradient) continue;
+
+                for (int slot = 0; slot < nSlots; ++slot) {
+                    for (int lane = 0; lane < count; ++lane) {
+                        partial.gradient[features[slot * Dataset::LANES + lane]] += errors[lane];
+                    }
+                }
+            }
+        };
+        if (nThreads == 1) {
+            work(0);
+        } else {
+            std::vector<std::thread> threads;
+            threads.reserve(nThreads);
+            for (std::size_t id = 0; id < nThreads; ++id) threads.emplace_back(work, id);
+            for (auto &thread : threads) thread.join();
+        }
+
+        double size = static_cast<double>(dataset.size());
+        double loss = 0;
+        for (auto &partial : partials) loss += partial.loss;
+        if (hasGradient) {
+            gradient->assign(N_PARAMETERS, 0);
+            for (auto &partial : partials) {
+                for (int i = 0; i < N_PARAMETERS; ++i) {
+                    (*gradient)[i] += partial.gradient[i] - partial.gradient[N_PARAMETERS + i];
+                }
+            }
+            for (auto &value : *gradient) value /= size;
+        }
+        return loss / size;
+    }
+
+    double Tuner::fitScale(const std::vector<float> &parameters) const {
+        // Golden-section search on the logarithm of the scale
+        const double ratio = (std::sqrt(5.0) - 1) / 2;
+        double low = std::log(1e-4), high = std::log(1e-1);
+        double a = high - ratio * (high - low), b = low + ratio * (high - low);
+        double lossA = this->loss(parameters, std::exp(a));
+        double lossB = this->loss(parameters, std::exp(b));
+        for (int i = 0; i < 40; ++i) {
+            if (lossA < lossB) {
+                high = b;
+                b = a;
+                lossB = lossA;
+                a = high - ratio * (high - low);
+                lossA = this->loss(parameters, std::exp(a));
+            } else {
+                low = a;
+                a = b;
+                lossA = lossB;
+                b = low + ratio * (high - low);
+                lossB = this->loss(parameters, std::exp(b));
+            }
+        }
+        return std::exp((low + high) / 2);
+    }
+
+    Search::Parameters Tuner::tune(const Search::Parameters &initial, const Listener &listener) {
+        auto &options = this->_options;
+        auto parameters = flatten(initial);
+        this->_scale = (options.scale > 0) ? options.scale : this->fitScale(parameters);
+
+        // Adam, the moments are kept in double to stay exact over many iterations
+        std::vector<double> values(parameters.begin(), parameters.end());
+        std::vector<double> moments(N_PARAMETERS, 0), velocities(N_PARAMETERS, 0), gradient;
+        double previous = 0;
+        for (int iteration = 1; iteration <= options.maxIterations; ++iteration) {
+            double loss = this->loss(parameters, this->_scale, &gradient);
+            if (listener) listener(iteration, loss);
+            if (iteration > 1 && std::abs(previous - loss) < options.tolerance * previous) break;
+
+            previous = loss;
+            double correction1 = 1 - std::pow(options.beta1, iteration);
+            double correction2 = 1 - std::pow(options.beta2, iteration);
+            for (int i = 0; i < N_PARAMETERS; ++i) {
+                moments[i] = options.beta1 * moments[i] + (1 - options.beta1) * gradient[i];
+                velocities[i] = options.beta2 * velocities[i] +
+                                (1 - options.beta2) * gradient[i] * gradient[i];
+                double moment = moments[i] / correction1, velocity = velocities[i] / correction2;
+                values[i] -=
+                    options.learningRate * moment / (std::sqrt(velocity) + options.epsilon);
+                parameters[i] = static_cast<float>(values[i]);
+            }
+        }
+        return unflatten(parameters);
+    }
+
+    double Tuner::scale() const { return this->_scale; }
+} // namespace Tuning
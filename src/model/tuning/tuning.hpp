@@ -0,0 +1,153 @@
+#ifndef TUNING_HPP
+#define TUNING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "model/archive/archive.hpp"
+#include "model/search/search.hpp"
+
+/**
+ * @brief Texel tuning of Search::Parameters on labelled positions
+ *    - The evaluation without network is linear in its parameters: a
+ *      position is the list of parameters its pieces use, with a sign
+ *    - Positions are grouped by LANES in blocks stored slot by slot
+ *      (structure of arrays) so that a block is evaluated with one gather
+ *      per slot
+ *    - The loss is the cross-entropy between the game result and
+ *      sigmoid(scale * evaluation), minimized with Adam
+ */
+namespace Tuning {
+    constexpr int N_PARAMETERS = Search::Parameters::N_TYPES * (1 + Search::Parameters::N_SQUARES);
+
+    /**
+     * @brief Index of a parameter in the flat vector: the material values
+     *        then the tables
+     */
+    int materialIndex(int type);
+    int tableIndex(int type, int square);
+
+    std::vector<float> flatten(const Search::Parameters &parameters);
+    /**
+     * @brief Values are rounded to the nearest centipawn
+     */
+    Search::Parameters unflatten(const std::vector<float> &values);
+
+    class Dataset {
+      public:
+        static constexpr int LANES = 8;
+        /**
+         * @brief Features are indexes in the weights [parameters, -parameters, 0]:
+         *        the sign is folded in the index and PADDING fills short lanes
+         */
+        static constexpr std::uint16_t PADDING = 2 * N_PARAMETERS;
+
+        Dataset();
+
+        /**
+         * @param result Result for the first player: 1 win, 0.5 draw, 0 loss
+         */
+        void add(const Game::Board &board, float result);
+
+        /**
+         * @brief Read lines "<FEN> <result>", the result being written as
+         *        "1-0", "0-1", "1/2-1/2" or a number, possibly in brackets or
+         *        quotes (e.g. "[0.5]", "c9 \"1-0\";")
+         *    - Positions where the player to move is in check are skipped
+         * @return The number of positions added
+         * @throw std::runtime_error on a malformed line
+         */
+        std::size_t load(std::istream &in);
+        std::size_t load(const std::string &path);
+
+        /**
+         * @brief Add the quiet positions of finished games: not in check,
+         *        not right after a capture or a promotion, after skipPlies
+         * @return The number of positions added
+         * @throw std::runtime_error if a move of the archive is not legal
+         */
+        std::size_t load(const Archive::Reader &archive, int skipPlies = 8);
+
+        std::size_t size() const;
+        std::size_t nBlocks() const;
+
+        /**
+         * @brief Features of a block: slot s of lane l at features(b)[s * LANES + l]
+         */
+        const std::uint16_t *features(std::size_t block) const;
+        int nSlots(std::size_t block) const;
+        const float *results(std::size_t block) const;
+
+      private:
+        std::size_t _size;
+        std::vector<std::uint16_t> _features;
+        std::vector<std::uint64_t> _offsets;
+        std::vector<std::uint8_t> _nSlots;
+        std::vector<float> _results;
+        // Positions of the last block, rewritten until it is full
+        std::vector<std::vector<std::uint16_t>> _pending;
+        std::vector<float> _pendingResults;
+
+        void flush();
+    };
+
+    class Tuner {
+      public:
+        struct Options {
+            std::size_t nThreads = 0;
+            int maxIterations = 2000;
+            // Stop when the loss improves by less than tolerance times itself
+            double tolerance = 1e-7;
+            // 0 to fit the scale on the initial parameters
+            double scale = 0;
+            double learningRate = 1;
+            double beta1 = 0.9;
+            double beta2 = 0.999;
+            double epsilon = 1e-8;
+            bool isSimd = true;
+        };
+
+        /**
+         * @brief Called at every iteration with the loss of the parameters
+         *        it starts from
+         */
+        using Listener = std::function<void(int iteration, double loss)>;
+
+        /**
+         * @warning The dataset must outlive the tuner
+         */
+        explicit Tuner(const Dataset &dataset);
+        Tuner(const Dataset &dataset, Options options);
+
+        /**
+         * @brief Mean cross-entropy of the dataset
+         * @param gradient Filled with the derivative of the loss with respect
+         *        to every parameter when not nullptr
+         */
+        double loss(const std::vector<float> &parameters, double scale,
+                    std::vector<double> *gradient = nullptr) const;
+
+        /**
+         * @brief Scale of the sigmoid minimizing the loss of the parameters
+         */
+        double fitScale(const std::vector<float> &parameters) const;
+
+        Search::Parameters tune(const Search::Parameters &initial, const Listener &listener = {});
+
+        /**
+         * @brief Scale used by the last tune()
+         */
+        double scale() const;
+
+      private:
+        const Dataset &_dataset;
+        Options _options;
+        double _scale;
+    };
+} // namespace Tuning
+
+#endif // TUNING_HPP
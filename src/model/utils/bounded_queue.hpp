@@ -0,0 +1,89 @@
+#ifndef BOUNDED_QUEUE_HPP
+#define BOUNDED_QUEUE_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+namespace Utils {
+    /**
+     * @brief Blocking FIFO of at most capacity values shared between threads
+     *    - push() waits while the queue is full, pop() while it is empty, so
+     *      a slow consumer throttles its producers instead of growing memory
+     *    - After close(), push() refuses new values and pop() drains the
+     *      remaining ones before returning false
+     */
+    template <typename T>
+    class BoundedQueue {
+      public:
+        explicit BoundedQueue(std::size_t capacity)
+            : _capacity(capacity)
+            , _isClosed(false) {
+            if (capacity == 0) throw std::runtime_error("Queue capacity must be positive");
+        }
+
+        BoundedQueue(const BoundedQueue &other) = delete;
+        BoundedQueue &operator=(const BoundedQueue &other) = delete;
+
+        /**
+         * @return false if the queue was closed, the value is then dropped
+         */
+        bool push(T value) {
+            std::unique_lock<std::mutex> lock(this->_mutex);
+            this->_notFull.wait(lock, [this]() {
+                return this->_isClosed || this->_values.size() < this->_capacity;
+            });
+            if (this->_isClosed) return false;
+
+            this->_values.push_back(std::move(value));
+            lock.unlock();
+            this->_notEmpty.notify_one();
+            return true;
+        }
+
+        /**
+         * @return false once the queue is closed and empty
+         */
+        bool pop(T &value) {
+            std::unique_lock<std::mutex> lock(this->_mutex);
+            this->_notEmpty.wait(lock,
+                                 [this]() { return this->_isClosed || !this->_values.empty(); });
+            if (this->_values.empty()) return false;
+
+            value = std::move(this->_values.front());
+            this->_values.pop_front();
+            lock.unlock();
+            this->_notFull.notify_one();
+            return true;
+        }
+
+        void close() {
+            {
+                std::lock_guard<std::mutex> lock(this->_mutex);
+                this->_isClosed = true;
+            }
+            this->_notFull.notify_all();
+            this->_notEmpty.notify_all();
+        }
+
+        std::size_t size() const {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            return this->_values.size();
+        }
+
+        std::size_t capacity() const { return this->_capacity; }
+
+      private:
+        mutable std::mutex _mutex;
+        std::condition_variable _notFull;
+        std::condition_variable _notEmpty;
+        std::deque<T> _values;
+        std::size_t _capacity;
+        bool _isClosed;
+    };
+} // namespace Utils
+
+#endif // BOUNDED_QUEUE_HPP
@@ -0,0 +1,123 @@
+#include "model/utils/mapped_file.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+    #include <vector>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Utils {
+    MappedFile::MappedFile()
+        : _path()
+        , _data(nullptr)
+        , _size(0)
+        , _mapped(false) {}
+
+    MappedFile::MappedFile(const std::string &path)
+        : MappedFile() {
+        this->open(path);
+    }
+
+    MappedFile::~MappedFile() { this->close(); }
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept
+        : _path(std::move(other._path))
+        , _data(other._data)
+        , _size(other._size)
+        , _mapped(other._mapped) {
+        other._data = nullptr;
+        other._size = 0;
+        other._mapped = false;
+    }
+
+    MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+        if (this == &other) return *this;
+
+        this->close();
+        this->_path = std::move(other._path);
+        this->_data = other._data;
+        this->_size = other._size;
+        this->_mapped = other._mapped;
+        other._data = nullptr;
+        other._size = 0;
+        other._mapped = false;
+        return *this;
+    }
+
+    void MappedFile::open(const std::string &path) {
+        this->close();
+        this->_path = path;
+#ifdef _WIN32
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) throw std::runtime_error("Cannot open file: path='" + path + "'");
+
+        std::size_t size = static_cast<std::size_t>(file.tellg());
+        char *buffer = new char[size == 0 ? 1 : size];
+        file.seekg(0);
+        file.read(buffer, static_cast<std::streamsize>(size));
+        this->_data = buffer;
+        this->_size = size;
+        this->_mapped = true;
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw std::runtime_error("Cannot open file: path='" + path + "'");
+
+        struct stat status{};
+        if (::fstat(fd, &status) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot stat file: path='" + path + "'");
+        }
+        this->_size = static_cast<std::size_t>(status.st_size);
+        if (this->_size == 0) {
+            ::close(fd);
+            this->_mapped = true;
+            return;
+        }
+
+        void *address = ::mmap(nullptr, this->_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (address == MAP_FAILED) {
+            this->_size = 0;
+            throw std::runtime_error("Cannot map file: path='" + path + "'");
+        }
+        ::madvise(address, this->_size, MADV_SEQUENTIAL);
+        this->_data = static_cast<const char *>(address);
+        this->_mapped = true;
+#endif
+    }
+
+    void MappedFile::close() {
+        if (!this->_mapped) return;
+
+#ifdef _WIN32
+        delete[] this->_data;
+#else
+        if (this->_data != nullptr) ::munmap(const_cast<char *>(this->_data), this->_size);
+#endif
+        this->_data = nullptr;
+        this->_size = 0;
+        this->_mapped = false;
+    }
+
+    bool MappedFile::isOpen() const { return this->_mapped; }
+
+    const char *MappedFile::data() const { return this->_data; }
+
+    std::size_t MappedFile::size() const { return this->_size; }
+
+    std::string_view MappedFile::view() const {
+        if (this->_data == nullptr) return std::string_view();
+
+        return std::string_view(this->_data, this->_size);
+    }
+
+    std::string MappedFile::path() const { return this->_path; }
+
+} // namespace Utils
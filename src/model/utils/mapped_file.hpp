@@ -0,0 +1,42 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace Utils {
+    /**
+     * @brief Read-only view of a whole file mapped into memory
+     * @warning The mapping is released by the destructor, every pointer or
+     *          view taken from data() dangles afterwards.
+     */
+    class MappedFile {
+      public:
+        MappedFile();
+        explicit MappedFile(const std::string &path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile &other) = delete;
+        MappedFile &operator=(const MappedFile &other) = delete;
+        MappedFile(MappedFile &&other) noexcept;
+        MappedFile &operator=(MappedFile &&other) noexcept;
+
+        void open(const std::string &path);
+        void close();
+
+        bool isOpen() const;
+        const char *data() const;
+        std::size_t size() const;
+        std::string_view view() const;
+        std::string path() const;
+
+      private:
+        std::string _path;
+        const char *_data;
+        std::size_t _size;
+        bool _mapped;
+    };
+} // namespace Utils
+
+#endif // MAPPED_FILE_HPP
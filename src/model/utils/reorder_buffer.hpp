@@ -0,0 +1,104 @@
+#ifndef REORDER_BUFFER_HPP
+#define REORDER_BUFFER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Utils {
+    /**
+     * @brief Values numbered 0, 1, 2, ... stored in any order and taken in
+     *        order, through a ring of capacity slots shared between threads
+     *    - put() waits while its index is capacity or more ahead of the next
+     *      one to take, so a slow value holds back the producers instead of
+     *      growing memory
+     *    - Every index is put once; after close(), put() refuses new values
+     *      and take() returns the stored ones up to the first missing index
+     */
+    template <typename T>
+    class ReorderBuffer {
+      public:
+        explicit ReorderBuffer(std::size_t capacity)
+            : _slots(capacity)
+            , _next(0)
+            , _isClosed(false) {
+            if (capacity == 0) throw std::runtime_error("Buffer capacity must be positive");
+        }
+
+        ReorderBuffer(const ReorderBuffer &other) = delete;
+        ReorderBuffer &operator=(const ReorderBuffer &other) = delete;
+
+        /**
+         * @return false if the buffer was closed, the value is then dropped
+         */
+        bool put(std::size_t index, T value) {
+            std::unique_lock<std::mutex> lock(this->_mutex);
+            this->_notFull.wait(lock, [this, index]() {
+                return this->_isClosed || index < this->_next + this->_slots.size();
+            });
+            if (this->_isClosed) return false;
+
+            auto &slot = this->_slots[index % this->_slots.size()];
+            slot.value = std::move(value);
+            slot.isFilled = true;
+            bool isNext = index == this->_next;
+            lock.unlock();
+            if (isNext) this->_ready.notify_one();
+            return true;
+        }
+
+        /**
+         * @return false once the buffer is closed and the next value is missing
+         */
+        bool take(T &value) {
+            std::unique_lock<std::mutex> lock(this->_mutex);
+            auto &slot = this->_slots[this->_next % this->_slots.size()];
+            this->_ready.wait(lock, [this, &slot]() { return this->_isClosed || slot.isFilled; });
+            if (!slot.isFilled) return false;
+
+            value = std::move(slot.value);
+            slot.isFilled = false;
+            this->_next++;
+            lock.unlock();
+            this->_notFull.notify_all();
+            return true;
+        }
+
+        void close() {
+            {
+                std::lock_guard<std::mutex> lock(this->_mutex);
+                this->_isClosed = true;
+            }
+            this->_notFull.notify_all();
+            this->_ready.notify_all();
+        }
+
+        /**
+         * @brief Index of the next value to take
+         */
+        std::size_t next() const {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            return this->_next;
+        }
+
+        std::size_t capacity() const { return this->_slots.size(); }
+
+      private:
+        struct Slot {
+            T value{};
+            bool isFilled = false;
+        };
+
+        mutable std::mutex _mutex;
+        std::condition_variable _notFull;
+        std::condition_variable _ready;
+        std::vector<Slot> _slots;
+        std::size_t _next;
+        bool _isClosed;
+    };
+} // namespace Utils
+
+#endif // REORDER_BUFFER_HPP
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <controller/cli/cli.hpp>
+
+TEST(CLIControllerTest, BatchReplaysOneGamePerLine) {
+    std::istringstream in("# comment\n"
+                          "f3 e5 g4 Qh4#\n"
+                          "\n"
+                          "startpos moves 1. e2e4 e7e5 2. Ng1f3 *\n"
+                          "fen 7k/8/6K1/8/8/8/6Q1/8 w - - 0 1 moves Qb7 Kg8 Qg7#\n"
+                          "fen 7k/8/6K1/8/8/8/8/8 w - - 0 1\n");
+    std::ostringstream out;
+    Controller::CLI controller;
+
+    EXPECT_EQ(controller.batch(in, out), 0);
+    EXPECT_EQ(out.str(), "1 0-1 ENDED_CHECKMATE 4 "
+                         "rnb1kbnr/pppp1ppp/8/4p3/6Pq/5P2/PPPPP2P/RNBQKBNR w KQkq - 1 3\n"
+                         "2 * IN_PROGRESS 3 "
+                         "rnbqkbnr/pppp1ppp/8/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R b KQkq - 1 2\n"
+                         "3 1-0 ENDED_CHECKMATE 3 6k1/6Q1/6K1/8/8/8/8/8 b - - 3 2\n"
+                         "4 1/2-1/2 ENDED_INSUFFICIENT_MATERIAL 0 7k/8/6K1/8/8/8/8/8 w - - 0 1\n");
+}
+
+TEST(CLIControllerTest, BatchReportsErrorsAndGoesOn) {
+    std::istringstream in("e4 e5 Ke3\n"
+                          "fen 8/8/8 w - -\n"
+                          "d4\n");
+    std::ostringstream out;
+    Controller::CLI controller;
+
+    EXPECT_EQ(controller.batch(in, out), 2);
+
+    std::istringstream lines(out.str());
+    std::string line;
+    std::getline(lines, line);
+    EXPECT_EQ(line.rfind("1 error 2 Ke3: ", 0), 0) << line;
+    std::getline(lines, line);
+    EXPECT_EQ(line.rfind("2 error 0 -: Invalid FEN", 0), 0) << line;
+    std::getline(lines, line);
+    EXPECT_EQ(line, "3 * IN_PROGRESS 1 rnbqkbnr/pppppppp/8/8/3P4/8/PPP1PPPP/RNBQKBNR b KQkq d3 0 1");
+}
+
+TEST(CLIControllerTest, BatchTakesFenClocksOnlyWhenNumbers) {
+    std::istringstream in("fen rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - e4 e5 Nf3\n"
+                          "fen 7k/8/6K1/8/8/8/6Q1/8 w - - 5 Qb7\n");
+    std::ostringstream out;
+    Controller::CLI controller;
+
+    EXPECT_EQ(controller.batch(in, out), 0);
+    EXPECT_EQ(out.str(), "1 * IN_PROGRESS 3 "
+                         "rnbqkbnr/pppp1ppp/8/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R b KQkq - 1 2\n"
+                         "2 * IN_PROGRESS 1 7k/1Q6/6K1/8/8/8/8/8 b - - 6 1\n");
+}
@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+#include <controller/uci/uci.hpp>
+
+namespace {
+    /**
+     * @brief Input stream fed line by line from the test thread
+     */
+    class Pipe : public std::streambuf {
+      public:
+        void send(const std::string &line) {
+            {
+                std::lock_guard<std::mutex> lock(this->_mutex);
+                this->_pending += line + '\n';
+            }
+            this->_ready.notify_one();
+        }
+
+        void close() {
+            {
+                std::lock_guard<std::mutex> lock(this->_mutex);
+                this->_isClosed = true;
+            }
+            this->_ready.notify_one();
+        }
+
+      protected:
+        int_type underflow() override {
+            std::unique_lock<std::mutex> lock(this->_mutex);
+            this->_ready.wait(lock, [this]() { return this->_isClosed || !this->_pending.empty(); });
+            if (this->_pending.empty()) return traits_type::eof();
+
+            this->_buffer.swap(this->_pending);
+            this->_pending.clear();
+            this->setg(this->_buffer.data(), this->_buffer.data(),
+                       this->_buffer.data() + this->_buffer.size());
+            return traits_type::to_int_type(this->_buffer[0]);
+        }
+
+      private:
+        std::mutex _mutex;
+        std::condition_variable _ready;
+        std::string _pending;
+        std::string _buffer;
+        bool _isClosed = false;
+    };
+
+    /**
+     * @brief Output stream that can be read while the writer thread writes
+     */
+    class Sink : public std::streambuf {
+      public:
+        std::string str() {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            return this->_text;
+        }
+
+        bool waitFor(const std::string &text) {
+            for (int i = 0; i < 1000; ++i) {
+                if (this->str().find(text) != std::string::npos) return true;
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return false;
+        }
+
+      protected:
+        int_type overflow(int_type c) override {
+            if (traits_type::eq_int_type(c, traits_type::eof())) return c;
+
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            this->_text += traits_type::to_char_type(c);
+            return c;
+        }
+
+        std::streamsize xsputn(const char *data, std::streamsize size) override {
+            std::lock_guard<std::mutex> lock(this->_mutex);
+            this->_text.append(data, size);
+            return size;
+        }
+
+      private:
+        std::mutex _mutex;
+        std::string _text;
+    };
+
+    std::vector<std::string> lines(const std::string &text) {
+        std::vector<std::string> result;
+        std::istringstream stream(text);
+        for (std::string line; std::getline(stream, line);) result.push_back(line);
+        return result;
+    }
+
+    std::string run(const std::string &commands) {
+        std::istringstream in(commands);
+        std::ostringstream out;
+        {
+            Controller::UCI uci(in, out);
+            uci.start();
+        }
+        return out.str();
+    }
+} // namespace
+
+TEST(UCITest, Handshake) {
+    auto output = lines(run("uci\nisready\n"));
+
+    ASSERT_GE(output.size(), 3);
+    EXPECT_EQ(output[0].rfind("id name", 0), 0);
+    EXPECT_NE(std::find(output.begin(), output.end(), "uciok"), output.end());
+    EXPECT_EQ(output.back(), "readyok");
+}
+
+TEST(UCITest, GoDepthFindsMate) {
+    auto output = lines(run("position fen 6k1/5ppp/8/8/8/8/8/R3K3 w - - 0 1\ngo depth 2\n"));
+
+    ASSERT_GE(output.size(), 2);
+    EXPECT_EQ(output[output.size() - 2].rfind("info depth 2 score mate 1", 0), 0)
+        << output[output.size() - 2];
+    EXPECT_EQ(output.back(), "bestmove a1a8");
+}
+
+TEST(UCITest, PositionWithMoves) {
+    auto output = lines(run("position startpos moves e2e4 e7e5 g1f3 b8c6 f1c4 g8f6\n"
+                            "go depth 1\n"));
+
+    ASSERT_FALSE(output.empty());
+    EXPECT_EQ(output.back().rfind("bestmove ", 0), 0);
+    EXPECT_EQ(output.back().size(), std::string("bestmove e1g1").size());
+
+    output = lines(run("position startpos moves e2e5\n"));
+    ASSERT_EQ(output.size(), 1);
+    EXPECT_EQ(output[0].rfind("info string", 0), 0);
+}
+
+TEST(UCITest, StopInterruptsInfiniteSearch) {
+    Pipe pipe;
+    Sink sink;
+    std::istream in(&pipe);
+    std::ostream out(&sink);
+    Controller::UCI uci(in, out);
+    std::thread reader([&uci]() { uci.start(); });
+
+    pipe.send("position startpos");
+    pipe.send("go infinite");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(sink.str().find("bestmove"), std::string::npos);
+
+    auto stopped = std::chrono::steady_clock::now();
+    pipe.send("stop");
+    EXPECT_TRUE(sink.waitFor("bestmove "));
+    auto elapsed = std::chrono::steady_clock::now() - stopped;
+    pipe.send("quit");
+    reader.join();
+
+    EXPECT_LT(elapsed, std::chrono::milliseconds(50));
+}
+
+TEST(UCITest, StopRightAfterGo) {
+    // A stop handled before the search thread starts must not be lost
+    const int nSearches = 200;
+    std::string commands = "position startpos\n";
+    for (int i = 0; i < nSearches; ++i) commands += "go infinite\nstop\n";
+    auto output = lines(run(commands));
+    auto mcts = lines(run("setoption name UseMCTS value true\n" + commands));
+    output.insert(output.end(), mcts.begin(), mcts.end());
+
+    auto isBestMove = [](const std::string &line) { return line.rfind("bestmove ", 0) == 0; };
+    EXPECT_EQ(std::count_if(output.begin(), output.end(), isBestMove), 2 * nSearches);
+}
+
+TEST(UCITest, PonderWaitsForPonderHit) {
+    Pipe pipe;
+    Sink sink;
+    std::istream in(&pipe);
+    std::ostream out(&sink);
+    Controller::UCI uci(in, out);
+    std::thread reader([&uci]() { uci.start(); });
+
+    pipe.send("position startpos");
+    pipe.send("go ponder depth 1 wtime 1000 btime 1000");
+    pipe.send("isready");
+    EXPECT_TRUE(sink.waitFor("readyok"));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(sink.str().find("bestmove"), std::string::npos);
+
+    pipe.send("ponderhit");
+    EXPECT_TRUE(sink.waitFor("bestmove "));
+    pipe.close();
+    reader.join();
+}
+
+TEST(UCITest, SetOption) {
+    auto output = lines(run("setoption name NullMove value false\n"
+                            "setoption name Unknown Thing value 3\n"));
+
+    ASSERT_EQ(output.size(), 1);
+    EXPECT_EQ(output[0], "info string Unknown option: name='Unknown Thing'");
+}
+
+TEST(UCITest, UseMCTS) {
+    auto output = lines(run("setoption name UseMCTS value true\n"
+                            "position fen 6k1/5ppp/8/8/8/8/8/R3K3 w - - 0 1\ngo nodes 400\n"));
+
+    ASSERT_GE(output.size(), 2);
+    EXPECT_NE(output[output.size() - 2].find("score mate 1"), std::string::npos)
+        << output[output.size() - 2];
+    EXPECT_EQ(output.back(), "bestmove a1a8");
+}
@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#include <model/archive/archive.hpp>
+#include <model/notation/notation.hpp>
+
+class ArchiveTest : public ::testing::Test {
+  protected:
+    std::string path;
+
+    void SetUp() override {
+        path = (std::filesystem::temp_directory_path() / "archive_test.bin").string();
+    }
+
+    void TearDown() override { std::filesystem::remove(path); }
+
+    static constexpr const char *GAMES = R"([Event "Casual"]
+[White "Alice \"A\""]
+[Result "1-0"]
+
+1. e4 e5 2. Nf3 Nc6 3. Bb5 a6 4. Ba4 Nf6 5. O-O Be7 6. Re1 b5 7. Bb3 d6 8. c3
+O-O 9. h3 Nb8 10. d4 Nbd7 11. c4 c6 12. cxb5 axb5 13. Nc3 Bb7 14. Bg5 b4
+15. Nb1 h6 16. Bh4 c5 17. dxe5 Nxe4 18. Bxe7 Qxe7 19. exd6 Qf6 1-0
+
+[FEN "4k3/1P6/8/8/8/8/8/4K3 b - - 0 40"]
+[Result "1/2-1/2"]
+
+40... Kd7 41. b8=N+ 1/2-1/2
+
+*
+
+)";
+};
+
+TEST_F(ArchiveTest, Varint) {
+    for (std::uint64_t value : {0ULL, 1ULL, 127ULL, 128ULL, 300ULL, 1ULL << 40, ~0ULL}) {
+        std::string out;
+        Archive::appendVarint(out, value);
+        const char *cursor = out.data();
+        std::uint64_t decoded = 0;
+
+        ASSERT_TRUE(Archive::readVarint(cursor, out.data() + out.size(), decoded));
+        EXPECT_EQ(decoded, value);
+        EXPECT_EQ(cursor, out.data() + out.size());
+        EXPECT_EQ(out.size(), value < 128 ? 1 : out.size());
+    }
+    std::string truncated = "\x80";
+    const char *cursor = truncated.data();
+    std::uint64_t decoded = 0;
+    EXPECT_FALSE(Archive::readVarint(cursor, truncated.data() + 1, decoded));
+}
+
+TEST_F(ArchiveTest, WriteAndReadRecords) {
+    {
+        Archive::Writer writer(path);
+        for (std::uint16_t i = 0; i < 2 * Archive::BLOCK_SIZE + 3; ++i) {
+            Archive::Record record;
+            record.tags = {{"Round", "1"}};
+            record.result = (i % 2 == 0) ? "1-0" : "0-1";
+            record.moves = {i, static_cast<std::uint16_t>(i + 1)};
+            writer.write(record);
+        }
+        EXPECT_EQ(writer.size(), 2 * Archive::BLOCK_SIZE + 3);
+    }
+    Archive::Reader reader(path);
+
+    ASSERT_EQ(reader.size(), 2 * Archive::BLOCK_SIZE + 3);
+    for (std::size_t i : {std::size_t(0), std::size_t(1), Archive::BLOCK_SIZE + 7,
+                          2 * Archive::BLOCK_SIZE + 2}) {
+        auto record = reader.record(i);
+        ASSERT_EQ(record.tags.size(), 1);
+        EXPECT_EQ(record.tags[0].first, "Round");
+        EXPECT_EQ(record.tags[0].second, "1");
+        EXPECT_EQ(record.result, (i % 2 == 0) ? "1-0" : "0-1");
+        EXPECT_EQ(record.moves, (std::vector<std::uint16_t>{static_cast<std::uint16_t>(i),
+                                                            static_cast<std::uint16_t>(i + 1)}));
+    }
+    EXPECT_THROW(reader.record(reader.size()), std::runtime_error);
+}
+
+TEST_F(ArchiveTest, RoundTripWithPGN) {
+    {
+        Archive::Writer writer(path);
+        Archive::Importer importer(writer);
+        EXPECT_EQ(PGN::Reader::read(GAMES, importer), 3);
+        EXPECT_EQ(importer.nErrors(), 0);
+    }
+    Archive::Reader reader(path);
+    ASSERT_EQ(reader.size(), 3);
+    EXPECT_LT(std::filesystem::file_size(path), std::string_view(GAMES).size() / 2);
+
+    std::ostringstream out;
+    PGN::Writer writer(out);
+    for (std::size_t i = 0; i < reader.size(); ++i) reader.replay(i, writer);
+
+    EXPECT_EQ(out.str(), GAMES);
+}
+
+TEST_F(ArchiveTest, ReplayOnBoard) {
+    {
+        Archive::Writer writer(path);
+        Archive::Importer importer(writer);
+        PGN::Reader::read("1. e4 e5 2. Nf3 Nc6 1-0\n1. e4 Ke2 0-1\n1. d4 *", importer);
+        EXPECT_EQ(importer.nErrors(), 1);
+    }
+    Archive::Reader reader(path);
+    ASSERT_EQ(reader.size(), 2);
+
+    Game::Board board(8, 8);
+    Pieces::Player first("White"), second("Black");
+    Archive::Reader::replay(reader.record(0), board, first, second);
+
+    EXPECT_EQ(board.fen(), "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3");
+
+    auto record = reader.record(1);
+    EXPECT_EQ(record.result, "*");
+    record.moves.push_back(200);
+    EXPECT_THROW(Archive::Reader::replay(record, board, first, second), std::runtime_error);
+}
+
+TEST_F(ArchiveTest, OpenInvalidArchive) {
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "not an archive at all, not an archive at all";
+    }
+
+    EXPECT_THROW(Archive::Reader reader(path), std::runtime_error);
+    EXPECT_THROW(Archive::Reader reader(path + ".missing"), std::runtime_error);
+}
+
+TEST_F(ArchiveTest, ReplayFenGamesOnAnyBoard) {
+    std::vector<std::pair<std::string, std::vector<std::string>>> games = {
+        {"4k3/1P6/8/8/8/8/8/4K3 w - - 0 1", {"b8=Q+", "Kd7", "Qb7+", "Ke6", "Qc6+"}},
+        {"8/8/8/8/8/k7/6p1/4K3 b - - 0 1", {"g1=Q+", "Kd2", "Qf2+", "Kd3", "Qf3+"}},
+        {"r3k3/1P6/8/8/8/8/8/4K3 w q - 0 1", {"bxa8=N", "Kd7", "Nb6+"}},
+        {"4k3/8/8/8/8/8/8/R2QK3 w - - 0 1", {"Kf2", "Kf7"}},
+        {"4k3/PP6/8/8/8/8/8/4K3 w - - 0 1", {"b8=R+", "Kd7", "a8=Q", "Ke6", "Rb6+"}},
+        {std::string(PGN::STANDARD_FEN), {"e4", "e5", "Nf3"}},
+        {"4k3/8/8/8/8/8/8/R3K2R w KQ - 0 1", {"O-O", "Kd7", "Rfe1"}}};
+    std::string pgn;
+    std::vector<std::string> fens;
+    Pieces::Player first("White"), second("Black");
+    for (auto &[fen, sans] : games) {
+        Game::Board board(8, 8);
+        board.initialize(first, second, fen);
+        pgn += "[FEN \"" + fen + "\"]\n\n";
+        int number = std::stoi(fen.substr(fen.rfind(' ') + 1));
+        for (std::size_t ply = 0; ply < sans.size(); ++ply) {
+            bool isWhite = board.turn() == &first;
+            if (isWhite || ply == 0) pgn += std::to_string(number) + (isWhite ? ". " : "... ");
+            board.move(Notation::SAN::parse(board, sans[ply]));
+            pgn += sans[ply] + ' ';
+            if (!isWhite) number++;
+        }
+        pgn += "*\n\n";
+        fens.push_back(board.fen());
+    }
+    {
+        Archive::Writer writer(path);
+        Archive::Importer importer(writer);
+        EXPECT_EQ(PGN::Reader::read(pgn, importer), games.size());
+        EXPECT_EQ(importer.nErrors(), 0);
+    }
+    Archive::Reader reader(path);
+    ASSERT_EQ(reader.size(), games.size());
+
+    // Spare pieces left by previous games must not change the decoding
+    Game::Board reused(8, 8);
+    for (std::size_t i = 0; i < reader.size(); ++i) {
+        Game::Board fresh(8, 8);
+        Archive::Reader::replay(reader.record(i), fresh, first, second);
+        EXPECT_EQ(fresh.fen(), fens[i]);
+
+        Archive::Reader::replay(reader.record(i), reused, first, second);
+        EXPECT_EQ(reused.fen(), fens[i]);
+    }
+}
+
+TEST_F(ArchiveTest, OpenCorruptedFooter) {
+    {
+        Archive::Writer writer(path);
+        Archive::Record record;
+        for (int i = 0; i < 3; ++i) writer.write(record);
+    }
+    std::string valid;
+    {
+        std::ifstream file(path, std::ios::binary);
+        valid.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    auto open = [this](const std::string &content) {
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file << content;
+        }
+        Archive::Reader reader(path);
+    };
+    auto withGames = [](std::string content, std::uint64_t nGames) {
+        for (int i = 0; i < 8; ++i) {
+            content[content.size() - 12 + i] = static_cast<char>((nGames >> (8 * i)) & 0xFF);
+        }
+        return content;
+    };
+    EXPECT_NO_THROW(open(valid));
+    EXPECT_THROW(open(withGames(valid, 0)), std::runtime_error);
+    EXPECT_THROW(open(withGames(valid, Archive::BLOCK_SIZE + 1)), std::runtime_error);
+    EXPECT_THROW(open(withGames(valid, ~0ULL - Archive::BLOCK_SIZE + 2)), std::runtime_error);
+    EXPECT_THROW(open(valid.substr(0, valid.size() - 1)), std::runtime_error);
+
+    // Without any game the index is empty, an overflowing count must not match it
+    Archive::Writer(path).close();
+    std::ifstream file(path, std::ios::binary);
+    std::string empty((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_NO_THROW(open(empty));
+    EXPECT_THROW(open(withGames(empty, ~0ULL - Archive::BLOCK_SIZE + 2)), std::runtime_error);
+}
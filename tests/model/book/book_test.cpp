@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include <model/book/book.hpp>
+#include <model/notation/notation.hpp>
+
+class BookTest : public ::testing::Test {
+  protected:
+    Game::Board board;
+    Pieces::Player player1{"White"};
+    Pieces::Player player2{"Black"};
+    std::string path;
+
+    void SetUp() override {
+        board = Game::Board(8, 8);
+        board.initialize(player1, player2, "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+        path = (std::filesystem::temp_directory_path() / "book_test.bin").string();
+    }
+
+    void TearDown() override { std::filesystem::remove(path); }
+
+    std::uint16_t encode(std::string_view san) {
+        return Book::encodeMove(Notation::SAN::parse(board, san));
+    }
+};
+
+TEST_F(BookTest, EncodeMove) {
+    EXPECT_EQ(encode("e4"), 4 | (3 << 3) | (4 << 6) | (1 << 9));
+    EXPECT_EQ(encode("Nf3"), 5 | (2 << 3) | (6 << 6));
+
+    board.initialize(player1, player2, "r3k2r/1P6/8/8/8/8/8/R3K2R w KQkq - 0 1");
+
+    EXPECT_EQ(encode("O-O"), 7 | (4 << 6));
+    EXPECT_EQ(encode("O-O-O"), 0 | (4 << 6));
+    EXPECT_EQ(encode("b8=N"), 1 | (7 << 3) | (1 << 6) | (6 << 9) | (1 << 12));
+    EXPECT_EQ(encode("bxa8=Q"), 0 | (7 << 3) | (1 << 6) | (6 << 9) | (4 << 12));
+}
+
+TEST_F(BookTest, PolyglotKeys) {
+    // Test keys published with the Polyglot book format
+    EXPECT_EQ(Book::key(board), 0x463B96181691FC9CULL);
+
+    board.move(Notation::SAN::parse(board, "e4"));
+    EXPECT_EQ(Book::key(board), 0x823C9B50FD114196ULL);
+
+    for (auto san : {"d5", "e5", "f5"}) board.move(Notation::SAN::parse(board, san));
+    EXPECT_EQ(Book::key(board), 0x22A48B5A8E47FF78ULL);
+}
+
+TEST_F(BookTest, KeyLayout) {
+    auto defaults = Book::keys();
+    Book::Keys keys{};
+    keys[780] = 1;
+    keys[64 * (2 * 5 + 1) + 4] = 2;
+    keys[64 * (2 * 5) + 8 * 7 + 4] = 4;
+    keys[768] = 8;
+    keys[771] = 16;
+    keys[772 + 4] = 32;
+    Book::keys(keys);
+
+    EXPECT_EQ(Book::key(board), 1 | 2 | 4 | 8 | 16);
+
+    board.initialize(player1, player2, "4k3/8/8/8/3pP3/8/8/4K3 b - e3 0 1");
+    EXPECT_EQ(Book::key(board), 2 | 4 | 32);
+
+    board.initialize(player1, player2, "4k3/8/8/8/2p1P3/8/8/4K3 b - e3 0 1");
+    EXPECT_EQ(Book::key(board), 2 | 4);
+
+    board.initialize(player1, player2, "4k3/8/8/8/4Pp2/8/8/4K3 b - e3 0 1");
+    EXPECT_EQ(Book::key(board), 2 | 4 | 32);
+
+    Book::keys(defaults);
+}
+
+TEST_F(BookTest, ProbeBook) {
+    auto start = Book::key(board);
+    auto e4 = encode("e4"), d4 = encode("d4");
+    Book::Polyglot::write(path, {{start + 1, e4, 1, 0},
+                                 {start, d4, 5, 0},
+                                 {start, e4, 10, 0},
+                                 {start, static_cast<std::uint16_t>(encode("Nf3") ^ 0x40), 99, 0},
+                                 {start - 1, d4, 1, 0}});
+    Book::Polyglot book(path);
+
+    EXPECT_EQ(book.size(), 5);
+    EXPECT_EQ(book.probe(start).size(), 3);
+    EXPECT_TRUE(book.probe(start + 2).empty());
+
+    auto moves = book.moves(board);
+    ASSERT_EQ(moves.size(), 2);
+    EXPECT_EQ(moves[0].second, 5);
+    EXPECT_EQ(Book::encodeMove(book.best(board)), e4);
+
+    std::mt19937_64 generator(42);
+    int nE4 = 0;
+    for (int i = 0; i < 300; ++i) {
+        auto move = book.random(board, generator);
+        nE4 += Book::encodeMove(move) == e4;
+    }
+    EXPECT_GT(nE4, 150);
+    EXPECT_LT(nE4, 250);
+
+    board.move(Notation::SAN::parse(board, "e4"));
+    EXPECT_TRUE(book.moves(board).empty());
+    EXPECT_TRUE(book.best(board).actions().empty());
+}
+
+TEST_F(BookTest, OpenInvalidBook) {
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "not a book";
+    }
+
+    EXPECT_THROW(Book::Polyglot book(path), std::runtime_error);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include <model/explorer/explorer.hpp>
+
+class ExplorerTest : public ::testing::Test {
+  protected:
+    std::string archivePath;
+    std::string indexPath;
+
+    void SetUp() override {
+        auto directory = std::filesystem::temp_directory_path();
+        archivePath = (directory / "explorer_test.bin").string();
+        indexPath = (directory / "explorer_test.idx").string();
+
+        Archive::Writer writer(archivePath);
+        Archive::Importer importer(writer);
+        PGN::Reader::read(R"(1. e4 e5 2. Nf3 Nc6 1-0
+1. Nf3 Nc6 2. e4 e5 0-1
+1. e4 c5 2. Nf3 1/2-1/2
+1. d4 d5 *
+1. e4 e5 2. Nf3 Nc6 3. Bb5 1-0
+)",
+                          importer);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(archivePath);
+        std::filesystem::remove(indexPath);
+    }
+};
+
+TEST_F(ExplorerTest, BuildAndQuery) {
+    Archive::Reader archive(archivePath);
+    Explorer::Builder builder(Explorer::Builder::Options{3, 7, ""});
+
+    EXPECT_EQ(builder.build(archive, indexPath), 4 + 4 + 3 + 2 + 5 + 5);
+
+    Explorer::Index index(indexPath);
+    EXPECT_EQ(index.size(), 23);
+
+    Game::Board board(8, 8);
+    Pieces::Player first("White"), second("Black");
+    board.initialize(first, second, PGN::STANDARD_FEN);
+    auto start = index.query(board.hash());
+
+    EXPECT_EQ(start.nGames(), 5);
+    EXPECT_EQ(start.counts, (Explorer::Counts{1, 2, 1, 1}));
+    EXPECT_EQ(start.games, (std::vector<std::uint32_t>{0, 1, 2, 3, 4}));
+    ASSERT_EQ(start.moves.size(), 3);
+    EXPECT_EQ(start.moves[0].counts, (Explorer::Counts{0, 2, 0, 1}));
+    Pieces::Move move;
+    ASSERT_TRUE(Explorer::decodeMove(board, start.moves[0].code, move));
+    EXPECT_EQ(move.to(), Position(3, 4));
+
+    // Reached by transposition in games 0, 1 and 4
+    board.initialize(first, second,
+                     "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3");
+    auto transposed = index.query(board.hash());
+
+    EXPECT_EQ(transposed.games, (std::vector<std::uint32_t>{0, 1, 4}));
+    EXPECT_EQ(transposed.counts, (Explorer::Counts{0, 2, 1, 0}));
+    ASSERT_EQ(transposed.moves.size(), 1);
+    EXPECT_EQ(transposed.moves[0].counts, (Explorer::Counts{0, 1, 0, 0}));
+
+    EXPECT_EQ(index.query(0).nGames(), 0);
+
+    for (auto &entry : std::filesystem::directory_iterator(std::filesystem::temp_directory_path())) {
+        auto name = entry.path().filename().string();
+        EXPECT_FALSE(name.rfind("explorer_test.idx.", 0) == 0) << name;
+    }
+}
+
+TEST_F(ExplorerTest, ExploreFromGame) {
+    Archive::Reader archive(archivePath);
+    Explorer::Builder().build(archive, indexPath);
+    Explorer::Index index(indexPath);
+
+    Game::Game game;
+    std::string white = "White", black = "Black";
+    game.start(white, black, std::string(PGN::STANDARD_FEN));
+    game.move("e4");
+    auto stats = game.explore(index);
+
+    EXPECT_EQ(stats.nGames(), 3);
+    ASSERT_EQ(stats.moves.size(), 2);
+    EXPECT_EQ(stats.moves[0].san, "e5");
+    EXPECT_EQ(stats.moves[1].san, "c5");
+}
+
+TEST_F(ExplorerTest, TranspositionWithSwappedPieces) {
+    // The second game brings the Rooks back to a1 and h1 the other way round
+    std::string fen = "4k3/8/8/8/8/4K3/8/R6R w - - 0 1";
+    Archive::Writer writer(archivePath);
+    Archive::Importer importer(writer);
+    PGN::Reader::read("[FEN \"" + fen + "\"]\n\n1. Ra2 *\n\n"
+                      "[FEN \"" + fen + "\"]\n\n"
+                      "1. Ra2 Kd8 2. Rha1 Ke8 3. Rh2 Kd8 4. Rhh1 Ke8 5. Ra2 *\n\n"
+                      "[FEN \"" + fen + "\"]\n\n"
+                      "1. Ra2 Kd8 2. Rha1 Ke8 3. Rh2 Kd8 4. Rhh1 Ke8 5. Rh2 *\n",
+                      importer);
+    writer.close();
+
+    Archive::Reader archive(archivePath);
+    Explorer::Builder().build(archive, indexPath);
+    Explorer::Index index(indexPath);
+
+    Game::Game game;
+    std::string white = "White", black = "Black";
+    game.start(white, black, fen);
+    auto stats = game.explore(index);
+
+    EXPECT_EQ(stats.nGames(), 3);
+    ASSERT_EQ(stats.moves.size(), 2);
+    EXPECT_EQ(stats.moves[0].san, "Ra2");
+    EXPECT_EQ(stats.moves[0].counts, (Explorer::Counts{4, 0, 0, 0}));
+    EXPECT_EQ(stats.moves[1].san, "Rh2");
+    EXPECT_EQ(stats.moves[1].counts, (Explorer::Counts{1, 0, 0, 0}));
+}
+
+TEST_F(ExplorerTest, OpenInvalidIndex) {
+    EXPECT_THROW(Explorer::Index index(archivePath), std::runtime_error);
+    EXPECT_THROW(Explorer::Index index(indexPath), std::runtime_error);
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <array>
+
 #include <model/game/game.hpp>
 
 class BoardTest : public ::testing::Test {
@@ -261,3 +263,275 @@ TEST_F(BoardTest, Serialize) {
     EXPECT_EQ(*piece77, Pieces::Rook(Position(7, 7), &player2));
     EXPECT_EQ(serialized[4][4], nullptr);
 }
+
+static std::uint64_t perft(Game::Board &board, int depth) {
+    auto moves = board.legalMoves();
+    if (depth == 1) return moves.size();
+
+    std::uint64_t nodes = 0;
+    for (auto &move : moves) {
+        board.move(move);
+        nodes += perft(board, depth - 1);
+        board.unMove();
+    }
+    return nodes;
+}
+
+TEST_F(BoardTest, FenOfInitialPosition) {
+    EXPECT_EQ(board.fen(), "rnbkqbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+}
+
+TEST_F(BoardTest, FenRoundTrip) {
+    std::vector<std::string> fens = {
+        "rnbkqbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+        "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+        "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3",
+        "4k3/8/8/8/8/8/8/4K2R b K - 12 40"};
+
+    for (auto &fen : fens) {
+        board.initialize(player1, player2, fen);
+
+        EXPECT_EQ(board.fen(), fen);
+        EXPECT_EQ(board.status(), Game::Status::IN_PROGRESS);
+    }
+}
+
+TEST_F(BoardTest, FenPerft) {
+    std::vector<std::tuple<std::string, int, std::uint64_t>> cases = {
+        {"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", 1, 48},
+        {"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", 2, 2039},
+        {"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", 3, 2812},
+        {"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1", 2, 264},
+        {"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8", 2, 1486}};
+
+    for (auto &[fen, depth, nodes] : cases) {
+        board.initialize(player1, player2, fen);
+
+        EXPECT_EQ(perft(board, depth), nodes) << fen;
+        EXPECT_EQ(board.fen(), fen);
+    }
+}
+
+TEST_F(BoardTest, LegalMovesByGeneration) {
+    using Generation = Game::Board::Generation;
+    std::array<Pieces::Move, 256> buffer;
+    for (auto fen : {"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+                     "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1"}) {
+        board.initialize(player1, player2, fen);
+        // Before and after the legal moves are cached
+        for (int pass = 0; pass < 2; ++pass) {
+            auto nTactical = board.legalMoves(Generation::TACTICAL, buffer.data(), buffer.size());
+            for (std::size_t i = 0; i < nTactical; ++i) {
+                EXPECT_TRUE(buffer[i].captured() != nullptr || buffer[i].promoted() != nullptr);
+                EXPECT_TRUE(board.isPlayable(buffer[i]));
+            }
+            auto nQuiet = board.legalMoves(Generation::QUIET, buffer.data(), buffer.size());
+            for (std::size_t i = 0; i < nQuiet; ++i) {
+                EXPECT_TRUE(buffer[i].captured() == nullptr && buffer[i].promoted() == nullptr);
+            }
+            EXPECT_EQ(nTactical + nQuiet, board.legalMoves().size()) << fen;
+            EXPECT_EQ(board.legalMoves(Generation::ALL, buffer.data(), buffer.size()),
+                      board.legalMoves().size());
+        }
+    }
+    EXPECT_THROW(board.legalMoves(Generation::ALL, buffer.data(), 1), std::runtime_error);
+}
+
+TEST_F(BoardTest, IsPlayable) {
+    auto *knight = board.serialize()[0][1];
+    EXPECT_TRUE(board.isPlayable(Pieces::Move::createMove(*knight, Position(0, 1),
+                                                          Position(2, 2))));
+    EXPECT_FALSE(board.isPlayable(Pieces::Move::createMove(*knight, Position(0, 1),
+                                                           Position(3, 3))));
+    EXPECT_FALSE(board.isPlayable(Pieces::Move()));
+}
+
+TEST_F(BoardTest, FenEnPassant) {
+    board.initialize(player1, player2,
+                     "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3");
+    auto *pawn = board.serialize()[4][4];
+    auto *victim = board.serialize()[4][5];
+
+    Pieces::Move capture;
+    for (auto &move : board.legalMoves()) {
+        if (move.piece() == pawn && move.to() == Position(5, 5)) capture = move;
+    }
+    ASSERT_EQ(capture.captured(), victim);
+
+    board.move(capture);
+    EXPECT_EQ(victim->position(), Position());
+    EXPECT_EQ(board.fen(), "rnbqkbnr/ppp1p1pp/5P2/3p4/8/8/PPPP1PPP/RNBQKBNR b KQkq - 0 3");
+
+    board.unMove();
+    EXPECT_EQ(victim->position(), Position(4, 5));
+    EXPECT_EQ(board.fen(), "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3");
+}
+
+TEST_F(BoardTest, FenClocksFollowMoves) {
+    board.initialize(player1, player2, "4k3/4p3/8/8/8/8/8/R3K3 w Q - 5 20");
+    auto *rook = board.serialize()[0][0];
+
+    board.move(rook, Position(6, 0));
+    EXPECT_EQ(board.fen(), "4k3/R3p3/8/8/8/8/8/4K3 b - - 6 20");
+
+    board.move(board.serialize()[6][4], Position(4, 4));
+    EXPECT_EQ(board.fen(), "4k3/R7/8/4p3/8/8/8/4K3 w - e6 0 21");
+    EXPECT_EQ(board.halfMoves(), 0);
+    EXPECT_EQ(board.fullMoves(), 21);
+}
+
+TEST_F(BoardTest, FenStatus) {
+    board.initialize(player1, player2, "7k/6Q1/6K1/8/8/8/8/8 b - - 0 1");
+    EXPECT_EQ(board.status(), Game::Status::ENDED_CHECKMATE);
+
+    board.initialize(player1, player2, "7k/8/6QK/8/8/8/8/8 b - - 0 1");
+    EXPECT_EQ(board.status(), Game::Status::ENDED_STALEMATE);
+}
+
+TEST_F(BoardTest, FenInvalid) {
+    std::vector<std::string> fens = {
+        "",
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP w KQkq - 0 1",
+        "rnbqkbnr/pppppppp/9/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        "rnbqkbnr/ppppxppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR x KQkq - 0 1",
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KX - 0 1",
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq z9 0 1",
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - x 1",
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 0"};
+
+    for (auto &fen : fens) {
+        EXPECT_THROW(board.initialize(player1, player2, fen), std::runtime_error) << fen;
+    }
+    EXPECT_EQ(board.fen(), "rnbkqbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+}
+
+TEST_F(BoardTest, FenNeedsOneKingPerSide) {
+    std::vector<std::string> fens = {"8/8/8/8/8/8/8/4K3 w - - 0 1", "4k3/8/8/8/8/8/8/8 b - - 0 1",
+                                     "4k3/8/8/8/8/8/8/3KK3 w - - 0 1",
+                                     "3kk3/8/8/8/8/8/8/4K3 w - - 0 1"};
+
+    for (auto &fen : fens) {
+        try {
+            board.initialize(player1, player2, fen);
+            ADD_FAILURE() << fen;
+        } catch (const std::runtime_error &error) {
+            EXPECT_NE(std::string(error.what()).find("placement"), std::string::npos) << fen;
+        }
+    }
+    EXPECT_EQ(board.fen(), "rnbkqbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+}
+
+TEST_F(BoardTest, HashFollowsPosition) {
+    board.initialize(player1, player2, "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+    auto initial = board.hash();
+    auto pieces = board.serialize();
+    auto *knight = pieces[0][6];
+    auto *blackKnight = pieces[7][6];
+
+    board.move(knight, Position(2, 5));
+    auto afterOne = board.hash();
+    EXPECT_NE(afterOne, initial);
+
+    board.move(blackKnight, Position(5, 5));
+    board.move(knight, Position(0, 6));
+    board.move(blackKnight, Position(7, 6));
+    EXPECT_EQ(board.hash(), initial);
+
+    board.unMove();
+    board.unMove();
+    board.unMove();
+    EXPECT_EQ(board.hash(), afterOne);
+
+    Game::Board other(8, 8);
+    Pieces::Player first("A"), second("B");
+    other.initialize(first, second, "rnbqkbnr/pppppppp/8/8/8/5N2/PPPPPPPP/RNBQKB1R b KQkq - 1 1");
+    EXPECT_EQ(other.hash(), afterOne);
+
+    other.initialize(first, second, "rnbqkbnr/pppppppp/8/8/8/5N2/PPPPPPPP/RNBQKB1R w KQkq - 1 1");
+    EXPECT_NE(other.hash(), afterOne);
+
+    other.initialize(first, second, "rnbqkbnr/pppppppp/8/8/8/5N2/PPPPPPPP/RNBQKB1R b Qkq - 1 1");
+    EXPECT_NE(other.hash(), afterOne);
+}
+
+TEST_F(BoardTest, HashIgnoresUncapturableEnPassant) {
+    board.initialize(player1, player2, "4k3/8/8/8/4P3/8/8/4K3 b - e3 0 1");
+    auto withSquare = board.hash();
+    board.initialize(player1, player2, "4k3/8/8/8/4P3/8/8/4K3 b - - 0 1");
+
+    EXPECT_EQ(board.hash(), withSquare);
+
+    board.initialize(player1, player2, "4k3/8/8/8/3pP3/8/8/4K3 b - e3 0 1");
+    withSquare = board.hash();
+    board.initialize(player1, player2, "4k3/8/8/8/3pP3/8/8/4K3 b - - 0 1");
+
+    EXPECT_NE(board.hash(), withSquare);
+}
+
+TEST_F(BoardTest, StatusIsRepetition) {
+    board.initialize(player1, player2, "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+    auto shuffle = [this]() {
+        board.move(board.serialize()[0][6], Position(2, 5));
+        board.move(board.serialize()[7][6], Position(5, 5));
+        board.move(board.serialize()[2][5], Position(0, 6));
+        board.move(board.serialize()[5][5], Position(7, 6));
+    };
+
+    shuffle();
+    EXPECT_EQ(board.repetitions(), 1);
+    EXPECT_EQ(board.status(), Game::Status::IN_PROGRESS);
+
+    shuffle();
+    EXPECT_EQ(board.repetitions(), 2);
+    EXPECT_EQ(board.status(), Game::Status::ENDED_REPETITION);
+
+    // The game can still be replayed past an unclaimed draw
+    board.move(board.serialize()[1][4], Position(3, 4));
+    EXPECT_EQ(board.repetitions(), 0);
+    EXPECT_EQ(board.status(), Game::Status::IN_PROGRESS);
+
+    board.unMove();
+    EXPECT_EQ(board.status(), Game::Status::ENDED_REPETITION);
+    board.unMove();
+    EXPECT_EQ(board.repetitions(), 1);
+    EXPECT_EQ(board.status(), Game::Status::IN_PROGRESS);
+}
+
+TEST_F(BoardTest, RepetitionStopsAtIrreversibleMove) {
+    board.initialize(player1, player2, "4k3/4p3/8/8/8/8/8/R3K3 w - - 0 1");
+    auto shuffle = [this](int row) {
+        board.move(board.serialize()[row][0], Position(row + 1, 0));
+        board.move(board.serialize()[7][4], Position(7, 3));
+        board.move(board.serialize()[row + 1][0], Position(row, 0));
+        board.move(board.serialize()[7][3], Position(7, 4));
+    };
+
+    shuffle(0);
+    board.move(board.serialize()[0][4], Position(0, 3));
+    board.move(board.serialize()[6][4], Position(5, 4));
+    board.move(board.serialize()[0][3], Position(0, 4));
+    board.move(board.serialize()[5][4], Position(4, 4));
+    shuffle(0);
+
+    EXPECT_EQ(board.repetitions(), 1);
+    EXPECT_EQ(board.status(), Game::Status::IN_PROGRESS);
+}
+
+TEST_F(BoardTest, StatusIsFiftyMoves) {
+    board.initialize(player1, player2, "4k3/8/8/8/8/8/8/R3K3 w - - 99 80");
+    EXPECT_EQ(board.status(), Game::Status::IN_PROGRESS);
+
+    board.move(board.serialize()[0][0], Position(1, 0));
+    EXPECT_EQ(board.status(), Game::Status::ENDED_FIFTY_MOVES);
+
+    board.unMove();
+    EXPECT_EQ(board.status(), Game::Status::IN_PROGRESS);
+
+    // A checkmate on the last half-move still wins
+    board.initialize(player1, player2, "6k1/5ppp/8/8/8/8/8/R3K3 w - - 99 80");
+    board.move(board.serialize()[0][0], Position(7, 0));
+    EXPECT_EQ(board.status(), Game::Status::ENDED_CHECKMATE);
+}
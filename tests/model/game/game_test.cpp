@@ -114,3 +114,42 @@ TEST_F(GameTest, MoveWhenGameHasNotStarted) {
 
     EXPECT_THROW(game.move(from, to), std::runtime_error);
 }
+
+TEST_F(GameTest, MoveByNotation) {
+    EXPECT_EQ(game.move("Nc3"), "Nc3");
+    EXPECT_EQ(game.currentPlayer().name(), namePlayer2);
+    EXPECT_EQ(game.move("g8f6"), "Nf6");
+    EXPECT_EQ(game.currentPlayer().name(), namePlayer1);
+
+    auto board = game.board();
+    EXPECT_EQ(board[2][2]->type(), Pieces::Types::KNIGHT);
+    EXPECT_EQ(board[5][5]->type(), Pieces::Types::KNIGHT);
+
+    EXPECT_THROW(game.move("Nc3"), std::runtime_error);
+    EXPECT_EQ(game.currentPlayer().name(), namePlayer1);
+}
+
+TEST_F(GameTest, PlayRestartAndResult) {
+    EXPECT_EQ(game.result(), "*");
+
+    game.restart("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+    for (auto notation : {"f3", "e5", "g4", "Qh4#"}) game.play(notation);
+    EXPECT_EQ(game.status(), Game::Status::ENDED_CHECKMATE);
+    EXPECT_EQ(game.result(), "0-1");
+    EXPECT_EQ(game.currentPlayer().name(), namePlayer1);
+
+    game.restart("7k/5Q2/6K1/8/8/8/8/8 w - - 0 1");
+    EXPECT_EQ(game.status(), Game::Status::IN_PROGRESS);
+    game.play("Qg7#");
+    EXPECT_EQ(game.result(), "1-0");
+
+    game.restart("7k/8/6K1/8/8/8/8/8 w - - 0 1");
+    EXPECT_EQ(game.result(), "1/2-1/2");
+
+    EXPECT_THROW(game.play("e4"), std::runtime_error);
+    EXPECT_THROW(game.restart("8/8/8 w - -"), std::runtime_error);
+
+    Game::Game notStarted;
+    EXPECT_THROW(notStarted.play("e4"), std::runtime_error);
+    EXPECT_THROW(notStarted.restart("7k/8/6K1/8/8/8/8/8 w - - 0 1"), std::runtime_error);
+}
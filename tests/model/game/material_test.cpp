@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <model/game/game.hpp>
+
+class MaterialTest : public ::testing::Test {
+  protected:
+    Game::Board board;
+    Pieces::Player player1{"White"};
+    Pieces::Player player2{"Black"};
+    const int white = NNUE::Network::WHITE;
+    const int black = NNUE::Network::BLACK;
+
+    void SetUp() override { board = Game::Board(8, 8); }
+
+    Game::Material::Endgame endgame(std::string_view fen) {
+        board.initialize(player1, player2, fen);
+        return Game::Material::probe(board.materialKey()).endgame;
+    }
+};
+
+TEST_F(MaterialTest, KeyCountsPieces) {
+    board.initialize(player1, player2, "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+    auto key = board.materialKey();
+
+    EXPECT_EQ(Game::Material::count(key, white, Pieces::Types::PAWN), 8);
+    EXPECT_EQ(Game::Material::count(key, black, Pieces::Types::BISHOP), 2);
+    EXPECT_EQ(Game::Material::count(key, black, Pieces::Types::QUEEN), 1);
+    EXPECT_EQ(Game::Material::count(key, white, Pieces::Types::KING), 1);
+    EXPECT_EQ(Game::Material::probe(key).endgame, Game::Material::Endgame::NONE);
+}
+
+TEST_F(MaterialTest, KeyFollowsCapturesAndPromotions) {
+    board.initialize(player1, player2, "1n2k3/P7/8/8/8/8/8/4K3 w - - 0 1");
+    auto initial = board.materialKey();
+    auto moves = board.legalMoves();
+    auto capture = std::find_if(moves.begin(), moves.end(), [](const Pieces::Move &move) {
+        return move.captured() != nullptr && move.promoted() != nullptr &&
+               move.promoted()->type() == Pieces::Types::QUEEN;
+    });
+    ASSERT_NE(capture, moves.end());
+
+    board.move(*capture);
+    auto key = board.materialKey();
+    EXPECT_EQ(Game::Material::count(key, white, Pieces::Types::PAWN), 0);
+    EXPECT_EQ(Game::Material::count(key, white, Pieces::Types::QUEEN), 1);
+    EXPECT_EQ(Game::Material::count(key, black, Pieces::Types::KNIGHT), 0);
+    EXPECT_EQ(Game::Material::probe(key).endgame, Game::Material::Endgame::KXK);
+    EXPECT_EQ(Game::Material::probe(key).strong, white);
+
+    board.initialize(player1, player2, "4k3/8/8/8/8/8/8/Q3K3 w - - 0 1");
+    EXPECT_EQ(board.materialKey(), key);
+
+    board.initialize(player1, player2, "1n2k3/P7/8/8/8/8/8/4K3 w - - 0 1");
+    board.move(*capture);
+    board.unMove();
+    EXPECT_EQ(board.materialKey(), initial);
+}
+
+TEST_F(MaterialTest, InsufficientMaterial) {
+    for (auto fen : {"4k3/8/8/8/8/8/8/4K3 w - - 0 1", "4k3/8/8/8/8/8/8/1N2K3 w - - 0 1",
+                     "4kb2/8/8/8/8/8/8/2B1K3 w - - 0 1", "4kb2/8/8/8/8/8/8/4K3 w - - 0 1",
+                     "1b2k3/8/8/8/8/8/8/2B1K1B1 b - - 0 1"}) {
+        EXPECT_EQ(endgame(fen), Game::Material::Endgame::INSUFFICIENT) << fen;
+        EXPECT_EQ(board.status(), Game::Status::ENDED_INSUFFICIENT_MATERIAL) << fen;
+        EXPECT_TRUE(board.isKnownDraw()) << fen;
+    }
+
+    for (auto fen : {"2b1k3/8/8/8/8/8/8/2B1K3 w - - 0 1", "4k3/8/8/8/8/8/8/1NN1K3 w - - 0 1",
+                     "4kn2/8/8/8/8/8/8/1N2K3 w - - 0 1", "4k3/8/8/8/8/8/8/2B1KB2 w - - 0 1"}) {
+        EXPECT_NE(endgame(fen), Game::Material::Endgame::INSUFFICIENT) << fen;
+        EXPECT_EQ(board.status(), Game::Status::IN_PROGRESS) << fen;
+    }
+}
+
+TEST_F(MaterialTest, CaptureEndsGameOnInsufficientMaterial) {
+    board.initialize(player1, player2, "4k3/8/8/8/8/8/4r3/4K3 w - - 0 1");
+    ASSERT_EQ(board.status(), Game::Status::IN_PROGRESS);
+
+    board.move(board.serialize()[0][4], Position(1, 4));
+    EXPECT_EQ(board.status(), Game::Status::ENDED_INSUFFICIENT_MATERIAL);
+
+    board.unMove();
+    EXPECT_EQ(board.status(), Game::Status::IN_PROGRESS);
+}
+
+TEST_F(MaterialTest, EndgameDispatch) {
+    EXPECT_EQ(endgame("4k3/8/8/8/8/8/4P3/4K3 w - - 0 1"), Game::Material::Endgame::KPK);
+    EXPECT_EQ(endgame("4k3/4p3/8/8/8/8/8/4K3 w - - 0 1"), Game::Material::Endgame::KPK);
+    EXPECT_EQ(endgame("4k3/8/8/8/8/8/8/R3K3 w - - 0 1"), Game::Material::Endgame::KXK);
+    EXPECT_EQ(endgame("4k3/8/8/8/8/8/8/1NB1K3 w - - 0 1"), Game::Material::Endgame::KXK);
+    EXPECT_EQ(endgame("2b1k3/8/8/8/8/8/8/4K3 w - - 0 1"), Game::Material::Endgame::INSUFFICIENT);
+    EXPECT_EQ(endgame("1nb1k3/8/8/8/8/8/8/4K3 w - - 0 1"), Game::Material::Endgame::KXK);
+    EXPECT_EQ(Game::Material::probe(board.materialKey()).strong, black);
+    EXPECT_EQ(endgame("4k3/8/8/8/8/8/8/R3K2R w - - 0 1"), Game::Material::Endgame::NONE);
+}
@@ -7,9 +7,20 @@ TEST(StatusTest, StringConversion) {
     EXPECT_EQ(std::string(Game::Status::IN_PROGRESS), "IN_PROGRESS");
     EXPECT_EQ(std::string(Game::Status::ENDED_CHECKMATE), "ENDED_CHECKMATE");
     EXPECT_EQ(std::string(Game::Status::ENDED_STALEMATE), "ENDED_STALEMATE");
+    EXPECT_EQ(std::string(Game::Status::ENDED_REPETITION), "ENDED_REPETITION");
+    EXPECT_EQ(std::string(Game::Status::ENDED_FIFTY_MOVES), "ENDED_FIFTY_MOVES");
+    EXPECT_EQ(std::string(Game::Status::ENDED_INSUFFICIENT_MATERIAL), "ENDED_INSUFFICIENT_MATERIAL");
     EXPECT_EQ(std::string(Game::Status::UNDEFINED), "UNDEFINED");
 }
 
+TEST(StatusTest, IsDraw) {
+    EXPECT_TRUE(Game::Status::ENDED_REPETITION.isDraw());
+    EXPECT_TRUE(Game::Status::ENDED_FIFTY_MOVES.isDraw());
+    EXPECT_TRUE(Game::Status::ENDED_INSUFFICIENT_MATERIAL.isDraw());
+    EXPECT_FALSE(Game::Status::ENDED_STALEMATE.isDraw());
+    EXPECT_FALSE(Game::Status::IN_PROGRESS.isDraw());
+}
+
 TEST(StatusTest, EqualityOperator) {
     EXPECT_TRUE(Game::Status::NOT_STARTED == Game::Status::NOT_STARTED);
     EXPECT_FALSE(Game::Status::NOT_STARTED == Game::Status::IN_PROGRESS);
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <model/mate/mate.hpp>
+
+namespace {
+    // Kc6 and Rb1 against Ka8: 1. Kc7 Ka7 2. Ra1#, while 1. Rb7 stalemates
+    constexpr std::string_view MATE_IN_TWO = "k7/8/2K5/8/8/8/8/1R6 w - - 0 1";
+    constexpr std::string_view MATE_IN_ONE = "6k1/5ppp/8/8/8/8/8/R3K3 w - - 0 1";
+
+    /**
+     * @brief Every line of attacker's moves ends with a checkmate within moves
+     */
+    bool isMating(const Mate::Line &attack, int moves) {
+        if (moves <= 0) return false;
+
+        if (attack.replies.empty()) return attack.move.back() == '#';
+
+        for (auto &defence : attack.replies) {
+            if (defence.replies.size() != 1) return false;
+
+            if (!isMating(defence.replies.front(), moves - 1)) return false;
+        }
+        return true;
+    }
+} // namespace
+
+TEST(MateTest, TableCollectsTheLeastWork) {
+    Mate::Table table(4);
+    table.store(1, {0, Mate::INFINITE, 1});
+    table.store(2, {3, 2, 50});
+    table.store(3, {2, 2, 5});
+    table.store(4, {1, 4, 7});
+    table.store(5, {1, 1, 0});
+
+    EXPECT_LE(table.size(), 4);
+    EXPECT_EQ(table.nCollected(), 2);
+    Mate::Entry entry;
+    // Solved entries outlive unsolved ones, whatever their work
+    EXPECT_TRUE(table.probe(1, entry));
+    EXPECT_EQ(entry.pn, 0);
+    EXPECT_TRUE(table.probe(2, entry));
+    EXPECT_FALSE(table.probe(3, entry));
+    EXPECT_TRUE(table.probe(5, entry));
+
+    EXPECT_THROW(Mate::Table(0), std::runtime_error);
+}
+
+TEST(MateTest, MateInOne) {
+    Mate::Solver solver;
+
+    auto result = solver.solve(MATE_IN_ONE, 3);
+
+    EXPECT_EQ(result.verdict, Mate::Verdict::PROVEN);
+    EXPECT_EQ(result.moves, 1);
+    ASSERT_EQ(result.solution.size(), 1);
+    EXPECT_EQ(result.solution[0].move, "Ra8#");
+    EXPECT_EQ(Mate::Solver::format(result.solution), "1. Ra8#\n");
+    EXPECT_GT(result.nodes, 0);
+}
+
+TEST(MateTest, MateInTwoWithEveryDefence) {
+    Mate::Solver solver;
+
+    auto result = solver.solve(MATE_IN_TWO, 4);
+
+    ASSERT_EQ(result.verdict, Mate::Verdict::PROVEN);
+    EXPECT_EQ(result.moves, 2);
+    ASSERT_EQ(result.solution.size(), 1);
+    EXPECT_TRUE(isMating(result.solution[0], 2)) << Mate::Solver::format(result.solution);
+    EXPECT_FALSE(result.solution[0].replies.empty());
+    EXPECT_GT(result.nodesPerSecond(), 0);
+
+    auto text = Mate::Solver::format(result.solution);
+    EXPECT_EQ(text.rfind("1. ", 0), 0) << text;
+    EXPECT_NE(text.find("\n  1... "), std::string::npos) << text;
+    EXPECT_NE(text.find(" 2. "), std::string::npos) << text;
+}
+
+TEST(MateTest, Disproof) {
+    Mate::Solver::Options options;
+    options.isShortest = false;
+    Mate::Solver solver(options);
+
+    EXPECT_EQ(solver.solve(MATE_IN_TWO, 1).verdict, Mate::Verdict::DISPROVEN);
+    // Bare Kings can't mate
+    EXPECT_EQ(solver.solve("4k3/8/8/8/8/8/8/4K3 w - - 0 1", 3).verdict,
+              Mate::Verdict::DISPROVEN);
+    EXPECT_THROW(solver.solve(MATE_IN_ONE, 0), std::runtime_error);
+}
+
+TEST(MateTest, BoundedMemoryAndNodes) {
+    Mate::Solver::Options options;
+    options.tableSize = 64;
+    Mate::Solver small(options);
+
+    auto result = small.solve(MATE_IN_TWO, 2);
+
+    EXPECT_EQ(result.verdict, Mate::Verdict::PROVEN);
+    EXPECT_EQ(result.moves, 2);
+    EXPECT_TRUE(isMating(result.solution[0], 2));
+    EXPECT_LE(small.table().size(), 64);
+    EXPECT_GT(small.table().nCollected(), 0);
+
+    options.tableSize = 1 << 12;
+    options.maxNodes = 5;
+    Mate::Solver limited(options);
+
+    EXPECT_EQ(limited.solve(MATE_IN_TWO, 2).verdict, Mate::Verdict::UNKNOWN);
+}
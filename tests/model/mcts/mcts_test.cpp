@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <model/mcts/mcts.hpp>
+#include <model/notation/notation.hpp>
+#include <model/pgn/pgn.hpp>
+
+class MCTSTest : public ::testing::Test {
+  protected:
+    Game::Board board;
+    Pieces::Player first;
+    Pieces::Player second;
+    MCTS::Searcher::Options options;
+
+    MCTSTest()
+        : board(8, 8)
+        , first("White")
+        , second("Black") {
+        options.nThreads = 2;
+        options.capacity = 1 << 14;
+        options.seed = 3;
+    }
+
+    MCTS::Searcher::Limits playouts(std::uint64_t n) {
+        MCTS::Searcher::Limits limits;
+        limits.nodes = n;
+        return limits;
+    }
+
+    bool isLegal(const Pieces::Move &move) {
+        auto moves = board.legalMoves();
+        return std::find(moves.begin(), moves.end(), move) != moves.end();
+    }
+};
+
+TEST_F(MCTSTest, ArenaIsBounded) {
+    MCTS::Arena arena(8);
+
+    EXPECT_EQ(arena.allocate(5), 0);
+    EXPECT_EQ(arena.allocate(3), 5);
+    EXPECT_EQ(arena.allocate(1), MCTS::Node::NONE);
+    EXPECT_EQ(arena.size(), 8);
+
+    arena.clear();
+    EXPECT_EQ(arena.allocate(8), 0);
+
+    EXPECT_THROW(MCTS::Tree(MCTS::Tree::MIN_CAPACITY - 1), std::runtime_error);
+}
+
+TEST_F(MCTSTest, FindsMateInOne) {
+    board.initialize(first, second, "6k1/5ppp/8/8/8/8/8/R3K3 w - - 0 1");
+    MCTS::Searcher searcher(options);
+
+    auto result = searcher.search(board, playouts(2000));
+
+    EXPECT_EQ(Notation::LAN::format(result.move), "a1a8");
+    EXPECT_EQ(result.score, Search::MATE - 1);
+}
+
+TEST_F(MCTSTest, VisitsAddUp) {
+    board.initialize(first, second, PGN::STANDARD_FEN);
+    MCTS::Searcher searcher(options);
+
+    auto result = searcher.search(board, playouts(300));
+
+    EXPECT_TRUE(isLegal(result.move));
+    EXPECT_EQ(result.nodes, 300);
+    EXPECT_EQ(searcher.playouts(), 300);
+    auto &tree = searcher.tree();
+    auto &root = tree[0];
+    // No virtual loss is left once every playout is over
+    EXPECT_EQ(root.visits.load(), 300);
+    ASSERT_EQ(root.state.load(), MCTS::Node::EXPANDED);
+    EXPECT_EQ(root.nChildren, 20);
+
+    std::uint64_t visits = 0;
+    float priors = 0;
+    for (std::uint32_t i = 0; i < root.nChildren; ++i) {
+        auto &child = tree[root.children + i];
+        visits += child.visits.load();
+        priors += child.prior;
+        EXPECT_GE(child.mean(), 0.0);
+        EXPECT_LE(child.mean(), 1.0);
+    }
+    // The first playout expanded the root
+    EXPECT_EQ(visits, 299);
+    EXPECT_NEAR(priors, 1.0, 1e-4);
+}
+
+TEST_F(MCTSTest, ReusesTheSubtree) {
+    board.initialize(first, second, PGN::STANDARD_FEN);
+    MCTS::Searcher searcher(options);
+    auto result = searcher.search(board, playouts(1000));
+    board.move(result.move);
+
+    result = searcher.search(board, playouts(100));
+
+    EXPECT_GT(searcher.tree()[0].visits.load(), 100);
+
+    // Two plies later, with the opponent's move picked by the searcher
+    board.move(result.move);
+    board.move(searcher.search(board, playouts(100)).move);
+    result = searcher.search(board, playouts(100));
+
+    EXPECT_TRUE(isLegal(result.move));
+
+    // Unknown positions start a new tree
+    board.initialize(first, second, "4k3/8/8/8/8/8/4P3/4K3 w - - 0 1");
+    searcher.search(board, playouts(100));
+
+    EXPECT_EQ(searcher.tree()[0].visits.load(), 100);
+}
+
+TEST_F(MCTSTest, RecyclesAFullArena) {
+    options.capacity = MCTS::Tree::MIN_CAPACITY;
+    board.initialize(first, second, PGN::STANDARD_FEN);
+    MCTS::Searcher searcher(options);
+
+    auto result = searcher.search(board, playouts(1500));
+
+    EXPECT_TRUE(isLegal(result.move));
+    EXPECT_EQ(searcher.playouts(), 1500);
+    EXPECT_GT(searcher.nRecycled(), 0);
+    EXPECT_LE(searcher.tree().size(), MCTS::Tree::MIN_CAPACITY);
+    // Statistics survive the recycling
+    EXPECT_EQ(searcher.tree()[0].visits.load(), 1500);
+}
+
+TEST_F(MCTSTest, RandomRolloutsWithUCT) {
+    options.selection = MCTS::Searcher::Selection::UCT;
+    options.playout = MCTS::Searcher::Playout::ROLLOUT;
+    board.initialize(first, second, "6k1/5ppp/8/8/8/8/8/R3K3 w - - 0 1");
+    MCTS::Searcher searcher(options);
+
+    auto result = searcher.search(board, playouts(1000));
+
+    EXPECT_EQ(Notation::LAN::format(result.move), "a1a8");
+}
+
+TEST_F(MCTSTest, StopsOnTimeAndOnFinalPositions) {
+    board.initialize(first, second, PGN::STANDARD_FEN);
+    MCTS::Searcher searcher(options);
+    MCTS::Searcher::Limits limits;
+    limits.time = std::chrono::milliseconds(50);
+
+    auto start = std::chrono::steady_clock::now();
+    auto result = searcher.search(board, limits);
+
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(1000));
+    EXPECT_TRUE(isLegal(result.move));
+    EXPECT_GT(result.nodes, 0);
+
+    board.initialize(first, second, "6k1/5ppp/8/8/8/8/8/R3K3 w - - 0 1");
+    board.move(Notation::LAN::parse(board, "a1a8"));
+    result = searcher.search(board, playouts(100));
+
+    EXPECT_EQ(Search::Heuristics::key(result.move), Search::Heuristics::NO_MOVE);
+    EXPECT_EQ(result.score, -Search::MATE);
+}
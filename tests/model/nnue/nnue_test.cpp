@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+#include <model/game/game.hpp>
+#include <model/nnue/nnue.hpp>
+
+class NNUETest : public ::testing::Test {
+  protected:
+    std::string path;
+    NNUE::Network network;
+    std::mt19937 random{42};
+
+    void SetUp() override {
+        path = (std::filesystem::temp_directory_path() / "nnue_test.nnue").string();
+        NNUE::Network::save(path, randomParameters());
+        network.load(path);
+    }
+
+    void TearDown() override { std::filesystem::remove(path); }
+
+    std::int16_t randomValue(int min, int max) {
+        return static_cast<std::int16_t>(std::uniform_int_distribution<int>(min, max)(random));
+    }
+
+    NNUE::Network::Parameters randomParameters() {
+        NNUE::Network::Parameters parameters;
+        parameters.featureBiases.resize(NNUE::N_HIDDEN);
+        parameters.featureWeights.resize(NNUE::N_FEATURES * NNUE::N_HIDDEN);
+        parameters.outputWeights.resize(2 * NNUE::N_HIDDEN);
+        for (auto &value : parameters.featureBiases) value = randomValue(-64, 64);
+        for (auto &value : parameters.featureWeights) value = randomValue(-32, 32);
+        for (auto &value : parameters.outputWeights) value = randomValue(-128, 128);
+        parameters.outputBias = 1234;
+        return parameters;
+    }
+
+    static std::vector<NNUE::Kernels> supportedKernels() {
+        std::vector<NNUE::Kernels> kernels;
+        for (auto target : {NNUE::Kernels::Target::SCALAR, NNUE::Kernels::Target::SSE41,
+                            NNUE::Kernels::Target::AVX2, NNUE::Kernels::Target::NEON}) {
+            if (NNUE::Kernels::isSupported(target)) kernels.push_back(NNUE::Kernels::of(target));
+        }
+        return kernels;
+    }
+};
+
+TEST_F(NNUETest, LoadRejectsInvalidFile) {
+    std::string invalidPath = path + ".invalid";
+    {
+        std::ofstream file(invalidPath, std::ios::binary);
+        file << "not a network";
+    }
+    NNUE::Network invalid;
+
+    EXPECT_THROW(invalid.load(invalidPath), std::runtime_error);
+    EXPECT_FALSE(invalid.isLoaded());
+    EXPECT_THROW(invalid.load(path + ".missing"), std::runtime_error);
+    std::filesystem::remove(invalidPath);
+}
+
+TEST_F(NNUETest, FeatureMirrorsBlackPerspective) {
+    int white = NNUE::Network::WHITE, black = NNUE::Network::BLACK;
+
+    EXPECT_EQ(NNUE::Network::feature(white, white, Pieces::Types::PAWN, 8),
+              NNUE::Network::feature(black, black, Pieces::Types::PAWN, 48));
+    EXPECT_EQ(NNUE::Network::feature(white, black, Pieces::Types::KING, 60),
+              NNUE::Network::feature(black, white, Pieces::Types::KING, 4));
+    EXPECT_EQ(NNUE::Network::feature(black, white, Pieces::Types::PAWN, 7), NNUE::N_FEATURES - 1);
+}
+
+TEST_F(NNUETest, KernelsAreBitIdentical) {
+    std::int16_t accumulator[NNUE::N_HIDDEN], expected[NNUE::N_HIDDEN];
+    std::int16_t weights[2 * NNUE::N_HIDDEN], them[NNUE::N_HIDDEN];
+    auto scalar = NNUE::Kernels::of(NNUE::Kernels::Target::SCALAR);
+
+    for (int round = 0; round < 50; ++round) {
+        for (int i = 0; i < NNUE::N_HIDDEN; ++i) {
+            accumulator[i] = randomValue(-32768, 32767);
+            them[i] = randomValue(-300, 300);
+        }
+        for (auto &weight : weights) weight = randomValue(-32768, 32767);
+
+        for (auto &kernels : supportedKernels()) {
+            std::copy(std::begin(accumulator), std::end(accumulator), std::begin(expected));
+            std::int16_t actual[NNUE::N_HIDDEN];
+            std::copy(std::begin(accumulator), std::end(accumulator), std::begin(actual));
+
+            scalar.add(expected, weights);
+            kernels.add(actual, weights);
+            EXPECT_TRUE(std::equal(std::begin(expected), std::end(expected), std::begin(actual)))
+                << NNUE::Kernels::name(kernels.target);
+
+            scalar.sub(expected, weights + NNUE::N_HIDDEN);
+            kernels.sub(actual, weights + NNUE::N_HIDDEN);
+            EXPECT_TRUE(std::equal(std::begin(expected), std::end(expected), std::begin(actual)))
+                << NNUE::Kernels::name(kernels.target);
+
+            EXPECT_EQ(scalar.output(accumulator, them, weights),
+                      kernels.output(accumulator, them, weights))
+                << NNUE::Kernels::name(kernels.target);
+        }
+    }
+}
+
+TEST_F(NNUETest, BoardUpdatesAccumulatorIncrementally) {
+    Pieces::Player player1("White"), player2("Black");
+    Game::Board board(8, 8);
+    board.initialize(player1, player2);
+    board.network(&network);
+    NNUE::Accumulator initial = board.accumulator();
+
+    auto serialized = board.serialize();
+    board.move(serialized[1][4], Position(3, 4));
+    board.move(serialized[7][6], Position(5, 5));
+    board.move(serialized[0][5], Position(4, 1));
+    NNUE::Accumulator incremental = board.accumulator();
+
+    board.network(&network);
+    EXPECT_EQ(incremental, board.accumulator());
+    EXPECT_NE(initial, board.accumulator());
+
+    board.unMove();
+    board.unMove();
+    board.unMove();
+    EXPECT_EQ(initial, board.accumulator());
+    EXPECT_EQ(board.nMoves(), 0);
+    EXPECT_EQ(*board.serialize()[1][4], Pieces::Pawn(Position(1, 4), &player1));
+}
+
+TEST_F(NNUETest, BoardUpdatesAccumulatorOnCapture) {
+    Pieces::Player player1("White"), player2("Black");
+    Game::Board board(8, 8);
+    board.initialize(player1, player2);
+    board.network(&network);
+    NNUE::Accumulator initial = board.accumulator();
+
+    auto serialized = board.serialize();
+    auto *knight = serialized[0][1];
+    board.move(knight, Position(2, 2));
+    board.move(knight, Position(4, 3));
+    board.move(knight, Position(6, 4));
+    NNUE::Accumulator incremental = board.accumulator();
+    board.network(&network);
+    EXPECT_EQ(incremental, board.accumulator());
+
+    board.unMove();
+    board.unMove();
+    board.unMove();
+    EXPECT_EQ(initial, board.accumulator());
+    EXPECT_EQ(serialized[6][4]->position(), Position(6, 4));
+}
+
+TEST_F(NNUETest, EvaluationIsIdenticalAcrossKernels) {
+    Pieces::Player player1("White"), player2("Black");
+    Game::Board board(8, 8);
+    board.initialize(player1, player2);
+    board.network(&network);
+    auto serialized = board.serialize();
+    board.move(serialized[1][3], Position(3, 3));
+
+    auto scalar = NNUE::Kernels::of(NNUE::Kernels::Target::SCALAR);
+    network.kernels(scalar);
+    int whiteExpected = network.evaluate(board.accumulator(), NNUE::Network::WHITE);
+    int blackExpected = network.evaluate(board.accumulator(), NNUE::Network::BLACK);
+    for (auto &kernels : supportedKernels()) {
+        network.kernels(kernels);
+        EXPECT_EQ(network.evaluate(board.accumulator(), NNUE::Network::WHITE), whiteExpected);
+        EXPECT_EQ(network.evaluate(board.accumulator(), NNUE::Network::BLACK), blackExpected);
+    }
+}
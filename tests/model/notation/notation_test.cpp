@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <model/notation/notation.hpp>
+
+class NotationTest : public ::testing::Test {
+  protected:
+    Game::Board board;
+    Pieces::Player player1{"White"};
+    Pieces::Player player2{"Black"};
+
+    void SetUp() override { board = Game::Board(8, 8); }
+
+    void setUp(std::string_view fen) { board.initialize(player1, player2, fen); }
+};
+
+TEST_F(NotationTest, ParsePawnAndPieceMoves) {
+    setUp("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+
+    auto pawn = Notation::SAN::parse(board, "e4");
+    EXPECT_EQ(pawn.from(), Position(1, 4));
+    EXPECT_EQ(pawn.to(), Position(3, 4));
+    EXPECT_EQ(pawn.piece()->type(), Pieces::Types::PAWN);
+
+    auto knight = Notation::SAN::parse(board, "Nf3+!?");
+    EXPECT_EQ(knight.from(), Position(0, 6));
+    EXPECT_EQ(knight.to(), Position(2, 5));
+}
+
+TEST_F(NotationTest, ParseCaptures) {
+    setUp("rnbqkbnr/ppp1pppp/8/3p4/4P3/8/PPPP1PPP/RNBQKBNR w KQkq - 0 2");
+
+    auto capture = Notation::SAN::parse(board, "exd5");
+    EXPECT_EQ(capture.from(), Position(3, 4));
+    EXPECT_NE(capture.captured(), nullptr);
+}
+
+TEST_F(NotationTest, ParseDisambiguation) {
+    setUp("4k3/8/8/8/8/8/4K3/R6R w - - 0 1");
+
+    EXPECT_EQ(Notation::SAN::parse(board, "Rad1").from(), Position(0, 0));
+    EXPECT_EQ(Notation::SAN::parse(board, "Rhf1").from(), Position(0, 7));
+    EXPECT_THROW(Notation::SAN::parse(board, "Rd1"), std::runtime_error);
+
+    setUp("4k3/8/8/8/R7/8/8/R3K3 w - - 0 1");
+
+    EXPECT_EQ(Notation::SAN::parse(board, "R1a2").from(), Position(0, 0));
+    EXPECT_EQ(Notation::SAN::parse(board, "R4a2").from(), Position(3, 0));
+    EXPECT_EQ(Notation::SAN::parse(board, "Ra1a2").from(), Position(0, 0));
+}
+
+TEST_F(NotationTest, ParseCastling) {
+    setUp("r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1");
+
+    auto kingSide = Notation::SAN::parse(board, "O-O");
+    EXPECT_EQ(kingSide.type(), Pieces::Move::Type::SWAP);
+    EXPECT_EQ(kingSide.to(), Position(0, 6));
+
+    auto queenSide = Notation::SAN::parse(board, "0-0-0");
+    EXPECT_EQ(queenSide.type(), Pieces::Move::Type::SWAP);
+    EXPECT_EQ(queenSide.to(), Position(0, 2));
+
+    setUp("r3k2r/8/8/8/8/8/8/R3K2R w - - 0 1");
+
+    EXPECT_THROW(Notation::SAN::parse(board, "O-O"), std::runtime_error);
+}
+
+TEST_F(NotationTest, ParsePromotions) {
+    setUp("1n2k3/P7/8/8/8/8/8/4K3 w - - 0 1");
+
+    auto queen = Notation::SAN::parse(board, "a8=Q");
+    ASSERT_NE(queen.promoted(), nullptr);
+    EXPECT_EQ(queen.promoted()->type(), Pieces::Types::QUEEN);
+
+    auto knight = Notation::SAN::parse(board, "axb8N#");
+    ASSERT_NE(knight.promoted(), nullptr);
+    EXPECT_EQ(knight.promoted()->type(), Pieces::Types::KNIGHT);
+    EXPECT_NE(knight.captured(), nullptr);
+
+    EXPECT_THROW(Notation::SAN::parse(board, "a8"), std::runtime_error);
+}
+
+TEST_F(NotationTest, ParseEnPassant) {
+    setUp("rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3");
+
+    auto capture = Notation::SAN::parse(board, "exf6");
+    EXPECT_EQ(capture.to(), Position(5, 5));
+    EXPECT_NE(capture.captured(), nullptr);
+}
+
+TEST_F(NotationTest, ParseInvalidMoves) {
+    setUp("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+
+    for (auto san : {"", "e", "e9", "Nf3f", "Zf3", "xe4", "abce4"}) {
+        EXPECT_THROW(Notation::SAN::parse(board, san), std::runtime_error) << san;
+    }
+    for (auto san : {"e5", "Ke2", "Nd2", "O-O", "Nxf3"}) {
+        EXPECT_THROW(Notation::SAN::parse(board, san), std::runtime_error) << san;
+    }
+}
+
+TEST_F(NotationTest, Squares) {
+    EXPECT_EQ(Notation::parseSquare("a1"), Position(0, 0));
+    EXPECT_EQ(Notation::parseSquare("h8"), Position(7, 7));
+    EXPECT_EQ(Notation::parseSquare("e"), Position());
+    EXPECT_EQ(Notation::parseSquare("e0"), Position());
+    EXPECT_EQ(Notation::square(Position(3, 4)), "e4");
+}
+
+TEST_F(NotationTest, FormatSAN) {
+    setUp("r3k2r/1P6/8/8/8/2N3N1/8/R3K2R w KQkq - 0 1");
+
+    for (auto &move : board.legalMoves()) {
+        auto san = Notation::SAN::format(board, move);
+        EXPECT_EQ(Notation::SAN::parse(board, san), move) << san;
+    }
+    EXPECT_EQ(Notation::SAN::format(board, Notation::SAN::parse(board, "Nce4")), "Nce4");
+    EXPECT_EQ(Notation::SAN::format(board, Notation::SAN::parse(board, "O-O-O")), "O-O-O");
+    EXPECT_EQ(Notation::SAN::format(board, Notation::SAN::parse(board, "bxa8=Q")), "bxa8=Q+");
+    EXPECT_EQ(Notation::SAN::format(board, Notation::SAN::parse(board, "b8=N")), "b8=N");
+    EXPECT_EQ(Notation::SAN::format(board, Notation::SAN::parse(board, "Rxa8")), "Rxa8+");
+
+    setUp("4k3/8/8/8/R7/8/8/R3K3 w - - 0 1");
+
+    EXPECT_EQ(Notation::SAN::format(board, Notation::SAN::parse(board, "R1a2")), "R1a2");
+
+    setUp("4k3/8/8/8/8/8/8/4K1R1 w - - 0 1");
+
+    EXPECT_EQ(Notation::SAN::format(board, Notation::SAN::parse(board, "Rg7")), "Rg7");
+
+    setUp("6k1/5ppp/8/8/8/8/8/R3K3 w - - 0 1");
+
+    EXPECT_EQ(Notation::SAN::format(board, Notation::SAN::parse(board, "Ra8")), "Ra8#");
+    EXPECT_EQ(board.nMoves(), 0);
+}
+
+TEST_F(NotationTest, ParseAndFormatLAN) {
+    setUp("r3k2r/1P6/8/8/8/8/8/R3K2R w KQkq - 0 1");
+
+    for (auto &move : board.legalMoves()) {
+        EXPECT_EQ(Notation::LAN::parse(board, Notation::LAN::format(move)), move);
+    }
+    auto castling = Notation::LAN::parse(board, "e1g1");
+    EXPECT_EQ(castling.type(), Pieces::Move::Type::SWAP);
+    EXPECT_EQ(Notation::LAN::format(castling), "e1g1");
+
+    auto promotion = Notation::LAN::parse(board, "b7a8n");
+    EXPECT_EQ(promotion.promoted()->type(), Pieces::Types::KNIGHT);
+    EXPECT_EQ(Notation::LAN::format(promotion), "b7a8n");
+
+    for (auto lan : {"b7b8", "b7a8k", "e1e3", "e1", "z9e2"}) {
+        EXPECT_THROW(Notation::LAN::parse(board, lan), std::runtime_error) << lan;
+    }
+}
+
+TEST_F(NotationTest, ParseEitherNotation) {
+    setUp("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+
+    EXPECT_EQ(Notation::parse(board, "g1f3"), Notation::parse(board, "Nf3"));
+    EXPECT_EQ(Notation::parse(board, "e2e4"), Notation::parse(board, "e4"));
+    EXPECT_THROW(Notation::parse(board, "e2e5"), std::runtime_error);
+}
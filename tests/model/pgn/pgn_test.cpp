@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <model/pgn/pgn.hpp>
+
+namespace {
+    class Recorder : public PGN::Visitor {
+      public:
+        std::vector<std::pair<std::string, std::string>> tags;
+        std::vector<std::string> moves;
+        std::vector<std::string> results;
+        std::vector<std::string> errors;
+        std::string lastFen;
+        int nBegins = 0;
+
+        void begin() override { nBegins++; }
+
+        void tag(std::string_view name, std::string_view value) override {
+            tags.emplace_back(name, value);
+        }
+
+        void move(std::string_view san, const Pieces::Move & /*move*/,
+                  const Game::Board &board) override {
+            moves.emplace_back(san);
+            lastFen = board.fen();
+        }
+
+        void end(std::string_view result) override { results.emplace_back(result); }
+
+        void error(const std::string &message) override { errors.push_back(message); }
+    };
+
+    const char *const GAMES = R"([Event "Casual"]
+[White "Alice \"A\""]
+[Black "Bob"]
+[Result "1-0"]
+
+1. e4 e5 2. Nf3 {a comment} Nc6 3.Bb5 $1 (3. Bc4 Bc5 (3... Nf6)) a6 ; line comment
+4. Ba4 Nf6 5. O-O 1-0
+
+[Event "Scholar"]
+[Result "1-0"]
+
+1. e4 e5 2. Qh5 Nc6 3. Bc4 Nf6?? 4. Qxf7# 1-0
+)";
+} // namespace
+
+TEST(PGNTest, ReadGames) {
+    Recorder recorder;
+
+    EXPECT_EQ(PGN::Reader::read(GAMES, recorder), 2);
+
+    EXPECT_EQ(recorder.nBegins, 2);
+    EXPECT_EQ(recorder.results, (std::vector<std::string>{"1-0", "1-0"}));
+    EXPECT_TRUE(recorder.errors.empty());
+    ASSERT_EQ(recorder.tags.size(), 6);
+    EXPECT_EQ(recorder.tags[1].first, "White");
+    EXPECT_EQ(recorder.tags[1].second, "Alice \\\"A\\\"");
+    ASSERT_EQ(recorder.moves.size(), 9 + 7);
+    EXPECT_EQ(recorder.moves[4], "Bb5");
+    EXPECT_EQ(recorder.moves[8], "O-O");
+    EXPECT_EQ(recorder.moves[15], "Qxf7#");
+    EXPECT_EQ(recorder.lastFen,
+              "r1bqkb1r/pppp1Qpp/2n2n2/4p3/2B1P3/8/PPPP1PPP/RNB1K1NR b KQkq - 0 4");
+}
+
+TEST(PGNTest, ReadFromFenTag) {
+    Recorder recorder;
+
+    PGN::Reader::read(R"([FEN "4k3/8/8/8/8/8/8/R3K3 w Q - 0 1"]
+
+1. Ra8+ Kd7 *)",
+                      recorder);
+
+    EXPECT_EQ(recorder.moves.size(), 2);
+    EXPECT_EQ(recorder.results, (std::vector<std::string>{"*"}));
+    EXPECT_EQ(recorder.lastFen, "R7/3k4/8/8/8/8/8/4K3 w - - 2 2");
+}
+
+TEST(PGNTest, IllegalMoveSkipsRestOfGame) {
+    Recorder recorder;
+
+    EXPECT_EQ(PGN::Reader::read("1. e4 e5 2. Ke3 Nc6 3. Nf3 0-1\n\n1. d4 1/2-1/2", recorder), 2);
+
+    EXPECT_EQ(recorder.moves, (std::vector<std::string>{"e4", "e5", "d4"}));
+    EXPECT_EQ(recorder.errors.size(), 1);
+    EXPECT_EQ(recorder.results, (std::vector<std::string>{"0-1", "1/2-1/2"}));
+}
+
+TEST(PGNTest, ReadWithoutResult) {
+    Recorder recorder;
+
+    EXPECT_EQ(PGN::Reader::read("1. e4 e5\n[Event \"Next\"]\n1. d4", recorder), 2);
+
+    EXPECT_EQ(recorder.results, (std::vector<std::string>{"*", "*"}));
+    EXPECT_EQ(recorder.moves.size(), 3);
+}
+
+TEST(PGNTest, ReadFile) {
+    auto path = (std::filesystem::temp_directory_path() / "pgn_test.pgn").string();
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << GAMES;
+    }
+    Recorder recorder;
+
+    PGN::Reader reader(path);
+    EXPECT_EQ(reader.read(recorder), 2);
+    EXPECT_EQ(recorder.moves.size(), 16);
+
+    std::filesystem::remove(path);
+    EXPECT_THROW(PGN::Reader().read(recorder), std::runtime_error);
+}
+
+TEST(PGNTest, WriteGames) {
+    std::ostringstream out;
+    PGN::Writer writer(out);
+
+    PGN::Reader::read("[Event \"E\"]\n1. e4 {comment} e5 (1... c5) 2. Nf3 $2 0-1\n1. d4 *", writer);
+
+    EXPECT_EQ(out.str(), "[Event \"E\"]\n\n1. e4 e5 2. Nf3 0-1\n\n1. d4 *\n\n");
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <sstream>
+
+#include <model/notation/notation.hpp>
+#include <model/puzzles/puzzles.hpp>
+
+namespace {
+    // 1. Qd8+?? Kxd8 gives the Queen away, only the King can take it
+    constexpr std::string_view BLUNDER_FEN = "4k3/r7/8/8/8/8/8/3QK3 w - - 0 1";
+}
+
+class PuzzlesTest : public ::testing::Test {
+  protected:
+    std::string path;
+    Puzzles::Options options;
+    Game::Board board;
+    Pieces::Player first;
+    Pieces::Player second;
+    Search::Searcher searcher;
+
+    PuzzlesTest()
+        : board(8, 8)
+        , first("White")
+        , second("Black") {}
+
+    void SetUp() override {
+        path = (std::filesystem::temp_directory_path() / "puzzles_test.bin").string();
+        options.nAnalyzers = 2;
+        options.nVerifiers = 2;
+        options.queueSize = 1;
+        options.depth = 2;
+        options.verifyDepth = 2;
+    }
+
+    void TearDown() override { std::filesystem::remove(path); }
+
+    Puzzles::Archived archived(std::string_view fen, const std::vector<std::string> &lans) {
+        Puzzles::Archived game;
+        game.fen = std::string(fen);
+        board.initialize(first, second, fen);
+        for (auto &lan : lans) {
+            auto move = Notation::LAN::parse(board, lan);
+            game.moves.push_back(Archive::encodeMove(board, move));
+            board.move(move);
+        }
+        return game;
+    }
+};
+
+TEST_F(PuzzlesTest, AnalyzeFindsTheLosingMove) {
+    Puzzles::Pipeline pipeline(options);
+
+    auto analysis = pipeline.analyze(archived(BLUNDER_FEN, {"d1d8", "e8d8"}), board, first,
+                                     second, searcher);
+
+    EXPECT_EQ(analysis.nPositions, 3);
+    ASSERT_EQ(analysis.candidates.size(), 1);
+    EXPECT_EQ(analysis.candidates[0].ply, 1);
+    EXPECT_EQ(analysis.candidates[0].fen.rfind("3Qk3/r7/", 0), 0) << analysis.candidates[0].fen;
+    EXPECT_GE(analysis.candidates[0].score, options.winScore);
+
+    analysis = pipeline.analyze(archived(PGN::STANDARD_FEN, {"e2e4", "e7e5", "g1f3"}), board,
+                                first, second, searcher);
+
+    EXPECT_EQ(analysis.nPositions, 4);
+    EXPECT_TRUE(analysis.candidates.empty());
+}
+
+TEST_F(PuzzlesTest, VerifyKeepsUniqueWinningLines) {
+    Puzzles::Pipeline pipeline(options);
+    Puzzles::Puzzle puzzle;
+
+    Puzzles::Candidate candidate{4, 1, "3Qk3/r7/8/8/8/8/8/4K3 b - - 1 1", 500};
+    ASSERT_TRUE(pipeline.verify(candidate, board, first, second, searcher, puzzle));
+
+    ASSERT_FALSE(puzzle.moves.empty());
+    EXPECT_EQ(puzzle.moves[0], "Kxd8");
+    EXPECT_EQ(puzzle.moves.size() % 2, 1);
+    EXPECT_EQ(puzzle.epd().rfind("3Qk3/r7/8/8/8/8/8/4K3 b - - bm Kxd8; pv Kxd8", 0), 0)
+        << puzzle.epd();
+    EXPECT_NE(puzzle.epd().find("; id \"5.1\";"), std::string::npos) << puzzle.epd();
+
+    // The Rook takes the Queen too
+    candidate.fen = "r2Qk3/8/8/8/8/8/8/4K3 b - - 1 1";
+    EXPECT_FALSE(pipeline.verify(candidate, board, first, second, searcher, puzzle));
+}
+
+TEST_F(PuzzlesTest, RunStreamsTheArchive) {
+    {
+        Archive::Writer writer(path);
+        for (int i = 0; i < 3; ++i) {
+            auto game = (i == 1) ? archived(BLUNDER_FEN, {"d1d8", "e8d8"})
+                                 : archived(PGN::STANDARD_FEN, {"e2e4", "e7e5"});
+            Archive::Record record;
+            if (i == 1) record.tags.emplace_back("FEN", BLUNDER_FEN);
+            record.moves = game.moves;
+            writer.write(record);
+        }
+        writer.close();
+    }
+    Archive::Reader reader(path);
+    Puzzles::Pipeline pipeline(options);
+    std::ostringstream out;
+
+    auto stats = pipeline.run(reader, out);
+
+    EXPECT_EQ(stats.nGames, 3);
+    EXPECT_EQ(stats.nPositions, 9);
+    EXPECT_EQ(stats.nCandidates, 1);
+    EXPECT_EQ(stats.nPuzzles, 1);
+    EXPECT_EQ(out.str().rfind("3Qk3/r7/8/8/8/8/8/4K3 b - - bm Kxd8;", 0), 0) << out.str();
+    EXPECT_NE(out.str().find("id \"2.1\""), std::string::npos) << out.str();
+}
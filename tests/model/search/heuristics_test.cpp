@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <model/search/search.hpp>
+
+class HeuristicsTest : public ::testing::Test {
+  protected:
+    Game::Board board;
+    Pieces::Player player1{"White"};
+    Pieces::Player player2{"Black"};
+    std::vector<Pieces::Move> moves;
+    Search::Heuristics heuristics;
+
+    void SetUp() override {
+        board = Game::Board(8, 8);
+        board.initialize(player1, player2);
+        moves = board.legalMoves();
+    }
+};
+
+TEST_F(HeuristicsTest, KeyEncodesFromAndTo) {
+    auto &move = moves[0];
+    Position from = move.from(), to = move.to();
+
+    EXPECT_EQ(Search::Heuristics::key(move),
+              (from.row() * 8 + from.column()) * 64 + to.row() * 8 + to.column());
+    EXPECT_EQ(Search::Heuristics::key(Pieces::Move()), Search::Heuristics::NO_MOVE);
+}
+
+TEST_F(HeuristicsTest, UpdateRewardsBestAndPenalizesTried) {
+    const Pieces::Move *tried[] = {&moves[0], &moves[1]};
+
+    heuristics.update(board, moves[1], 3, 2, nullptr, tried, 2);
+
+    EXPECT_GT(heuristics.history(0, moves[1]), 0);
+    EXPECT_LT(heuristics.history(0, moves[0]), 0);
+    EXPECT_EQ(heuristics.history(1, moves[1]), 0);
+    EXPECT_EQ(heuristics.killer(2, 0), Search::Heuristics::key(moves[1]));
+    EXPECT_EQ(heuristics.killer(2, 1), Search::Heuristics::NO_MOVE);
+}
+
+TEST_F(HeuristicsTest, KillersShiftWithoutDuplicates) {
+    heuristics.update(board, moves[0], 1, 0, nullptr, nullptr, 0);
+    heuristics.update(board, moves[0], 1, 0, nullptr, nullptr, 0);
+    heuristics.update(board, moves[1], 1, 0, nullptr, nullptr, 0);
+
+    EXPECT_EQ(heuristics.killer(0, 0), Search::Heuristics::key(moves[1]));
+    EXPECT_EQ(heuristics.killer(0, 1), Search::Heuristics::key(moves[0]));
+}
+
+TEST_F(HeuristicsTest, GravityBoundsScores) {
+    for (int i = 0; i < 1000; ++i) {
+        heuristics.update(board, moves[0], 20, 0, nullptr, nullptr, 0);
+    }
+
+    EXPECT_LE(heuristics.history(0, moves[0]), Search::Heuristics::HISTORY_MAX);
+    EXPECT_GT(heuristics.history(0, moves[0]), Search::Heuristics::HISTORY_MAX / 2);
+}
+
+TEST_F(HeuristicsTest, CounterMoveAndContinuationFollowPreviousMove) {
+    auto previous = moves[0];
+    board.move(previous);
+    auto replies = board.legalMoves();
+
+    heuristics.update(board, replies[0], 2, 1, &previous, nullptr, 0);
+
+    EXPECT_EQ(heuristics.counterMove(1, &previous), Search::Heuristics::key(replies[0]));
+    EXPECT_EQ(heuristics.counterMove(0, &previous), Search::Heuristics::NO_MOVE);
+    EXPECT_GT(heuristics.continuation(board, &previous, replies[0]), 0);
+    EXPECT_EQ(heuristics.continuation(board, nullptr, replies[0]), 0);
+    EXPECT_EQ(heuristics.quietScore(board, replies[0], &previous),
+              heuristics.history(1, replies[0]) +
+                  heuristics.continuation(board, &previous, replies[0]));
+}
+
+TEST_F(HeuristicsTest, AgeHalvesScoresAndDropsKillers) {
+    heuristics.update(board, moves[0], 4, 0, nullptr, nullptr, 0);
+    int score = heuristics.history(0, moves[0]);
+
+    heuristics.age();
+
+    EXPECT_EQ(heuristics.history(0, moves[0]), score / 2);
+    EXPECT_EQ(heuristics.killer(0, 0), Search::Heuristics::NO_MOVE);
+}
+
+TEST_F(HeuristicsTest, ClearResetsEverything) {
+    auto previous = moves[0];
+    heuristics.update(board, moves[1], 4, 0, &previous, nullptr, 0);
+
+    heuristics.clear();
+
+    EXPECT_EQ(heuristics.history(0, moves[1]), 0);
+    EXPECT_EQ(heuristics.killer(0, 0), Search::Heuristics::NO_MOVE);
+    EXPECT_EQ(heuristics.counterMove(0, &previous), Search::Heuristics::NO_MOVE);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <model/search/search.hpp>
+
+class MovePickerTest : public ::testing::Test {
+  protected:
+    Game::Board board;
+    Pieces::Player player1{"White"};
+    Pieces::Player player2{"Black"};
+    Pieces::Piece *rook;
+    Pieces::Piece *queen;
+    Pieces::Piece *king;
+
+    // White rook hitting a hanging knight, white queen hitting a defended pawn
+    void SetUp() override {
+        board = Game::Board(8, 8);
+        board.initialize(player1, player2);
+        for (auto *piece : board.pieces()) {
+            piece->move(Position());
+        }
+        auto &pieces = board.pieces();
+        rook = pieces[0];
+        queen = pieces[3];
+        king = pieces[4];
+        rook->move(Position(0, 0));
+        queen->move(Position(3, 3));
+        king->move(Position(0, 7));
+        pieces[20]->move(Position(7, 0));
+        pieces[17]->move(Position(5, 0));
+        pieces[24]->move(Position(4, 3));
+        pieces[25]->move(Position(5, 4));
+    }
+
+    Pieces::Move findMove(const std::vector<Pieces::Move> &moves, Pieces::Piece *piece,
+                          Position to) {
+        for (auto &move : moves) {
+            if (move.piece() == piece && move.to() == to) return move;
+        }
+        throw std::runtime_error("Move not found: to='" + std::string(to) + "'");
+    }
+};
+
+TEST_F(MovePickerTest, YieldsStagesInOrder) {
+    auto moves = board.legalMoves();
+    auto ttMove = findMove(moves, rook, Position(0, 1));
+    auto goodCapture = findMove(moves, rook, Position(5, 0));
+    auto badCapture = findMove(moves, queen, Position(4, 3));
+    auto killer = findMove(moves, king, Position(0, 6));
+    Search::Heuristics heuristics;
+    heuristics.update(board, killer, 1, 0, nullptr, nullptr, 0);
+
+    Search::MovePicker picker(board, ttMove, &heuristics, 0);
+
+    EXPECT_EQ(*picker.next(), ttMove);
+    EXPECT_EQ(picker.stage(), Search::MovePicker::Stage::TT_MOVE);
+    EXPECT_EQ(*picker.next(), goodCapture);
+    EXPECT_EQ(picker.stage(), Search::MovePicker::Stage::GOOD_CAPTURES);
+    EXPECT_EQ(*picker.next(), killer);
+    EXPECT_EQ(picker.stage(), Search::MovePicker::Stage::REFUTATIONS);
+
+    std::size_t nMoves = 3;
+    const Pieces::Move *move = nullptr;
+    const Pieces::Move *last = nullptr;
+    while ((move = picker.next()) != nullptr) {
+        nMoves++;
+        last = move;
+    }
+    EXPECT_EQ(nMoves, moves.size());
+    ASSERT_NE(last, nullptr);
+    EXPECT_EQ(*last, badCapture);
+    EXPECT_EQ(picker.stage(), Search::MovePicker::Stage::DONE);
+}
+
+TEST_F(MovePickerTest, SkipsMissingMoves) {
+    auto moves = board.legalMoves();
+    auto missing = Pieces::Move::createMove(*rook, Position(0, 0), Position(7, 7));
+    Search::Heuristics heuristics;
+    heuristics.update(board, missing, 1, 0, nullptr, nullptr, 0);
+
+    Search::MovePicker picker(board, missing, &heuristics, 0);
+
+    EXPECT_EQ(*picker.next(), findMove(moves, rook, Position(5, 0)));
+    EXPECT_EQ(picker.stage(), Search::MovePicker::Stage::GOOD_CAPTURES);
+
+    std::size_t nMoves = 1;
+    while (picker.next() != nullptr) {
+        nMoves++;
+    }
+    EXPECT_EQ(nMoves, moves.size());
+}
+
+TEST_F(MovePickerTest, OrdersQuietsByHistory) {
+    auto moves = board.legalMoves();
+    auto favourite = findMove(moves, queen, Position(0, 3));
+    Search::Heuristics heuristics;
+    heuristics.update(board, favourite, 4, 1, nullptr, nullptr, 0);
+
+    Search::MovePicker picker(board, Pieces::Move(), &heuristics, 0);
+
+    const Pieces::Move *move = nullptr;
+    while ((move = picker.next()) != nullptr) {
+        if (picker.stage() == Search::MovePicker::Stage::QUIETS) break;
+    }
+    ASSERT_NE(move, nullptr);
+    EXPECT_EQ(*move, favourite);
+}
+
+TEST_F(MovePickerTest, SkipsQuiets) {
+    Search::MovePicker picker(board);
+    picker.skipQuiets();
+
+    std::size_t nMoves = 0;
+    const Pieces::Move *move = nullptr;
+    while ((move = picker.next()) != nullptr) {
+        EXPECT_NE(picker.stage(), Search::MovePicker::Stage::QUIETS);
+        EXPECT_FALSE(move->captured() == nullptr && move->promoted() == nullptr);
+        nMoves++;
+    }
+    EXPECT_EQ(nMoves, 2);
+}
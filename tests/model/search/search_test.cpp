@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include <model/search/search.hpp>
+
+class SearchTest : public ::testing::Test {
+  protected:
+    Game::Board board;
+    Pieces::Player player1{"White"};
+    Pieces::Player player2{"Black"};
+
+    void SetUp() override {
+        board = Game::Board(8, 8);
+        board.initialize(player1, player2);
+    }
+
+    void clearBoard() {
+        auto pieces = board.pieces();
+        for (auto *piece : pieces) {
+            piece->move(Position());
+        }
+    }
+
+    Pieces::Piece *place(int index, Position position) {
+        auto *piece = board.pieces()[index];
+        piece->move(position);
+        return piece;
+    }
+
+    Pieces::Move findMove(Pieces::Piece *piece, Position to) {
+        for (auto &move : board.legalMoves()) {
+            if (move.piece() == piece && move.to() == to) return move;
+        }
+        throw std::runtime_error("Move not found: to='" + std::string(to) + "'");
+    }
+
+    // Indexes in Board::pieces() after Board::initialize()
+    static const int WHITE_ROOK = 0;
+    static const int WHITE_QUEEN = 3;
+    static const int WHITE_KING = 4;
+    static const int WHITE_PAWN = 8;
+    static const int BLACK_KNIGHT = 17;
+    static const int BLACK_BISHOP = 18;
+    static const int BLACK_QUEEN = 19;
+    static const int BLACK_KING = 20;
+    static const int BLACK_PAWN = 24;
+};
+
+TEST_F(SearchTest, LegalMovesAtStart) {
+    EXPECT_EQ(board.legalMoves().size(), 20);
+    EXPECT_FALSE(board.isInCheck());
+}
+
+TEST_F(SearchTest, AttackersOfSquare) {
+    clearBoard();
+    place(WHITE_KING, Position(0, 0));
+    place(BLACK_KING, Position(7, 7));
+    place(WHITE_ROOK, Position(3, 0));
+    place(WHITE_PAWN, Position(2, 2));
+    place(BLACK_BISHOP, Position(5, 5));
+    place(BLACK_PAWN, Position(4, 4));
+
+    EXPECT_EQ(board.attackers(Position(3, 3), &player1).size(), 2);
+    EXPECT_EQ(board.attackers(Position(3, 3), &player2).size(), 1);
+    EXPECT_EQ(board.attackers(Position(3, 4), &player2).size(), 0);
+}
+
+TEST_F(SearchTest, SeeOfUndefendedCapture) {
+    clearBoard();
+    place(WHITE_KING, Position(0, 7));
+    place(BLACK_KING, Position(7, 3));
+    auto *rook = place(WHITE_ROOK, Position(0, 0));
+    place(BLACK_KNIGHT, Position(5, 0));
+
+    auto move = findMove(rook, Position(5, 0));
+
+    EXPECT_EQ(board.see(move), Pieces::Types::KNIGHT.value());
+}
+
+TEST_F(SearchTest, SeeOfDefendedCapture) {
+    clearBoard();
+    place(WHITE_KING, Position(0, 7));
+    place(BLACK_KING, Position(7, 0));
+    auto *queen = place(WHITE_QUEEN, Position(3, 3));
+    place(BLACK_PAWN, Position(4, 3));
+    place(BLACK_PAWN + 1, Position(5, 4));
+
+    auto move = findMove(queen, Position(4, 3));
+
+    EXPECT_EQ(board.see(move),
+              Pieces::Types::PAWN.value() - Pieces::Types::QUEEN.value());
+}
+
+TEST_F(SearchTest, QuiescenceCapturesHangingPiece) {
+    clearBoard();
+    place(WHITE_KING, Position(0, 7));
+    place(BLACK_KING, Position(7, 3));
+    place(WHITE_ROOK, Position(0, 0));
+    place(BLACK_QUEEN, Position(5, 0));
+
+    Search::Searcher searcher;
+    int standPat = Search::Evaluation::evaluate(board);
+    int score = searcher.quiescence(board, -Search::INFINITE, Search::INFINITE, 0);
+
+    EXPECT_GT(score, standPat + Pieces::Types::ROOK.value());
+    EXPECT_EQ(board.nMoves(), 0);
+}
+
+TEST_F(SearchTest, QuiescenceSkipsLosingCapture) {
+    clearBoard();
+    place(WHITE_KING, Position(0, 7));
+    place(BLACK_KING, Position(7, 0));
+    place(WHITE_QUEEN, Position(3, 3));
+    place(BLACK_PAWN, Position(4, 3));
+    place(BLACK_PAWN + 1, Position(5, 4));
+
+    Search::Searcher searcher;
+    int standPat = Search::Evaluation::evaluate(board);
+    int score = searcher.quiescence(board, -Search::INFINITE, Search::INFINITE, 0);
+
+    EXPECT_EQ(score, standPat);
+}
+
+TEST_F(SearchTest, SearchFindsMateInOne) {
+    clearBoard();
+    place(WHITE_KING, Position(0, 4));
+    auto *rook = place(WHITE_ROOK, Position(0, 0));
+    place(BLACK_KING, Position(7, 7));
+    place(BLACK_PAWN, Position(6, 6));
+    place(BLACK_PAWN + 1, Position(6, 7));
+
+    Search::Searcher searcher;
+    auto result = searcher.search(board, 2);
+
+    EXPECT_EQ(result.move.piece(), rook);
+    EXPECT_EQ(result.move.to(), Position(7, 0));
+    EXPECT_EQ(result.score, Search::MATE - 1);
+    EXPECT_GT(result.nodes, 0);
+}
+
+TEST_F(SearchTest, SearchFindsMateInOneWithEachOption) {
+    clearBoard();
+    place(WHITE_KING, Position(0, 4));
+    auto *rook = place(WHITE_ROOK, Position(0, 0));
+    place(BLACK_KING, Position(7, 7));
+    place(BLACK_PAWN, Position(6, 6));
+    place(BLACK_PAWN + 1, Position(6, 7));
+
+    bool Search::Searcher::Options::*features[] = {
+        &Search::Searcher::Options::nullMove,
+        &Search::Searcher::Options::lateMoveReductions,
+        &Search::Searcher::Options::futility,
+        &Search::Searcher::Options::reverseFutility,
+        &Search::Searcher::Options::principalVariation,
+        &Search::Searcher::Options::aspirationWindows};
+    for (auto feature : features) {
+        Search::Searcher::Options options{false, false, false, false, false, false};
+        options.*feature = true;
+        Search::Searcher searcher(options);
+
+        auto result = searcher.search(board, 3);
+
+        EXPECT_EQ(result.move.piece(), rook);
+        EXPECT_EQ(result.move.to(), Position(7, 0));
+        EXPECT_EQ(result.score, Search::MATE - 1);
+        EXPECT_EQ(result.depth, 3);
+    }
+}
+
+TEST_F(SearchTest, SelectivityReducesNodes) {
+    Search::Searcher selective;
+    Search::Searcher plain(Search::Searcher::Options{false, false, false, false, false, false});
+
+    auto selectiveResult = selective.search(board, 3);
+    auto plainResult = plain.search(board, 3);
+
+    EXPECT_LT(selectiveResult.nodes, plainResult.nodes);
+    EXPECT_EQ(board.nMoves(), 0);
+    EXPECT_EQ(board.turn(), &player1);
+    EXPECT_EQ(board.legalMoves().size(), 20);
+}
+
+TEST_F(SearchTest, NullMoveHandsTheTurnOver) {
+    board.nullMove();
+
+    EXPECT_EQ(board.turn(), &player2);
+    EXPECT_EQ(board.legalMoves().size(), 20);
+    EXPECT_EQ(board.legalMoves()[0].piece()->owner(), &player2);
+
+    board.unNullMove();
+
+    EXPECT_EQ(board.turn(), &player1);
+    EXPECT_EQ(board.nMoves(), 0);
+}
+
+TEST_F(SearchTest, SearchScoresDrawnStatusAsDraw) {
+    board.initialize(player1, player2, "4k3/8/8/8/8/8/8/QQQ1K3 w - - 100 80");
+    ASSERT_EQ(board.status(), Game::Status::ENDED_FIFTY_MOVES);
+
+    Search::Searcher searcher;
+    auto result = searcher.search(board, 2);
+
+    EXPECT_EQ(result.score, 0);
+}
+
+TEST_F(SearchTest, EvaluationDispatchesEndgames) {
+    board.initialize(player1, player2, "4k3/8/8/8/8/8/8/R3K3 w - - 0 1");
+    int centered = Search::Evaluation::evaluate(board);
+    EXPECT_GT(centered, Search::KNOWN_WIN);
+
+    board.initialize(player1, player2, "7k/8/8/8/8/8/8/R3K3 b - - 0 1");
+    int cornered = -Search::Evaluation::evaluate(board);
+    EXPECT_GT(cornered, centered);
+
+    board.initialize(player1, player2, "4k3/8/8/8/8/8/8/2B1K3 w - - 0 1");
+    EXPECT_EQ(Search::Evaluation::evaluate(board), 0);
+}
+
+TEST_F(SearchTest, EvaluationParametersFile) {
+    auto path = (std::filesystem::temp_directory_path() / "search_test_parameters.txt").string();
+    auto defaults = Search::Parameters::defaults();
+    EXPECT_EQ(defaults.material[Pieces::Types::QUEEN.index()], Pieces::Types::QUEEN.value());
+    EXPECT_EQ(Search::Evaluation::parameters(), defaults);
+
+    auto parameters = defaults;
+    parameters.material[Pieces::Types::PAWN.index()] = 90;
+    parameters.tables[Pieces::Types::KNIGHT.index()][63] = -7;
+    parameters.save(path);
+    EXPECT_EQ(Search::Parameters::load(path), parameters);
+
+    // A doubled Pawn value shows in the evaluation after 1. e4 d5 2. exd5
+    board.initialize(player1, player2,
+                     "rnbqkbnr/ppp1pppp/8/3P4/8/8/PPPP1PPP/RNBQKBNR b KQkq - 0 2");
+    int before = Search::Evaluation::evaluate(board);
+    parameters = defaults;
+    parameters.material[Pieces::Types::PAWN.index()] = 200;
+    Search::Evaluation::parameters(parameters);
+    EXPECT_EQ(Search::Evaluation::evaluate(board), before - 100);
+    Search::Evaluation::parameters(defaults);
+
+    std::ofstream(path) << "MATERIAL 1 2 3\n";
+    EXPECT_THROW(Search::Parameters::load(path), std::runtime_error);
+    std::ofstream(path) << "TEMPO 10\n";
+    EXPECT_THROW(Search::Parameters::load(path), std::runtime_error);
+    std::filesystem::remove(path);
+    EXPECT_THROW(Search::Parameters::load(path), std::runtime_error);
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <set>
+
+#include <model/notation/notation.hpp>
+#include <model/selfplay/selfplay.hpp>
+
+class SelfPlayTest : public ::testing::Test {
+  protected:
+    std::string path;
+    std::string bookPath;
+    SelfPlay::Options options;
+
+    void SetUp() override {
+        path = (std::filesystem::temp_directory_path() / "selfplay_test.bin").string();
+        bookPath = (std::filesystem::temp_directory_path() / "selfplay_test_book.bin").string();
+        options.nGames = 6;
+        options.nThreads = 3;
+        options.seed = 7;
+        options.limits.depth = 1;
+        options.maxPlies = 30;
+        options.randomPlies = 4;
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+        std::filesystem::remove(bookPath);
+    }
+};
+
+TEST_F(SelfPlayTest, GamesOnlyDependOnTheSeedAndIndex) {
+    SelfPlay::Runner runner(options);
+    Game::Board board(8, 8), other(8, 8);
+    Pieces::Player first("White"), second("Black");
+    Search::Searcher searcher, otherSearcher;
+
+    auto played = runner.play(3, board, first, second, searcher);
+    runner.play(1, other, first, second, otherSearcher);
+    auto again = runner.play(3, other, first, second, otherSearcher);
+
+    EXPECT_EQ(played.index, 3);
+    EXPECT_EQ(played.moves, again.moves);
+    EXPECT_EQ(played.result, again.result);
+    EXPECT_LE(played.moves.size(), 30);
+    EXPECT_NE(played.result, "*");
+    EXPECT_EQ(played.isAdjudicated, played.moves.size() == 30);
+}
+
+TEST_F(SelfPlayTest, RunWritesEveryGame) {
+    SelfPlay::Stats stats;
+    {
+        Archive::Writer writer(path);
+        stats = SelfPlay::Runner(options).run(writer);
+    }
+    EXPECT_EQ(stats.nGames, 6);
+    EXPECT_EQ(stats.nWhiteWins + stats.nBlackWins + stats.nDraws, 6);
+    EXPECT_GT(stats.nNodes, 0);
+
+    Archive::Reader reader(path);
+    ASSERT_EQ(reader.size(), 6);
+    std::set<std::string> rounds;
+    std::uint64_t nPlies = 0;
+    Game::Board board(8, 8);
+    Pieces::Player first("White"), second("Black");
+    for (std::size_t i = 0; i < reader.size(); ++i) {
+        auto record = reader.record(i);
+        ASSERT_EQ(record.tags.size(), 1);
+        EXPECT_EQ(record.tags[0].first, "Round");
+        rounds.emplace(record.tags[0].second);
+        nPlies += record.moves.size();
+        EXPECT_NO_THROW(Archive::Reader::replay(record, board, first, second));
+    }
+    EXPECT_EQ(rounds, (std::set<std::string>{"1", "2", "3", "4", "5", "6"}));
+    EXPECT_EQ(stats.nPlies, nPlies);
+}
+
+TEST_F(SelfPlayTest, RunReplaysOnAFreshBoard) {
+    // Promotions leave spare pieces on the board each worker reuses
+    options.fen = "4k3/PPPP4/8/8/8/8/4pppp/4K3 w - - 0 1";
+    options.nGames = 12;
+    options.nThreads = 1;
+    options.maxPlies = 12;
+    {
+        Archive::Writer writer(path);
+        SelfPlay::Runner(options).run(writer);
+    }
+    Archive::Reader reader(path);
+    ASSERT_EQ(reader.size(), 12);
+    SelfPlay::Runner runner(options);
+    Pieces::Player first("White"), second("Black");
+    for (std::size_t i = 0; i < reader.size(); ++i) {
+        auto record = reader.record(i);
+        Game::Board replayed(8, 8), played(8, 8);
+        Search::Searcher searcher;
+        ASSERT_NO_THROW(Archive::Reader::replay(record, replayed, first, second)) << i;
+        runner.play(std::stoul(std::string(record.tags[0].second)) - 1, played, first, second,
+                    searcher);
+        EXPECT_EQ(replayed.fen(), played.fen()) << i;
+    }
+}
+
+TEST_F(SelfPlayTest, OpeningsComeFromTheBook) {
+    Game::Board board(8, 8);
+    Pieces::Player first("White"), second("Black");
+    board.initialize(first, second, options.fen);
+    auto e4 = Book::encodeMove(Notation::SAN::parse(board, "e4"));
+    Book::Polyglot::write(bookPath, {{Book::key(board), e4, 1, 0}});
+    Book::Polyglot book(bookPath);
+
+    options.randomPlies = 0;
+    options.maxPlies = 2;
+    SelfPlay::Runner runner(options);
+    runner.book(&book);
+    Search::Searcher searcher;
+    for (std::size_t index = 0; index < 3; ++index) {
+        auto played = runner.play(index, board, first, second, searcher);
+        ASSERT_EQ(played.moves.size(), 2);
+
+        board.initialize(first, second, options.fen);
+        EXPECT_EQ(Book::encodeMove(Archive::decodeMove(board, played.moves[0])), e4);
+    }
+}
+
+TEST_F(SelfPlayTest, AdjudicatesAWonPosition) {
+    options.fen = "4k3/8/8/8/8/8/8/QQQ1K3 w - - 0 1";
+    options.randomPlies = 0;
+    options.winPlies = 2;
+    SelfPlay::Runner runner(options);
+    Game::Board board(8, 8);
+    Pieces::Player first("White"), second("Black");
+    Search::Searcher searcher;
+
+    auto played = runner.play(0, board, first, second, searcher);
+    EXPECT_EQ(played.result, "1-0");
+    EXPECT_TRUE(played.isAdjudicated);
+    EXPECT_EQ(played.moves.size(), 1);
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <model/stress/stress.hpp>
+
+class StressTest : public ::testing::Test {
+  protected:
+    Stress::Options options;
+
+    void SetUp() override {
+        options.nGames = 24;
+        options.nThreads = 3;
+        options.seed = 11;
+        options.maxPlies = 300;
+        options.isUndone = true;
+    }
+
+    static void expectEqual(const Stress::Stats &stats, const Stress::Stats &other) {
+        EXPECT_EQ(stats.nGames, other.nGames);
+        EXPECT_EQ(stats.nPlies, other.nPlies);
+        EXPECT_EQ(stats.nWhiteWins, other.nWhiteWins);
+        EXPECT_EQ(stats.nBlackWins, other.nBlackWins);
+        EXPECT_EQ(stats.nStalemates, other.nStalemates);
+        EXPECT_EQ(stats.nRepetitions, other.nRepetitions);
+        EXPECT_EQ(stats.nFiftyMoves, other.nFiftyMoves);
+        EXPECT_EQ(stats.nInsufficientMaterial, other.nInsufficientMaterial);
+        EXPECT_EQ(stats.nUnfinished, other.nUnfinished);
+    }
+};
+
+TEST_F(StressTest, GamesOnlyDependOnTheSeedAndIndex) {
+    Stress::Generator generator(options);
+    Game::Board board(8, 8), other(8, 8);
+    Pieces::Player first("White"), second("Black");
+
+    auto outcome = generator.play(5, board, first, second);
+    generator.play(2, other, first, second);
+    auto again = generator.play(5, other, first, second);
+
+    EXPECT_GT(outcome.nPlies, 0);
+    EXPECT_EQ(outcome.nPlies, again.nPlies);
+    EXPECT_EQ(outcome.hash, again.hash);
+    EXPECT_EQ(outcome.status, again.status);
+    EXPECT_EQ(outcome.loser, again.loser);
+}
+
+TEST_F(StressTest, RunIsReproducibleWhateverTheThreads) {
+    auto stats = Stress::Generator(options).run();
+
+    EXPECT_EQ(stats.nGames, options.nGames);
+    EXPECT_EQ(stats.nWhiteWins + stats.nBlackWins + stats.nStalemates + stats.nRepetitions +
+                  stats.nFiftyMoves + stats.nInsufficientMaterial + stats.nUnfinished,
+              options.nGames);
+    EXPECT_LE(stats.averageLength(), options.maxPlies);
+    EXPECT_GT(stats.pliesPerSecond(), 0);
+
+    options.nThreads = 1;
+    expectEqual(stats, Stress::Generator(options).run());
+}
+
+TEST_F(StressTest, StatsCountOutcomes) {
+    Stress::Stats stats;
+    Stress::Outcome outcome;
+    outcome.status = Game::Status::ENDED_CHECKMATE;
+    outcome.loser = NNUE::Network::WHITE;
+    outcome.nPlies = 4;
+    stats.add(outcome);
+    outcome.loser = NNUE::Network::BLACK;
+    outcome.nPlies = 6;
+    stats.add(outcome);
+    outcome.status = Game::Status::IN_PROGRESS;
+    stats.add(outcome);
+
+    EXPECT_EQ(stats.nGames, 3);
+    EXPECT_EQ(stats.nBlackWins, 1);
+    EXPECT_EQ(stats.nWhiteWins, 1);
+    EXPECT_EQ(stats.nUnfinished, 1);
+    EXPECT_DOUBLE_EQ(stats.averageLength(), 16.0 / 3);
+
+    Stress::Stats total;
+    total += stats;
+    total += stats;
+    EXPECT_EQ(total.nGames, 6);
+    EXPECT_EQ(total.nPlies, 32);
+}
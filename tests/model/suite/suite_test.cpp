@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <model/suite/suite.hpp>
+
+namespace {
+    // Ra8# is the only mate, Ra2 lets the King out
+    constexpr std::string_view MATE_EPD = "6k1/5ppp/8/8/8/8/8/R3K3 w Q - bm Ra8#; id \"mate\";";
+}
+
+class SuiteTest : public ::testing::Test {
+  protected:
+    Suite::Options options;
+    Game::Board board;
+    Pieces::Player first;
+    Pieces::Player second;
+    Search::Searcher searcher;
+
+    SuiteTest()
+        : board(8, 8)
+        , first("White")
+        , second("Black") {}
+
+    void SetUp() override {
+        options.nThreads = 3;
+        options.window = 2;
+        options.depth = 2;
+    }
+
+    std::vector<std::string> lines(const std::string &text) {
+        std::vector<std::string> lines;
+        std::istringstream in(text);
+        for (std::string line; std::getline(in, line);) lines.push_back(line);
+        return lines;
+    }
+};
+
+TEST_F(SuiteTest, ParsesEpd) {
+    auto record = Suite::Record::parse(
+        "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - "
+        "bm Bb5 Bc4; am a3;id \"open.1\"; hmvc 2; fmvn 3;");
+    EXPECT_EQ(record.fen, "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3");
+    EXPECT_EQ(record.bestMoves, (std::vector<std::string>{"Bb5", "Bc4"}));
+    EXPECT_EQ(record.avoidMoves, std::vector<std::string>{"a3"});
+    EXPECT_EQ(record.id, "open.1");
+}
+
+TEST_F(SuiteTest, ParsesFen) {
+    auto record = Suite::Record::parse("4k3/8/8/8/8/8/4P3/4K3 b - - 7 40");
+    EXPECT_EQ(record.fen, "4k3/8/8/8/8/8/4P3/4K3 b - - 7 40");
+    EXPECT_TRUE(record.bestMoves.empty());
+    EXPECT_TRUE(record.id.empty());
+
+    EXPECT_EQ(Suite::Record::parse("4k3/8/8/8/8/8/4P3/4K3 w - - bm e4;").fen,
+              "4k3/8/8/8/8/8/4P3/4K3 w - - 0 1");
+    EXPECT_THROW(Suite::Record::parse("4k3/8/8/8/8/8/4P3/4K3 w -"), std::runtime_error);
+}
+
+TEST_F(SuiteTest, ChecksBestAndAvoidMoves) {
+    Suite::Analyzer analyzer(options);
+    auto solved = analyzer.analyze(0, MATE_EPD, board, first, second, searcher);
+    EXPECT_TRUE(solved.error.empty());
+    EXPECT_EQ(solved.move, "Ra8#");
+    EXPECT_EQ(solved.verdict, Suite::Verdict::SOLVED);
+    EXPECT_EQ(solved.format().rfind("1 Ra8# score ", 0), 0U);
+
+    auto failed = analyzer.analyze(1, "6k1/5ppp/8/8/8/8/8/R3K3 w Q - am a1a8;", board, first,
+                                   second, searcher);
+    EXPECT_EQ(failed.verdict, Suite::Verdict::FAILED);
+
+    auto plain = analyzer.analyze(2, "4k3/8/8/8/8/8/4P3/4K3 w - - 0 1", board, first, second,
+                                  searcher);
+    EXPECT_EQ(plain.verdict, Suite::Verdict::NONE);
+    EXPECT_FALSE(plain.move.empty());
+
+    auto illegal = analyzer.analyze(3, "4k3/8/8/8/8/8/4P3/4K3 w - - bm e5;", board, first,
+                                    second, searcher);
+    EXPECT_FALSE(illegal.error.empty());
+    EXPECT_EQ(illegal.format().rfind("4 error: ", 0), 0U);
+}
+
+TEST_F(SuiteTest, KeepsInputOrder) {
+    std::string input;
+    const int nPositions = 12;
+    for (int i = 0; i < nPositions; ++i) {
+        input += (i % 3 == 0) ? std::string(MATE_EPD)
+                 : (i % 3 == 1) ? "# comment\n\n4k3/8/8/8/8/8/4P3/4K3 w - - 0 1"
+                                : "not a position";
+        input += '\n';
+    }
+    std::istringstream in(input);
+    std::ostringstream out;
+    auto stats = Suite::Analyzer(options).run(in, out);
+
+    auto results = lines(out.str());
+    ASSERT_EQ(results.size(), static_cast<std::size_t>(nPositions));
+    for (int i = 0; i < nPositions; ++i) {
+        EXPECT_EQ(results[i].rfind(std::to_string(i + 1) + " ", 0), 0U) << results[i];
+        EXPECT_EQ(results[i].find(" error: ") != std::string::npos, i % 3 == 2) << results[i];
+    }
+    EXPECT_EQ(stats.nPositions, static_cast<std::size_t>(nPositions));
+    EXPECT_EQ(stats.nErrors, 4U);
+    EXPECT_EQ(stats.nTests, 4U);
+    EXPECT_EQ(stats.nSolved, 4U);
+    EXPECT_DOUBLE_EQ(stats.solveRate(), 1.0);
+    EXPECT_GT(stats.nodes, 0U);
+}
+
+TEST_F(SuiteTest, NodeLimit) {
+    options.depth = Search::MAX_PLY - 1;
+    options.nodes = 2000;
+    std::istringstream in("4k3/8/8/8/8/8/4P3/4K3 w - - 0 1\n");
+    std::ostringstream out;
+    auto stats = Suite::Analyzer(options).run(in, out);
+    EXPECT_EQ(stats.nPositions, 1U);
+    EXPECT_LT(stats.nodes, 20000U);
+}
@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+
+#include <model/pgn/pgn.hpp>
+#include <model/search/search.hpp>
+#include <model/tablebase/tablebase.hpp>
+
+class TablebaseTest : public ::testing::Test {
+  protected:
+    Game::Board board;
+    Pieces::Player player1{"White"};
+    Pieces::Player player2{"Black"};
+
+    void SetUp() override { board = Game::Board(8, 8); }
+
+    Tablebase::Result probe(const Tablebase::Tablebases &tablebases, std::string_view fen) {
+        board.initialize(player1, player2, fen);
+        Tablebase::Result result{Tablebase::WDL::INVALID, -1};
+        EXPECT_TRUE(tablebases.probe(board, result)) << fen;
+        return result;
+    }
+
+    static int maxDtm(const Tablebase::Table &table, Tablebase::WDL wdl) {
+        int dtm = 0;
+        for (std::uint64_t index = 0; index < table.material().size(); ++index) {
+            auto result = table.probe(index);
+            if (result.wdl == wdl) dtm = std::max(dtm, result.dtm);
+        }
+        return dtm;
+    }
+};
+
+TEST_F(TablebaseTest, Material) {
+    Tablebase::Material material("KRPvKB");
+
+    EXPECT_EQ(material.name(), "KRPvKB");
+    EXPECT_EQ(material.nPieces(), 5);
+    EXPECT_EQ(material.type(2), Pieces::Types::PAWN);
+    EXPECT_EQ(material.color(3), 1);
+    EXPECT_EQ(material.size(), std::uint64_t(2) << 30);
+
+    for (auto name : {"KQK", "QvK", "KvKK", "KPQvK", "KQQQQvK", "KXvK"}) {
+        EXPECT_THROW(Tablebase::Material material(name), std::runtime_error) << name;
+    }
+}
+
+TEST_F(TablebaseTest, GenerateKQK) {
+    Tablebase::Generator generator(Tablebase::Generator::Options{4});
+    Tablebase::Tablebases tablebases;
+    tablebases.add(generator.generate(Tablebase::Material("KvK")));
+    auto table = generator.generate(Tablebase::Material("KQvK"));
+    tablebases.add(generator.generate(Tablebase::Material("KQvK")));
+
+    // Longest KQK mate is 10 moves
+    EXPECT_EQ(maxDtm(table, Tablebase::WDL::WIN), 19);
+    EXPECT_EQ(maxDtm(table, Tablebase::WDL::LOSS), 20);
+
+    auto mated = probe(tablebases, "k7/1Q6/1K6/8/8/8/8/8 b - - 0 1");
+    EXPECT_EQ(mated.wdl, Tablebase::WDL::LOSS);
+    EXPECT_EQ(mated.dtm, 0);
+
+    auto mateInOne = probe(tablebases, "k7/8/1K6/8/8/8/8/6Q1 w - - 0 1");
+    EXPECT_EQ(mateInOne.wdl, Tablebase::WDL::WIN);
+    EXPECT_EQ(mateInOne.dtm, 1);
+
+    EXPECT_EQ(probe(tablebases, "k7/8/1QK5/8/8/8/8/8 b - - 0 1").wdl, Tablebase::WDL::DRAW);
+    EXPECT_EQ(probe(tablebases, "k7/1Q6/8/8/8/8/8/7K b - - 0 1").wdl, Tablebase::WDL::DRAW);
+
+    // Colors swapped against the table
+    auto mirrored = probe(tablebases, "6q1/8/8/8/8/1k6/8/K7 b - - 0 1");
+    EXPECT_EQ(mirrored.wdl, Tablebase::WDL::WIN);
+    EXPECT_EQ(mirrored.dtm, 1);
+
+    EXPECT_EQ(Tablebase::verify(table, tablebases, 101), 0);
+}
+
+TEST_F(TablebaseTest, GenerateKRKAndKPK) {
+    Tablebase::Generator generator;
+    Tablebase::Tablebases tablebases;
+    for (auto name : {"KvK", "KQvK", "KRvK", "KBvK", "KNvK", "KPvK"}) {
+        tablebases.add(generator.generate(Tablebase::Material(name)));
+    }
+    auto krk = generator.generate(Tablebase::Material("KRvK"));
+    auto kpk = generator.generate(Tablebase::Material("KPvK"));
+
+    // Longest KRK mate is 16 moves
+    EXPECT_EQ(maxDtm(krk, Tablebase::WDL::WIN), 31);
+    EXPECT_EQ(Tablebase::verify(krk, tablebases, 97), 0);
+    EXPECT_EQ(Tablebase::verify(kpk, tablebases, 13), 0);
+
+    EXPECT_EQ(probe(tablebases, "8/8/8/8/8/4k3/4P3/4K3 w - - 0 1").wdl, Tablebase::WDL::DRAW);
+    EXPECT_EQ(probe(tablebases, "4k3/8/4K3/4P3/8/8/8/8 w - - 0 1").wdl, Tablebase::WDL::WIN);
+    EXPECT_EQ(probe(tablebases, "4k3/8/4K3/4P3/8/8/8/8 b - - 0 1").wdl, Tablebase::WDL::LOSS);
+    EXPECT_EQ(probe(tablebases, "k7/8/K7/P7/8/8/8/8 w - - 0 1").wdl, Tablebase::WDL::DRAW);
+}
+
+TEST_F(TablebaseTest, WriteAndOpen) {
+    auto directory = std::filesystem::temp_directory_path() / "tablebase_test";
+    std::filesystem::create_directories(directory);
+    Tablebase::Generator generator;
+    generator.generate(Tablebase::Material("KvK")).write((directory / "KvK.tb").string());
+    generator.generate(Tablebase::Material("KQvK")).write((directory / "KQvK.tb").string());
+
+    Tablebase::Tablebases tablebases;
+    tablebases.load(directory.string());
+    EXPECT_EQ(tablebases.size(), 2);
+
+    auto result = probe(tablebases, "k7/8/1K6/8/8/8/8/6Q1 w - - 0 1");
+    EXPECT_EQ(result.wdl, Tablebase::WDL::WIN);
+    EXPECT_EQ(result.dtm, 1);
+
+    board.initialize(player1, player2, "k7/8/1K6/8/8/8/8/6RR w - - 0 1");
+    EXPECT_FALSE(tablebases.probe(board, result));
+
+    EXPECT_THROW(Tablebase::Table((directory / "missing.tb").string()), std::runtime_error);
+    std::filesystem::remove_all(directory);
+}
+
+TEST_F(TablebaseTest, SearchProbesTablebases) {
+    Tablebase::Generator generator;
+    Tablebase::Tablebases tablebases;
+    tablebases.add(generator.generate(Tablebase::Material("KvK")));
+    tablebases.add(generator.generate(Tablebase::Material("KQvK")));
+    board.initialize(player1, player2, "8/8/8/3k4/8/8/8/KQ6 w - - 0 1");
+    Tablebase::Result expected;
+    ASSERT_TRUE(tablebases.probe(board, expected));
+
+    Search::Searcher searcher;
+    searcher.tablebases(&tablebases);
+    auto result = searcher.search(board, 2);
+
+    EXPECT_EQ(result.score, Search::MATE - expected.dtm);
+}
+
+TEST_F(TablebaseTest, KPKBitbaseIsGenerated) {
+    auto bits = Tablebase::KPK::generate();
+
+    ASSERT_EQ(bits.size(), Tablebase::KPK::N_POSITIONS / 32);
+    for (int side = 0; side < 2; ++side) {
+        for (int strongKing = 0; strongKing < 64; ++strongKing) {
+            for (int weakKing = 0; weakKing < 64; ++weakKing) {
+                for (int pawn = 8; pawn < 56; ++pawn) {
+                    if (pawn % 8 > 3) continue;
+
+                    int bit = ((side * 64 + strongKing) * 64 + weakKing) * 24 + (pawn / 8 - 1) * 4 + pawn % 8;
+                    bool isWin = (bits[bit / 32] >> (bit % 32)) & 1;
+                    ASSERT_EQ(Tablebase::KPK::isWin(side, strongKing, pawn, weakKing), isWin)
+                        << "Regenerate kpk_bitbase.hpp from Tablebase::KPK::generate()";
+                }
+            }
+        }
+    }
+}
+
+TEST_F(TablebaseTest, KPKBitbaseMatchesRetrogradeTable) {
+    Tablebase::Generator generator;
+    auto table = generator.generate(Tablebase::Material("KPvK"));
+
+    int nErrors = 0, nWins = 0;
+    for (std::uint64_t index = 0; index < table.material().size(); ++index) {
+        auto result = table.probe(index);
+        int side = index >> 18, strongKing = (index >> 12) & 63, pawn = (index >> 6) & 63,
+            weakKing = index & 63;
+        if (result.wdl == Tablebase::WDL::INVALID || pawn / 8 < 1 || pawn / 8 > 6) continue;
+
+        bool isWin = result.wdl == (side == 0 ? Tablebase::WDL::WIN : Tablebase::WDL::LOSS);
+        nWins += isWin;
+        nErrors += Tablebase::KPK::isWin(side, strongKing, pawn, weakKing) != isWin;
+    }
+
+    EXPECT_GT(nWins, 0);
+    EXPECT_EQ(nErrors, 0);
+}
+
+TEST_F(TablebaseTest, KPKProbeByBoard) {
+    Tablebase::WDL wdl;
+
+    board.initialize(player1, player2, "8/8/8/8/8/4k3/4P3/4K3 w - - 0 1");
+    ASSERT_TRUE(Tablebase::KPK::probe(board, wdl));
+    EXPECT_EQ(wdl, Tablebase::WDL::DRAW);
+
+    board.initialize(player1, player2, "8/8/8/8/8/8/4PK2/7k b - - 0 1");
+    ASSERT_TRUE(Tablebase::KPK::probe(board, wdl));
+    EXPECT_EQ(wdl, Tablebase::WDL::LOSS);
+
+    // Colors and files are mirrored
+    board.initialize(player1, player2, "7K/4pk2/8/8/8/8/8/8 w - - 0 1");
+    ASSERT_TRUE(Tablebase::KPK::probe(board, wdl));
+    EXPECT_EQ(wdl, Tablebase::WDL::LOSS);
+    board.initialize(player1, player2, "7k/8/8/8/8/8/7P/7K w - - 0 1");
+    ASSERT_TRUE(Tablebase::KPK::probe(board, wdl));
+    EXPECT_EQ(wdl, Tablebase::WDL::DRAW);
+
+    board.initialize(player1, player2, "8/8/8/8/8/8/4PP2/4K1k1 w - - 0 1");
+    EXPECT_FALSE(Tablebase::KPK::probe(board, wdl));
+}
+
+TEST_F(TablebaseTest, KPKInEvaluationAndBoard) {
+    board.initialize(player1, player2, "8/8/8/8/8/4k3/4P3/4K3 w - - 0 1");
+    EXPECT_EQ(Search::Evaluation::evaluate(board), 0);
+    EXPECT_TRUE(board.isKnownDraw());
+    EXPECT_EQ(board.status(), Game::Status::IN_PROGRESS);
+
+    board.initialize(player1, player2, "8/8/8/8/8/8/4PK2/7k b - - 0 1");
+    EXPECT_LT(Search::Evaluation::evaluate(board), -Pieces::Types::ROOK.value());
+    EXPECT_FALSE(board.isKnownDraw());
+
+    board.initialize(player1, player2, PGN::STANDARD_FEN);
+    EXPECT_FALSE(board.isKnownDraw());
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <thread>
+
+#include <model/tournament/tournament.hpp>
+
+namespace {
+    /**
+     * @brief Engine answering a fixed move, e.g. an illegal one to lose at once
+     */
+    class FixedEngine : public Tournament::Engine {
+      public:
+        explicit FixedEngine(std::string move, std::chrono::milliseconds delay = {})
+            : _move(std::move(move))
+            , _delay(delay) {}
+
+        void newGame() override {}
+
+        std::string go(std::string_view /*fen*/, const std::vector<std::string> & /*moves*/,
+                       const Tournament::TimeControl & /*control*/,
+                       const std::array<std::chrono::milliseconds, 2> & /*clocks*/) override {
+            std::this_thread::sleep_for(this->_delay);
+            return this->_move;
+        }
+
+      private:
+        std::string _move;
+        std::chrono::milliseconds _delay;
+    };
+
+    Tournament::Factory local() {
+        return []() { return std::make_unique<Tournament::LocalEngine>(); };
+    }
+} // namespace
+
+TEST(TournamentTest, ScoreStatistics) {
+    Tournament::Score score{60, 20, 20};
+
+    EXPECT_EQ(score.games(), 100);
+    EXPECT_DOUBLE_EQ(score.ratio(), 0.7);
+    EXPECT_NEAR(score.elo(), 147.19, 0.01);
+    EXPECT_NEAR(score.variance(), (60 * 0.09 + 20 * 0.04 + 20 * 0.49) / 100, 1e-12);
+    EXPECT_GT(score.eloError(), 0);
+    EXPECT_NEAR(score.los(), 0.5 * (1 + std::erf(40 / std::sqrt(160.0))), 1e-12);
+
+    Tournament::Score even{10, 5, 10};
+    EXPECT_DOUBLE_EQ(even.elo(), 0);
+    EXPECT_DOUBLE_EQ(even.los(), 0.5);
+    EXPECT_DOUBLE_EQ(Tournament::Score().ratio(), 0.5);
+    EXPECT_TRUE(std::isinf(Tournament::Score{3, 0, 0}.elo()));
+}
+
+TEST(TournamentTest, SPRTDecisions) {
+    Tournament::SPRT sprt(0, 10);
+    EXPECT_NEAR(sprt.upperBound(), std::log(0.95 / 0.05), 1e-12);
+    EXPECT_NEAR(sprt.lowerBound(), std::log(0.05 / 0.95), 1e-12);
+
+    EXPECT_EQ(sprt.decide(Tournament::Score{1, 0, 0}), Tournament::SPRT::Decision::CONTINUE);
+    EXPECT_EQ(sprt.decide(Tournament::Score{700, 600, 500}),
+              Tournament::SPRT::Decision::ACCEPT_H1);
+    EXPECT_EQ(sprt.decide(Tournament::Score{500, 600, 700}),
+              Tournament::SPRT::Decision::ACCEPT_H0);
+    EXPECT_EQ(sprt.decide(Tournament::Score{2000, 2000, 2000}),
+              Tournament::SPRT::Decision::ACCEPT_H0);
+    EXPECT_GT(sprt.llr(Tournament::Score{20, 10, 5}), 0);
+    EXPECT_LT(sprt.llr(Tournament::Score{5, 10, 20}), 0);
+
+    EXPECT_THROW(Tournament::SPRT(5, 0), std::runtime_error);
+    EXPECT_THROW(Tournament::SPRT(0, 5, 0), std::runtime_error);
+}
+
+TEST(TournamentTest, MatchPlaysPairsWithColorsSwapped) {
+    Tournament::Match::Options options;
+    options.concurrency = 2;
+    options.maxGames = 4;
+    options.timeControl = {0, 1};
+    options.maxPlies = 16;
+    options.randomPlies = 2;
+    options.isSprt = false;
+    Tournament::Match match(local(), local(), options);
+
+    std::vector<Tournament::Outcome> outcomes;
+    auto result = match.run([&outcomes](const Tournament::Outcome &outcome,
+                                        const Tournament::Score &score) {
+        outcomes.push_back(outcome);
+        EXPECT_EQ(score.games(), outcomes.size());
+    });
+
+    EXPECT_EQ(result.score.games(), 4);
+    EXPECT_EQ(result.decision, Tournament::SPRT::Decision::CONTINUE);
+    ASSERT_EQ(outcomes.size(), 4);
+    std::sort(outcomes.begin(), outcomes.end(),
+              [](auto &a, auto &b) { return a.index < b.index; });
+    for (std::size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(outcomes[i].white, static_cast<int>(i % 2));
+        EXPECT_NE(outcomes[i].result, "*");
+        EXPECT_LE(outcomes[i].moves.size(), 16);
+    }
+    // Both games of a pair start with the same random plies
+    EXPECT_EQ(std::vector<std::string>(outcomes[0].moves.begin(), outcomes[0].moves.begin() + 2),
+              std::vector<std::string>(outcomes[1].moves.begin(), outcomes[1].moves.begin() + 2));
+}
+
+TEST(TournamentTest, MatchStopsOnSPRT) {
+    Tournament::Match::Options options;
+    options.concurrency = 1;
+    options.maxGames = 1000;
+    options.timeControl = {0, 1};
+    options.elo0 = 0;
+    options.elo1 = 100;
+    Tournament::Match match(local(), []() { return std::make_unique<FixedEngine>("0000"); },
+                            options);
+
+    auto result = match.run();
+
+    EXPECT_EQ(result.decision, Tournament::SPRT::Decision::ACCEPT_H1);
+    EXPECT_EQ(result.score.losses, 0);
+    EXPECT_EQ(result.score.draws, 0);
+    EXPECT_LT(result.score.games(), 100);
+    EXPECT_GE(result.llr, Tournament::SPRT(0, 100).upperBound());
+}
+
+TEST(TournamentTest, SlowEngineLosesOnTime) {
+    Tournament::Match::Options options;
+    options.timeControl.time = std::chrono::milliseconds(20);
+    options.timeControl.margin = std::chrono::milliseconds(5);
+    Tournament::Match match(local(), local(), options);
+    FixedEngine slow("e2e4", std::chrono::milliseconds(40));
+    Tournament::LocalEngine fast;
+
+    auto outcome = match.play(0, slow, fast);
+    EXPECT_EQ(outcome.result, "0-1");
+    EXPECT_EQ(outcome.reason, "time");
+
+    EXPECT_THROW(Tournament::Match(local(), local(), Tournament::Match::Options{0, 2, {}}),
+                 std::runtime_error);
+}
+
+TEST(TournamentTest, UCIEngineInChildProcess) {
+    std::vector<std::string> command = {
+        "/bin/sh", "-c",
+        "while read line; do case \"$line\" in uci) echo 'id name Dummy'; echo uciok;; "
+        "isready) echo readyok;; go*) echo 'bestmove e2e4 ponder e7e5';; quit) exit 0;; "
+        "esac; done"};
+    Tournament::UCIEngine engine(command);
+    engine.newGame();
+    engine.option("Hash", "16");
+    EXPECT_EQ(engine.go(PGN::STANDARD_FEN, {}, {0, 1}, {}), "e2e4");
+
+    Tournament::Match::Options options;
+    options.maxGames = 2;
+    options.isSprt = false;
+    options.timeControl = {0, 1};
+    Tournament::Match match(local(), [&command]() {
+        return std::make_unique<Tournament::UCIEngine>(command);
+    }, options);
+    auto result = match.run();
+    // e2e4 is illegal for black in the first game and on the second move in the other
+    EXPECT_EQ(result.score.wins, 2);
+
+    EXPECT_THROW(Tournament::UCIEngine({"/nonexistent/engine"}, std::chrono::milliseconds(500)),
+                 std::runtime_error);
+}
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <filesystem>
+#include <sstream>
+
+#include <model/tuning/tuning.hpp>
+
+class TuningTest : public ::testing::Test {
+  protected:
+    static constexpr const char *POSITIONS =
+        "# Quiet positions\n"
+        "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq - 0 1 [0.5]\n"
+        "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3 c9 \"1-0\";\n"
+        "rnbqkb1r/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1 1-0\n"
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKB1R w KQkq - 0 1 0\n"
+        "rnb1kbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0.9\n"
+        "r1bqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1 \"1/2-1/2\"\n"
+        "rnbqkbnr/pppp1ppp/8/4p3/8/8/PPPPP1PP/RNBQKBNR w KQkq - 0 1 0.25\n"
+        "4k3/8/8/8/8/8/3PPP2/1N2K1N1 w - - 0 1 1.0\n"
+        "rnb1kbnr/pppp1ppp/8/4p3/6Pq/5P2/PPPPP2P/RNBQKBNR w KQkq - 1 3 0-1\n";
+
+    Tuning::Dataset dataset;
+
+    void SetUp() override {
+        std::istringstream in(POSITIONS);
+        dataset.load(in);
+    }
+};
+
+TEST_F(TuningTest, FlattenParameters) {
+    auto defaults = Search::Parameters::defaults();
+    auto values = Tuning::flatten(defaults);
+
+    ASSERT_EQ(values.size(), Tuning::N_PARAMETERS);
+    EXPECT_EQ(values[Tuning::materialIndex(Pieces::Types::PAWN.index())], 100);
+    EXPECT_EQ(Tuning::unflatten(values), defaults);
+    EXPECT_THROW(Tuning::unflatten({1, 2}), std::runtime_error);
+}
+
+TEST_F(TuningTest, LoadLabelledPositions) {
+    // The checkmated position is skipped
+    EXPECT_EQ(dataset.size(), 8);
+    EXPECT_EQ(dataset.nBlocks(), 1);
+    EXPECT_FLOAT_EQ(dataset.results(0)[0], 0.5F);
+    EXPECT_FLOAT_EQ(dataset.results(0)[1], 1);
+    EXPECT_FLOAT_EQ(dataset.results(0)[3], 0);
+    EXPECT_FLOAT_EQ(dataset.results(0)[4], 0.9F);
+    EXPECT_FLOAT_EQ(dataset.results(0)[6], 0.25F);
+    // 31 pieces in the first lane, material and table for all but the Kings
+    EXPECT_GE(dataset.nSlots(0), 2 * 32 - 2);
+
+    std::istringstream more("4k3/8/8/8/8/8/3PPP2/1N2K1N1 b - - 0 1 [0.5]\n");
+    EXPECT_EQ(dataset.load(more), 1);
+    EXPECT_EQ(dataset.size(), 9);
+    EXPECT_EQ(dataset.nBlocks(), 2);
+    EXPECT_EQ(dataset.features(1)[1], Tuning::Dataset::PADDING);
+
+    std::istringstream noResult("4k3/8/8/8/8/8/8/4K3 w - - 0 1 draw\n");
+    EXPECT_THROW(dataset.load(noResult), std::runtime_error);
+    std::istringstream invalid("4k3/8/8 w - - 1-0\n");
+    EXPECT_THROW(dataset.load(invalid), std::runtime_error);
+}
+
+TEST_F(TuningTest, LossMatchesTheEvaluation) {
+    auto parameters = Tuning::flatten(Search::Parameters::defaults());
+    const double scale = 0.005;
+    Tuning::Tuner tuner(dataset);
+
+    std::istringstream in(POSITIONS);
+    Game::Board board(8, 8);
+    Pieces::Player first("White"), second("Black");
+    std::string line;
+    double expected = 0;
+    int n = 0;
+    while (std::getline(in, line)) {
+        if (line[0] == '#' || n == 8) continue;
+
+        // Placement, turn, castling and en passant
+        std::size_t end = 0;
+        for (int field = 0; field < 4; ++field) end = line.find(' ', end + 1);
+        board.initialize(first, second, line.substr(0, end));
+        int evaluation = Search::Evaluation::evaluate(board);
+        if (board.color(board.turn()) != NNUE::Network::WHITE) evaluation = -evaluation;
+        double result = dataset.results(0)[n++];
+        double probability = 1 / (1 + std::exp(-scale * evaluation));
+        expected -= result * std::log(probability) + (1 - result) * std::log(1 - probability);
+    }
+    EXPECT_NEAR(tuner.loss(parameters, scale), expected / 8, 1e-6);
+}
+
+TEST_F(TuningTest, GradientMatchesFiniteDifferences) {
+    auto parameters = Tuning::flatten(Search::Parameters::defaults());
+    const double scale = 0.004;
+    Tuning::Tuner tuner(dataset, {2});
+    std::vector<double> gradient;
+    tuner.loss(parameters, scale, &gradient);
+
+    for (int index : {Tuning::materialIndex(Pieces::Types::KNIGHT.index()),
+                      Tuning::tableIndex(Pieces::Types::PAWN.index(), 12),
+                      Tuning::materialIndex(Pieces::Types::QUEEN.index())}) {
+        auto plus = parameters, minus = parameters;
+        plus[index] += 0.5F;
+        minus[index] -= 0.5F;
+        double difference = (tuner.loss(plus, scale) - tuner.loss(minus, scale)) / 1.0;
+        EXPECT_NEAR(gradient[index], difference, 1e-6) << index;
+    }
+    EXPECT_EQ(gradient[Tuning::materialIndex(Pieces::Types::KING.index())], 0);
+}
+
+TEST_F(TuningTest, SimdMatchesScalar) {
+    for (int i = 0; i < 40; ++i) {
+        std::istringstream in(POSITIONS);
+        dataset.load(in);
+    }
+    auto parameters = Tuning::flatten(Search::Parameters::defaults());
+    Tuning::Tuner::Options options;
+    options.nThreads = 3;
+    Tuning::Tuner simd(dataset, options);
+    options.isSimd = false;
+    options.nThreads = 1;
+    Tuning::Tuner scalar(dataset, options);
+
+    std::vector<double> simdGradient, scalarGradient;
+    EXPECT_NEAR(simd.loss(parameters, 0.005, &simdGradient),
+                scalar.loss(parameters, 0.005, &scalarGradient), 1e-12);
+    for (int i = 0; i < Tuning::N_PARAMETERS; ++i) {
+        EXPECT_NEAR(simdGradient[i], scalarGradient[i], 1e-12);
+    }
+}
+
+TEST_F(TuningTest, TuneLowersTheLoss) {
+    Tuning::Tuner::Options options;
+    options.maxIterations = 50;
+    options.learningRate = 5;
+    Tuning::Tuner tuner(dataset, options);
+
+    std::vector<double> losses;
+    auto tuned = tuner.tune(Search::Parameters::defaults(),
+                            [&losses](int, double loss) { losses.push_back(loss); });
+
+    ASSERT_GT(losses.size(), 2);
+    EXPECT_GT(tuner.scale(), 0);
+    auto parameters = Tuning::flatten(tuned);
+    EXPECT_LT(tuner.loss(parameters, tuner.scale()), losses.front());
+    EXPECT_EQ(tuned.material[Pieces::Types::KING.index()], 0);
+}
+
+TEST_F(TuningTest, LoadQuietPositionsOfAnArchive) {
+    auto path = (std::filesystem::temp_directory_path() / "tuning_test.bin").string();
+    {
+        Archive::Writer writer(path);
+        Archive::Importer importer(writer);
+        PGN::Reader::read("1. e4 e5 2. Nf3 Nc6 3. Bb5 a6 1-0\n"
+                          "1. e4 d5 2. exd5 Qxd5 1/2-1/2\n"
+                          "1. d4 *\n",
+                          importer);
+    }
+    Archive::Reader reader(path);
+    Tuning::Dataset positions;
+
+    // 7 positions, then 5 minus the two right after a capture
+    EXPECT_EQ(positions.load(reader, 0), 10);
+    EXPECT_FLOAT_EQ(positions.results(0)[0], 1);
+    EXPECT_FLOAT_EQ(positions.results(0)[7], 0.5F);
+    EXPECT_EQ(positions.load(reader, 2), 6);
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include <model/utils/bounded_queue.hpp>
+
+TEST(BoundedQueueTest, KeepsOrderAndDrainsAfterClose) {
+    Utils::BoundedQueue<int> queue(4);
+    EXPECT_TRUE(queue.push(1));
+    EXPECT_TRUE(queue.push(2));
+    queue.close();
+    EXPECT_FALSE(queue.push(3));
+
+    int value = 0;
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, 2);
+    EXPECT_FALSE(queue.pop(value));
+
+    EXPECT_THROW(Utils::BoundedQueue<int>(0), std::runtime_error);
+}
+
+TEST(BoundedQueueTest, ProducersWaitForTheConsumer) {
+    Utils::BoundedQueue<int> queue(2);
+    const int nProducers = 4, nValues = 1000;
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < nProducers; ++producer) {
+        producers.emplace_back([&queue, producer]() {
+            for (int i = 0; i < nValues; ++i) queue.push(producer * nValues + i);
+        });
+    }
+
+    long long sum = 0;
+    std::size_t maxSize = 0;
+    int value;
+    for (int i = 0; i < nProducers * nValues; ++i) {
+        maxSize = std::max(maxSize, queue.size());
+        ASSERT_TRUE(queue.pop(value));
+        sum += value;
+    }
+    for (auto &producer : producers) producer.join();
+
+    long long n = nProducers * nValues;
+    EXPECT_EQ(sum, n * (n - 1) / 2);
+    EXPECT_LE(maxSize, queue.capacity());
+    EXPECT_EQ(queue.size(), 0);
+}
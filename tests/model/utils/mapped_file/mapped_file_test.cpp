@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include <model/utils/mapped_file.hpp>
+
+class MappedFileTest : public ::testing::Test {
+  protected:
+    std::string path;
+
+    void SetUp() override {
+        path = (std::filesystem::temp_directory_path() / "mapped_file_test.txt").string();
+        std::ofstream file(path, std::ios::binary);
+        file << "e4 e5 Nf3";
+    }
+
+    void TearDown() override { std::filesystem::remove(path); }
+};
+
+TEST_F(MappedFileTest, DefaultConstructor) {
+    Utils::MappedFile file;
+
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_EQ(file.size(), 0);
+    EXPECT_TRUE(file.view().empty());
+}
+
+TEST_F(MappedFileTest, MapsWholeFile) {
+    Utils::MappedFile file(path);
+
+    EXPECT_TRUE(file.isOpen());
+    EXPECT_EQ(file.size(), 9);
+    EXPECT_EQ(file.view(), "e4 e5 Nf3");
+    EXPECT_EQ(file.path(), path);
+}
+
+TEST_F(MappedFileTest, MoveTransfersMapping) {
+    Utils::MappedFile file(path);
+    Utils::MappedFile moved(std::move(file));
+
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_EQ(moved.view(), "e4 e5 Nf3");
+}
+
+TEST_F(MappedFileTest, OpenMissingFileThrows) {
+    EXPECT_THROW(Utils::MappedFile(path + ".missing"), std::runtime_error);
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <model/utils/reorder_buffer.hpp>
+
+TEST(ReorderBufferTest, TakesInIndexOrder) {
+    Utils::ReorderBuffer<int> buffer(4);
+    EXPECT_TRUE(buffer.put(2, 20));
+    EXPECT_TRUE(buffer.put(0, 0));
+    EXPECT_TRUE(buffer.put(3, 30));
+
+    int value = -1;
+    EXPECT_TRUE(buffer.take(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(buffer.put(1, 10));
+    EXPECT_TRUE(buffer.take(value));
+    EXPECT_EQ(value, 10);
+    EXPECT_TRUE(buffer.take(value));
+    EXPECT_EQ(value, 20);
+    EXPECT_EQ(buffer.next(), 3U);
+
+    // Stored values up to the first missing index are still taken
+    EXPECT_TRUE(buffer.put(5, 50));
+    buffer.close();
+    EXPECT_FALSE(buffer.put(4, 40));
+    EXPECT_TRUE(buffer.take(value));
+    EXPECT_EQ(value, 30);
+    EXPECT_FALSE(buffer.take(value));
+
+    EXPECT_THROW(Utils::ReorderBuffer<int>(0), std::runtime_error);
+}
+
+TEST(ReorderBufferTest, PutWaitsForTheWindow) {
+    Utils::ReorderBuffer<int> buffer(2);
+    std::atomic<bool> isPut{false};
+    std::thread producer([&]() {
+        buffer.put(2, 2);
+        isPut = true;
+    });
+    EXPECT_TRUE(buffer.put(1, 1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(isPut);
+
+    EXPECT_TRUE(buffer.put(0, 0));
+    int value = -1;
+    EXPECT_TRUE(buffer.take(value));
+    producer.join();
+    EXPECT_TRUE(isPut);
+    EXPECT_TRUE(buffer.take(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(buffer.take(value));
+    EXPECT_EQ(value, 2);
+}
+
+TEST(ReorderBufferTest, ProducersOutOfOrder) {
+    Utils::ReorderBuffer<std::size_t> buffer(3);
+    const std::size_t nProducers = 4, nValues = 1000;
+    std::vector<std::thread> producers;
+    // Each producer puts every nProducers-th index, so they race each other
+    for (std::size_t producer = 0; producer < nProducers; ++producer) {
+        producers.emplace_back([&buffer, producer]() {
+            for (std::size_t i = producer; i < nValues; i += nProducers) buffer.put(i, i * 7);
+        });
+    }
+
+    std::size_t value = 0;
+    for (std::size_t i = 0; i < nValues; ++i) {
+        ASSERT_TRUE(buffer.take(value));
+        EXPECT_EQ(value, i * 7);
+    }
+    for (auto &producer : producers) producer.join();
+    buffer.close();
+    EXPECT_FALSE(buffer.take(value));
+}